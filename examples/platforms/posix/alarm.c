@@ -29,6 +29,7 @@
 #include "platform-posix.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -37,11 +38,66 @@
 
 static bool s_is_running = false;
 static uint32_t s_alarm = 0;
+
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+
+static uint64_t s_now = 0;
+
+void platformAlarmInit(void)
+{
+    s_now = 0;
+}
+
+uint32_t otPlatAlarmGetNow(void)
+{
+    return (uint32_t)(s_now / 1000);
+}
+
+void platformAlarmAdvanceNow(uint64_t aDelta)
+{
+    s_now += aDelta;
+}
+
+uint64_t platformAlarmGetNext(void)
+{
+    uint64_t next = UINT64_MAX;
+    int32_t remaining;
+
+    if (s_is_running)
+    {
+        remaining = (int32_t)(s_alarm - otPlatAlarmGetNow());
+
+        // The alarm fires once the millisecond counter reaches s_alarm.
+        next = (remaining > 0) ? ((uint64_t)remaining * 1000 - (s_now % 1000)) : 0;
+    }
+
+    return next;
+}
+
+#else // OPENTHREAD_POSIX_VIRTUAL_TIME
+
 static struct timeval s_start;
 
+#if OPENTHREAD_POSIX_EPOLL
+static int s_timer_fd;
+static uint32_t s_timer_events;
+#endif
+
 void platformAlarmInit(void)
 {
     gettimeofday(&s_start, NULL);
+
+#if OPENTHREAD_POSIX_EPOLL
+    s_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (s_timer_fd == -1)
+    {
+        perror("timerfd_create");
+        exit(EXIT_FAILURE);
+    }
+
+    platformEpollAdd(s_timer_fd, &s_timer_events);
+#endif
 }
 
 uint32_t otPlatAlarmGetNow(void)
@@ -54,17 +110,67 @@ uint32_t otPlatAlarmGetNow(void)
     return (uint32_t)((tv.tv_sec * 1000) + (tv.tv_usec / 1000));
 }
 
+#endif // OPENTHREAD_POSIX_VIRTUAL_TIME
+
+#if OPENTHREAD_POSIX_EPOLL
+
+static void platformAlarmArm(void)
+{
+    struct itimerspec its;
+    struct timeval tv;
+    int64_t remaining;
+
+    memset(&its, 0, sizeof(its));
+
+    if (s_is_running)
+    {
+        gettimeofday(&tv, NULL);
+        timersub(&tv, &s_start, &tv);
+
+        // otPlatAlarmGetNow() truncates to milliseconds, so arm for the exact microsecond it reaches s_alarm.
+        remaining = (int64_t)(int32_t)(s_alarm - (uint32_t)((tv.tv_sec * 1000) + (tv.tv_usec / 1000))) * 1000 -
+                    (tv.tv_usec % 1000);
+
+        if (remaining > 0)
+        {
+            its.it_value.tv_sec = (time_t)(remaining / 1000000);
+            its.it_value.tv_nsec = (long)(remaining % 1000000) * 1000;
+        }
+        else
+        {
+            // A zero value would disarm the timer.
+            its.it_value.tv_nsec = 1;
+        }
+    }
+
+    if (timerfd_settime(s_timer_fd, 0, &its, NULL) == -1)
+    {
+        perror("timerfd_settime");
+        exit(EXIT_FAILURE);
+    }
+}
+
+#endif // OPENTHREAD_POSIX_EPOLL
+
 void otPlatAlarmStartAt(otInstance *aInstance, uint32_t t0, uint32_t dt)
 {
     (void)aInstance;
     s_alarm = t0 + dt;
     s_is_running = true;
+
+#if OPENTHREAD_POSIX_EPOLL
+    platformAlarmArm();
+#endif
 }
 
 void otPlatAlarmStop(otInstance *aInstance)
 {
     (void)aInstance;
     s_is_running = false;
+
+#if OPENTHREAD_POSIX_EPOLL
+    platformAlarmArm();
+#endif
 }
 
 void platformAlarmUpdateTimeout(struct timeval *aTimeout)
@@ -78,23 +184,25 @@ void platformAlarmUpdateTimeout(struct timeval *aTimeout)
 
     if (s_is_running)
     {
+        struct timeval timeout;
+
         remaining = (int32_t)(s_alarm - otPlatAlarmGetNow());
 
         if (remaining > 0)
         {
-            aTimeout->tv_sec = remaining / 1000;
-            aTimeout->tv_usec = (remaining % 1000) * 1000;
+            timeout.tv_sec = remaining / 1000;
+            timeout.tv_usec = (remaining % 1000) * 1000;
         }
         else
         {
-            aTimeout->tv_sec = 0;
-            aTimeout->tv_usec = 0;
+            timeout.tv_sec = 0;
+            timeout.tv_usec = 0;
+        }
+
+        if (timercmp(&timeout, aTimeout, <))
+        {
+            *aTimeout = timeout;
         }
-    }
-    else
-    {
-        aTimeout->tv_sec = 10;
-        aTimeout->tv_usec = 0;
     }
 }
 
@@ -102,10 +210,33 @@ void platformAlarmProcess(otInstance *aInstance)
 {
     int32_t remaining;
 
+#if OPENTHREAD_POSIX_EPOLL
+    bool expired = false;
+
+    if (s_timer_events & EPOLLIN)
+    {
+        uint64_t expirations;
+
+        s_timer_events = 0;
+        expired = (read(s_timer_fd, &expirations, sizeof(expirations)) == sizeof(expirations));
+    }
+
+#endif
+
     if (s_is_running)
     {
         remaining = (int32_t)(s_alarm - otPlatAlarmGetNow());
 
+#if OPENTHREAD_POSIX_EPOLL
+
+        // The timerfd runs on the monotonic clock, so it may expire just before the wall clock gets there.
+        if (remaining > 0 && expired)
+        {
+            platformAlarmArm();
+        }
+
+#endif
+
         if (remaining <= 0)
         {
             s_is_running = false;
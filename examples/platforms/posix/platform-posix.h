@@ -76,6 +76,38 @@ __forceinline void timersub(struct timeval *a, struct timeval *b, struct timeval
 #define POLL poll
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_VIRTUAL_TIME
+ *
+ * Define to 1 to drive alarms and radio from a discrete-event simulator instead of the wall clock and UDP fan-out.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_VIRTUAL_TIME
+#define OPENTHREAD_POSIX_VIRTUAL_TIME 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_EPOLL
+ *
+ * Define to 1 to wait for driver events with epoll and a timerfd instead of select().
+ *
+ */
+#ifndef OPENTHREAD_POSIX_EPOLL
+#if defined(__linux__) && !OPENTHREAD_POSIX_VIRTUAL_TIME
+#define OPENTHREAD_POSIX_EPOLL 1
+#else
+#define OPENTHREAD_POSIX_EPOLL 0
+#endif
+#endif
+
+#if OPENTHREAD_POSIX_EPOLL
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_EPOLL cannot be combined with OPENTHREAD_POSIX_VIRTUAL_TIME"
+#endif
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#endif
+
 #include "openthread/openthread.h"
 #include <common/code_utils.hpp>
 
@@ -85,6 +117,26 @@ __forceinline void timersub(struct timeval *a, struct timeval *b, struct timeval
 #include <string.h>
 #include <time.h>
 
+/**
+ * @def OPENTHREAD_POSIX_MAX_NODES
+ *
+ * The number of node IDs, starting at 0, that the radio link model can describe.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_MAX_NODES
+#define OPENTHREAD_POSIX_MAX_NODES 1024
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_RADIO_GROUP
+ *
+ * The IPv4 multicast group on the loopback interface that carries frames of the multicast radio medium.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_RADIO_GROUP
+#define OPENTHREAD_POSIX_RADIO_GROUP "224.0.0.116"
+#endif
+
 /**
  * Unique node ID.
  *
@@ -94,9 +146,179 @@ extern uint32_t NODE_ID;
 /**
  * Well-known Unique ID used by a simulated radio that supports promiscuous mode.
  *
+ * It also sets how many ports each PORT_OFFSET reserves, and can be raised with the MAX_NODES environment variable to
+ * simulate larger networks.
+ *
  */
 extern uint32_t WELLKNOWN_NODE_ID;
 
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+
+enum
+{
+    OT_SIM_EVENT_ALARM_FIRED    = 0,     ///< Simulator to node: time advanced. Node to simulator: going to sleep.
+    OT_SIM_EVENT_RADIO_RECEIVED = 1,     ///< Simulator to node: frame received. Node to simulator: frame transmitted.
+    OT_SIM_EVENT_DATA_MAX_SIZE  = 1024,
+};
+
+/**
+ * This structure represents an event exchanged with the simulator, in host byte order.
+ *
+ * A node tells the simulator it is idle by sending OT_SIM_EVENT_ALARM_FIRED with `mDelay` set to the time until its
+ * next alarm. In events sent by the simulator, `mDelay` is the virtual time elapsed since the previous event sent to
+ * the same node.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+struct Event
+{
+    uint64_t mDelay;                                ///< Delay in microseconds.
+    uint8_t  mEvent;                                ///< Event type.
+    uint16_t mDataLength;                           ///< Number of valid bytes in `mData`.
+    uint8_t  mData[OT_SIM_EVENT_DATA_MAX_SIZE];     ///< Event data.
+} OT_TOOL_PACKED_END;
+
+/**
+ * This function sends an event to the simulator.
+ *
+ * @param[in]  aEvent  A pointer to the event.
+ *
+ */
+void platformSimSendEvent(const struct Event *aEvent);
+
+/**
+ * This function advances the virtual time.
+ *
+ * @param[in]  aDelta  The time to advance in microseconds.
+ *
+ */
+void platformAlarmAdvanceNow(uint64_t aDelta);
+
+/**
+ * This function returns the virtual time remaining until the alarm fires.
+ *
+ * @returns The remaining time in microseconds, or UINT64_MAX if no alarm is running.
+ *
+ */
+uint64_t platformAlarmGetNext(void);
+
+/**
+ * This function indicates whether the radio driver has a frame waiting to be sent.
+ *
+ * @retval TRUE   A frame is waiting to be sent.
+ * @retval FALSE  No frame is waiting to be sent.
+ *
+ */
+bool platformRadioIsTransmitPending(void);
+
+/**
+ * This function returns the virtual time remaining until the radio driver needs processing.
+ *
+ * @returns The remaining time in microseconds, or UINT64_MAX if the radio driver has nothing scheduled.
+ *
+ */
+uint64_t platformRadioGetNext(void);
+
+/**
+ * This function delivers a frame received from the simulator to the radio driver.
+ *
+ * @param[in]  aInstance    The OpenThread instance structure.
+ * @param[in]  aBuf         A pointer to the channel followed by the PSDU.
+ * @param[in]  aBufLength   The number of bytes in @p aBuf.
+ *
+ */
+void platformRadioReceive(otInstance *aInstance, uint8_t *aBuf, uint16_t aBufLength);
+
+#endif // OPENTHREAD_POSIX_VIRTUAL_TIME
+
+/**
+ * This structure represents a driver serviced by PlatformProcessDrivers().
+ *
+ * Drivers are processed in the order they were registered, once per call to PlatformProcessDrivers().
+ *
+ */
+struct PlatformDriver
+{
+#if OPENTHREAD_POSIX_EPOLL
+    /**
+     * Indicates whether the driver has work it can do without waiting for a new event, or NULL.
+     *
+     */
+    bool (*mIsPending)(void);
+#else
+    /**
+     * Adds the driver's file descriptors to the sets passed to select(), or NULL.
+     *
+     */
+    void (*mUpdateFdSet)(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSet, int *aMaxFd);
+
+    /**
+     * Lowers the select() timeout to the time the driver next needs processing, or NULL.
+     *
+     */
+    void (*mUpdateTimeout)(struct timeval *aTimeout);
+#endif
+
+    /**
+     * Performs the driver processing.
+     *
+     */
+    void (*mProcess)(otInstance *aInstance);
+
+    struct PlatformDriver *mNext;   ///< Used by the driver list.
+};
+
+/**
+ * This function adds a driver to the drivers serviced by PlatformProcessDrivers().
+ *
+ * @param[in]  aDriver  A pointer to the driver, which must remain valid for the lifetime of the process.
+ *
+ */
+void platformDriverRegister(struct PlatformDriver *aDriver);
+
+#if OPENTHREAD_POSIX_EPOLL
+
+/**
+ * This function adds a file descriptor to the epoll set waited on by PlatformProcessDrivers().
+ *
+ * The descriptor is watched edge-triggered for input and output. Each event is OR-ed into @p aEvents, which the
+ * driver should clear once it drained the descriptor (i.e. got EAGAIN). Descriptors that epoll cannot watch, such as
+ * regular files, are reported as always ready.
+ *
+ * @param[in]  aFd      The file descriptor.
+ * @param[in]  aEvents  A pointer to the driver's latched epoll events for @p aFd.
+ *
+ */
+void platformEpollAdd(int aFd, uint32_t *aEvents);
+
+/**
+ * This function removes a file descriptor from the epoll set.
+ *
+ * @param[in]  aFd  The file descriptor.
+ *
+ */
+void platformEpollRemove(int aFd);
+
+/**
+ * This function indicates whether the radio driver has work it can do without waiting for a new event.
+ *
+ * @retval TRUE   The radio driver needs processing.
+ * @retval FALSE  The radio driver waits for an event.
+ *
+ */
+bool platformRadioIsPending(void);
+
+/**
+ * This function indicates whether the UART driver has work it can do without waiting for a new event.
+ *
+ * @retval TRUE   The UART driver needs processing.
+ * @retval FALSE  The UART driver waits for an event.
+ *
+ */
+bool platformUartIsPending(void);
+
+#endif // OPENTHREAD_POSIX_EPOLL
+
 /**
  * This function initializes the alarm service used by OpenThread.
  *
@@ -104,9 +326,9 @@ extern uint32_t WELLKNOWN_NODE_ID;
 void platformAlarmInit(void);
 
 /**
- * This function retrieves the time remaining until the alarm fires.
+ * This function lowers a timeout to the time remaining until the alarm fires.
  *
- * @param[out]  aTimeval  A pointer to the timeval struct.
+ * @param[inout]  aTimeval  A pointer to the timeval struct.
  *
  */
 void platformAlarmUpdateTimeout(struct timeval *tv);
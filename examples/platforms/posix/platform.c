@@ -53,9 +53,206 @@
 uint32_t NODE_ID = 1;
 uint32_t WELLKNOWN_NODE_ID = 34;
 
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+
+static int sSockFd;
+static uint16_t sPortOffset = 0;
+
+static void platformSimInit(void)
+{
+    struct sockaddr_in sockaddr;
+    char *offset;
+
+    offset = getenv("PORT_OFFSET");
+
+    if (offset)
+    {
+        char *endptr;
+
+        sPortOffset = (uint16_t)strtol(offset, &endptr, 0);
+
+        if (*endptr != '\0')
+        {
+            fprintf(stderr, "Invalid PORT_OFFSET: %s\n", offset);
+            exit(EXIT_FAILURE);
+        }
+
+        sPortOffset *= WELLKNOWN_NODE_ID;
+    }
+
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_port = htons(9000 + sPortOffset + NODE_ID);
+    sockaddr.sin_addr.s_addr = INADDR_ANY;
+
+    sSockFd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (sSockFd == -1)
+    {
+        perror("socket");
+        exit(EXIT_FAILURE);
+    }
+
+    if (bind(sSockFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1)
+    {
+        perror("bind");
+        exit(EXIT_FAILURE);
+    }
+}
+
+void platformSimSendEvent(const struct Event *aEvent)
+{
+    struct sockaddr_in sockaddr;
+    ssize_t rval;
+
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_port = htons(9000 + sPortOffset);
+    inet_pton(AF_INET, "127.0.0.1", &sockaddr.sin_addr);
+
+    rval = sendto(sSockFd, aEvent, offsetof(struct Event, mData) + aEvent->mDataLength,
+                  0, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
+
+    if (rval < 0)
+    {
+        perror("sendto");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void platformSimSendSleepEvent(void)
+{
+    struct Event event;
+    uint64_t radioNext = platformRadioGetNext();
+
+    event.mDelay = platformAlarmGetNext();
+
+    if (radioNext < event.mDelay)
+    {
+        event.mDelay = radioNext;
+    }
+
+    event.mEvent = OT_SIM_EVENT_ALARM_FIRED;
+    event.mDataLength = 0;
+
+    platformSimSendEvent(&event);
+}
+
+static void platformSimReceiveEvent(otInstance *aInstance)
+{
+    struct Event event;
+    ssize_t rval = recvfrom(sSockFd, (char *)&event, sizeof(event), 0, NULL, NULL);
+
+    if (rval < 0 || (size_t)rval < offsetof(struct Event, mData))
+    {
+        perror("recvfrom");
+        exit(EXIT_FAILURE);
+    }
+
+    platformAlarmAdvanceNow(event.mDelay);
+
+    switch (event.mEvent)
+    {
+    case OT_SIM_EVENT_ALARM_FIRED:
+        // platformAlarmProcess() fires the alarm if it is due.
+        break;
+
+    case OT_SIM_EVENT_RADIO_RECEIVED:
+        platformRadioReceive(aInstance, event.mData, event.mDataLength);
+        break;
+
+    default:
+        assert(false);
+        break;
+    }
+}
+
+#endif // OPENTHREAD_POSIX_VIRTUAL_TIME
+
+static struct PlatformDriver *sDrivers = NULL;
+
+#if OPENTHREAD_POSIX_EPOLL
+
+enum
+{
+    kMaxEpollEvents = 8,
+};
+
+static int sEpollFd = -1;
+
+void platformEpollAdd(int aFd, uint32_t *aEvents)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLOUT | EPOLLET;
+    event.data.ptr = aEvents;
+
+    if (epoll_ctl(sEpollFd, EPOLL_CTL_ADD, aFd, &event) == -1)
+    {
+        // Regular files cannot be watched, but never block either.
+        if (errno != EPERM)
+        {
+            perror("epoll_ctl");
+            exit(EXIT_FAILURE);
+        }
+
+        *aEvents |= EPOLLIN | EPOLLOUT;
+    }
+}
+
+void platformEpollRemove(int aFd)
+{
+    epoll_ctl(sEpollFd, EPOLL_CTL_DEL, aFd, NULL);
+}
+
+#elif !OPENTHREAD_POSIX_VIRTUAL_TIME
+
+static void platformRadioUpdateFdSetDriver(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSet, int *aMaxFd)
+{
+    (void)aErrorFdSet;
+    platformRadioUpdateFdSet(aReadFdSet, aWriteFdSet, aMaxFd);
+}
+
+#endif // OPENTHREAD_POSIX_EPOLL
+
+static void platformUartProcessDriver(otInstance *aInstance)
+{
+    (void)aInstance;
+    platformUartProcess();
+}
+
+#if OPENTHREAD_POSIX_EPOLL
+static struct PlatformDriver sUartDriver = { platformUartIsPending, platformUartProcessDriver, NULL };
+static struct PlatformDriver sRadioDriver = { platformRadioIsPending, platformRadioProcess, NULL };
+static struct PlatformDriver sAlarmDriver = { NULL, platformAlarmProcess, NULL };
+#elif OPENTHREAD_POSIX_VIRTUAL_TIME
+static struct PlatformDriver sUartDriver = { platformUartUpdateFdSet, NULL, platformUartProcessDriver, NULL };
+static struct PlatformDriver sRadioDriver = { NULL, NULL, platformRadioProcess, NULL };
+static struct PlatformDriver sAlarmDriver = { NULL, NULL, platformAlarmProcess, NULL };
+#else
+static struct PlatformDriver sUartDriver = { platformUartUpdateFdSet, NULL, platformUartProcessDriver, NULL };
+static struct PlatformDriver sRadioDriver = { platformRadioUpdateFdSetDriver, NULL, platformRadioProcess, NULL };
+static struct PlatformDriver sAlarmDriver = { NULL, platformAlarmUpdateTimeout, platformAlarmProcess, NULL };
+#endif
+
+void platformDriverRegister(struct PlatformDriver *aDriver)
+{
+    struct PlatformDriver **tail = &sDrivers;
+
+    while (*tail != NULL)
+    {
+        tail = &(*tail)->mNext;
+    }
+
+    aDriver->mNext = NULL;
+    *tail = aDriver;
+}
+
 void PlatformInit(int argc, char *argv[])
 {
     char *endptr;
+    char *maxNodes;
 
     if (argc != 2)
     {
@@ -75,27 +272,141 @@ void PlatformInit(int argc, char *argv[])
         exit(EXIT_FAILURE);
     }
 
+    maxNodes = getenv("MAX_NODES");
+
+    if (maxNodes != NULL)
+    {
+        WELLKNOWN_NODE_ID = (uint32_t)strtoul(maxNodes, &endptr, 0);
+
+        if (*endptr != '\0' || WELLKNOWN_NODE_ID < 2 || WELLKNOWN_NODE_ID > UINT16_MAX - 9000)
+        {
+            fprintf(stderr, "Invalid MAX_NODES: %s\n", maxNodes);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+#if OPENTHREAD_POSIX_EPOLL
+    sEpollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (sEpollFd == -1)
+    {
+        perror("epoll_create1");
+        exit(EXIT_FAILURE);
+    }
+
+#endif
+
+    platformDriverRegister(&sUartDriver);
+    platformDriverRegister(&sRadioDriver);
+    platformDriverRegister(&sAlarmDriver);
+
     platformAlarmInit();
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    platformSimInit();
+#endif
     platformRadioInit();
     platformRandomInit();
 }
 
 void PlatformProcessDrivers(otInstance *aInstance)
 {
+    struct PlatformDriver *driver;
+    int rval;
+#if OPENTHREAD_POSIX_EPOLL
+    struct epoll_event events[kMaxEpollEvents];
+    int timeout = -1;
+    int i;
+
+    // The alarm driver arms a timerfd, so with nothing pending we can wait indefinitely.
+    if (otTaskletsArePending(aInstance))
+    {
+        timeout = 0;
+    }
+
+    for (driver = sDrivers; driver != NULL && timeout != 0; driver = driver->mNext)
+    {
+        if (driver->mIsPending != NULL && driver->mIsPending())
+        {
+            timeout = 0;
+        }
+    }
+
+    rval = epoll_wait(sEpollFd, events, kMaxEpollEvents, timeout);
+
+    if ((rval < 0) && (errno != EINTR))
+    {
+        perror("epoll_wait");
+        exit(EXIT_FAILURE);
+    }
+
+    for (i = 0; i < rval; i++)
+    {
+        *(uint32_t *)events[i].data.ptr |= events[i].events;
+    }
+
+#else // OPENTHREAD_POSIX_EPOLL
     fd_set read_fds;
     fd_set write_fds;
     fd_set error_fds;
     int max_fd = -1;
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
     struct timeval timeout;
-    int rval;
+#endif
 
     FD_ZERO(&read_fds);
     FD_ZERO(&write_fds);
     FD_ZERO(&error_fds);
 
-    platformUartUpdateFdSet(&read_fds, &write_fds, &error_fds, &max_fd);
-    platformRadioUpdateFdSet(&read_fds, &write_fds, &max_fd);
-    platformAlarmUpdateTimeout(&timeout);
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    timeout.tv_sec = 10;
+    timeout.tv_usec = 0;
+#endif
+
+    for (driver = sDrivers; driver != NULL; driver = driver->mNext)
+    {
+        if (driver->mUpdateFdSet != NULL)
+        {
+            driver->mUpdateFdSet(&read_fds, &write_fds, &error_fds, &max_fd);
+        }
+
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+
+        if (driver->mUpdateTimeout != NULL)
+        {
+            driver->mUpdateTimeout(&timeout);
+        }
+
+#endif
+    }
+
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    FD_SET(sSockFd, &read_fds);
+
+    if (max_fd < sSockFd)
+    {
+        max_fd = sSockFd;
+    }
+
+    // Virtual time only advances while every node sleeps, so block until the simulator or the UART wakes us.
+    if (!otTaskletsArePending(aInstance) && !platformRadioIsTransmitPending())
+    {
+        platformSimSendSleepEvent();
+
+        rval = select(max_fd + 1, &read_fds, &write_fds, &error_fds, NULL);
+
+        if ((rval < 0) && (errno != EINTR))
+        {
+            perror("select");
+            exit(EXIT_FAILURE);
+        }
+
+        if (rval > 0 && FD_ISSET(sSockFd, &read_fds))
+        {
+            platformSimReceiveEvent(aInstance);
+        }
+    }
+
+#else // OPENTHREAD_POSIX_VIRTUAL_TIME
 
     if (!otTaskletsArePending(aInstance))
     {
@@ -108,7 +419,11 @@ void PlatformProcessDrivers(otInstance *aInstance)
         }
     }
 
-    platformUartProcess();
-    platformRadioProcess(aInstance);
-    platformAlarmProcess(aInstance);
+#endif // OPENTHREAD_POSIX_VIRTUAL_TIME
+#endif // OPENTHREAD_POSIX_EPOLL
+
+    for (driver = sDrivers; driver != NULL; driver = driver->mNext)
+    {
+        driver->mProcess(aInstance);
+    }
 }
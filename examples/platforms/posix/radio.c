@@ -28,6 +28,9 @@
 
 #include "platform-posix.h"
 
+#include <errno.h>
+
+#include "openthread/platform/alarm.h"
 #include "openthread/platform/diag.h"
 #include "openthread/platform/radio.h"
 
@@ -71,6 +74,8 @@ enum
     IEEE802154_KEY_ID_MODE_MASK   = 3 << 3,
 
     IEEE802154_MACCMD_DATA_REQ    = 4,
+
+    RADIO_DEFAULT_RSSI            = -20,
 };
 
 OT_TOOL_PACKED_BEGIN
@@ -96,11 +101,52 @@ static RadioPacket sAckFrame;
 static uint8_t sExtendedAddress[OT_EXT_ADDRESS_SIZE];
 static uint16_t sShortAddress;
 static uint16_t sPanid;
-static int sSockFd;
 static bool sPromiscuous = false;
 static bool sAckWait = false;
+static int8_t sReceiveRssi = RADIO_DEFAULT_RSSI;
+
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+static bool sEnergyScanning = false;
+static uint32_t sEnergyScanEndTime = 0;
+#else
+
+/**
+ * This structure represents a simulated radio medium backend.
+ *
+ */
+struct RadioMedium
+{
+    const char *mName;                                                      ///< Value of RADIO_MEDIUM selecting it.
+    void (*mInit)(void);                                                    ///< Opens sRxFd and sTxFd.
+    void (*mSend)(const struct RadioMessage *aMessage, uint16_t aLength);   ///< Delivers a frame to all other nodes.
+};
+
+static void radioMulticastInit(void);
+static void radioMulticastSend(const struct RadioMessage *aMessage, uint16_t aLength);
+static void radioUnicastInit(void);
+static void radioUnicastSend(const struct RadioMessage *aMessage, uint16_t aLength);
+
+static const struct RadioMedium sRadioMedia[] =
+{
+    { "multicast", radioMulticastInit, radioMulticastSend },
+    { "unicast", radioUnicastInit, radioUnicastSend },
+};
+
+static const struct RadioMedium *sRadioMedium = &sRadioMedia[0];
+static int sRxFd;
+static int sTxFd;
 static uint16_t sPortOffset = 0;
 
+static uint8_t sLinkLoss[OPENTHREAD_POSIX_MAX_NODES];
+static int8_t sLinkRssi[OPENTHREAD_POSIX_MAX_NODES];
+static uint32_t sLinkLossState;
+
+#if OPENTHREAD_POSIX_EPOLL
+static uint32_t sRxEvents;
+#endif
+
+#endif
+
 static inline bool isFrameTypeAck(const uint8_t *frame)
 {
     return (frame[0] & IEEE802154_FRAME_TYPE_MASK) == IEEE802154_FRAME_TYPE_ACK;
@@ -328,13 +374,237 @@ void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
     sPromiscuous = aEnable;
 }
 
-void platformRadioInit(void)
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+
+static void radioGetLoopbackAddress(struct sockaddr_in *aSockaddr, uint16_t aPort)
+{
+    memset(aSockaddr, 0, sizeof(*aSockaddr));
+    aSockaddr->sin_family = AF_INET;
+    aSockaddr->sin_port = htons(aPort);
+    inet_pton(AF_INET, "127.0.0.1", &aSockaddr->sin_addr);
+}
+
+static void radioMulticastInit(void)
 {
     struct sockaddr_in sockaddr;
-    char *offset;
+    struct ip_mreq mreq;
+    int one = 1;
+
+    // Every node joins the same group on the base port and receives each frame from a single send.
+    sRxFd = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (sRxFd == -1)
+    {
+        perror("socket");
+        exit(EXIT_FAILURE);
+    }
+
+    if (setsockopt(sRxFd, SOL_SOCKET, SO_REUSEADDR, (const char *)&one, sizeof(one)) == -1)
+    {
+        perror("setsockopt");
+        exit(EXIT_FAILURE);
+    }
+
+#ifdef SO_REUSEPORT
+
+    if (setsockopt(sRxFd, SOL_SOCKET, SO_REUSEPORT, (const char *)&one, sizeof(one)) == -1)
+    {
+        perror("setsockopt");
+        exit(EXIT_FAILURE);
+    }
+
+#endif
+
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_port = htons(9000 + sPortOffset);
+#ifdef _WIN32
+    sockaddr.sin_addr.s_addr = INADDR_ANY;
+#else
+    // Binding to the group keeps unicast datagrams sent to the base port out of the medium.
+    inet_pton(AF_INET, OPENTHREAD_POSIX_RADIO_GROUP, &sockaddr.sin_addr);
+#endif
+
+    if (bind(sRxFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1)
+    {
+        perror("bind");
+        exit(EXIT_FAILURE);
+    }
+
+    inet_pton(AF_INET, OPENTHREAD_POSIX_RADIO_GROUP, &mreq.imr_multiaddr);
+    inet_pton(AF_INET, "127.0.0.1", &mreq.imr_interface);
+
+    if (setsockopt(sRxFd, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *)&mreq, sizeof(mreq)) == -1)
+    {
+        perror("setsockopt");
+        exit(EXIT_FAILURE);
+    }
+
+    // Frames are sent from the node's own port so that receivers can tell who sent them.
+    sTxFd = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (sTxFd == -1)
+    {
+        perror("socket");
+        exit(EXIT_FAILURE);
+    }
+
+    if (setsockopt(sTxFd, IPPROTO_IP, IP_MULTICAST_IF, (const char *)&mreq.imr_interface,
+                   sizeof(mreq.imr_interface)) == -1 ||
+        setsockopt(sTxFd, IPPROTO_IP, IP_MULTICAST_LOOP, (const char *)&one, sizeof(one)) == -1)
+    {
+        perror("setsockopt");
+        exit(EXIT_FAILURE);
+    }
+
+    radioGetLoopbackAddress(&sockaddr, (uint16_t)(9000 + sPortOffset + NODE_ID));
+
+    if (bind(sTxFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr)) == -1)
+    {
+        perror("bind");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void radioMulticastSend(const struct RadioMessage *aMessage, uint16_t aLength)
+{
+    struct sockaddr_in sockaddr;
+    ssize_t rval;
+
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_port = htons(9000 + sPortOffset);
+    inet_pton(AF_INET, OPENTHREAD_POSIX_RADIO_GROUP, &sockaddr.sin_addr);
+
+    rval = sendto(sTxFd, (const char *)aMessage, aLength, 0, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
+
+    if (rval < 0)
+    {
+        perror("sendto");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void radioUnicastInit(void)
+{
+    struct sockaddr_in sockaddr;
+
     memset(&sockaddr, 0, sizeof(sockaddr));
     sockaddr.sin_family = AF_INET;
 
+    if (sPromiscuous)
+    {
+        sockaddr.sin_port = htons(9000 + sPortOffset + WELLKNOWN_NODE_ID);
+    }
+    else
+    {
+        sockaddr.sin_port = htons(9000 + sPortOffset + NODE_ID);
+    }
+
+    sockaddr.sin_addr.s_addr = INADDR_ANY;
+
+    sRxFd = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    bind(sRxFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
+
+    sTxFd = sRxFd;
+}
+
+static void radioUnicastSend(const struct RadioMessage *aMessage, uint16_t aLength)
+{
+    struct sockaddr_in sockaddr;
+    uint32_t i;
+
+    for (i = 1; i <= WELLKNOWN_NODE_ID; i++)
+    {
+        ssize_t rval;
+
+        if (NODE_ID == i)
+        {
+            continue;
+        }
+
+        radioGetLoopbackAddress(&sockaddr, (uint16_t)(9000 + sPortOffset + i));
+        rval = sendto(sTxFd, (const char *)aMessage, aLength, 0, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
+
+        if (rval < 0)
+        {
+            perror("sendto");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+static void radioLinkModelInit(void)
+{
+    const char *path = getenv("RADIO_LINK_MODEL");
+    FILE *file = NULL;
+    char line[128];
+    unsigned long src;
+    unsigned long dst;
+    unsigned long loss;
+    long rssi;
+    char extra;
+    size_t i;
+
+    for (i = 0; i < OPENTHREAD_POSIX_MAX_NODES; i++)
+    {
+        sLinkLoss[i] = 0;
+        sLinkRssi[i] = RADIO_DEFAULT_RSSI;
+    }
+
+    sLinkLossState = NODE_ID;
+
+    VerifyOrExit(path != NULL, ;);
+
+    file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    // Each line reads "<src> <dst> <loss percent> <rssi>"; only links towards this node matter here.
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char *cur = line + strspn(line, " \t");
+
+        if (*cur == '#' || *cur == '\n' || *cur == '\r' || *cur == '\0')
+        {
+            continue;
+        }
+
+        if (sscanf(cur, "%lu %lu %lu %ld %c", &src, &dst, &loss, &rssi, &extra) != 4 ||
+            src >= OPENTHREAD_POSIX_MAX_NODES || loss > 100 || rssi < -128 || rssi > 127)
+        {
+            fprintf(stderr, "Invalid RADIO_LINK_MODEL entry: %s", line);
+            exit(EXIT_FAILURE);
+        }
+
+        if (dst == NODE_ID)
+        {
+            sLinkLoss[src] = (uint8_t)loss;
+            sLinkRssi[src] = (int8_t)rssi;
+        }
+    }
+
+exit:
+
+    if (file != NULL)
+    {
+        fclose(file);
+    }
+}
+
+#endif // !OPENTHREAD_POSIX_VIRTUAL_TIME
+
+void platformRadioInit(void)
+{
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
+    char *offset;
+    char *medium;
+    size_t i;
+
     offset = getenv("PORT_OFFSET");
 
     if (offset)
@@ -352,19 +622,35 @@ void platformRadioInit(void)
         sPortOffset *= WELLKNOWN_NODE_ID;
     }
 
-    if (sPromiscuous)
-    {
-        sockaddr.sin_port = htons(9000 + sPortOffset + WELLKNOWN_NODE_ID);
-    }
-    else
+    medium = getenv("RADIO_MEDIUM");
+
+    if (medium)
     {
-        sockaddr.sin_port = htons(9000 + sPortOffset + NODE_ID);
+        sRadioMedium = NULL;
+
+        for (i = 0; i < sizeof(sRadioMedia) / sizeof(sRadioMedia[0]); i++)
+        {
+            if (strcmp(medium, sRadioMedia[i].mName) == 0)
+            {
+                sRadioMedium = &sRadioMedia[i];
+                break;
+            }
+        }
+
+        if (sRadioMedium == NULL)
+        {
+            fprintf(stderr, "Invalid RADIO_MEDIUM: %s\n", medium);
+            exit(EXIT_FAILURE);
+        }
     }
 
-    sockaddr.sin_addr.s_addr = INADDR_ANY;
+    sRadioMedium->mInit();
+    radioLinkModelInit();
 
-    sSockFd = (int)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-    bind(sSockFd, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
+#if OPENTHREAD_POSIX_EPOLL
+    platformEpollAdd(sRxFd, &sRxEvents);
+#endif
+#endif // !OPENTHREAD_POSIX_VIRTUAL_TIME
 
     sReceiveFrame.mPsdu = sReceiveMessage.mPsdu;
     sTransmitFrame.mPsdu = sTransmitMessage.mPsdu;
@@ -457,7 +743,12 @@ int8_t otPlatRadioGetRssi(otInstance *aInstance)
 otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
 {
     (void)aInstance;
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    // Sampling RSSI from a tasklet keeps the node busy forever while virtual time stands still.
+    return kRadioCapsEnergyScan;
+#else
     return kRadioCapsNone;
+#endif
 }
 
 bool otPlatRadioGetPromiscuous(otInstance *aInstance)
@@ -466,18 +757,8 @@ bool otPlatRadioGetPromiscuous(otInstance *aInstance)
     return sPromiscuous;
 }
 
-void radioReceive(otInstance *aInstance)
+static void radioHandleMessage(otInstance *aInstance)
 {
-    ssize_t rval = recvfrom(sSockFd, (char *)&sReceiveMessage, sizeof(sReceiveMessage), 0, NULL, NULL);
-
-    if (rval < 0)
-    {
-        perror("recvfrom");
-        exit(EXIT_FAILURE);
-    }
-
-    sReceiveFrame.mLength = (uint8_t)(rval - 1);
-
     if (sAckWait &&
         sTransmitFrame.mChannel == sReceiveMessage.mChannel &&
         isFrameTypeAck(sReceiveFrame.mPsdu) &&
@@ -505,6 +786,100 @@ void radioReceive(otInstance *aInstance)
     }
 }
 
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+
+void platformRadioReceive(otInstance *aInstance, uint8_t *aBuf, uint16_t aBufLength)
+{
+    VerifyOrExit(aBufLength > 1 && aBufLength <= sizeof(sReceiveMessage), ;);
+
+    memcpy(&sReceiveMessage, aBuf, aBufLength);
+    sReceiveFrame.mLength = (uint8_t)(aBufLength - 1);
+
+    radioHandleMessage(aInstance);
+
+exit:
+    return;
+}
+
+bool platformRadioIsTransmitPending(void)
+{
+    return sState == kStateTransmit && !sAckWait;
+}
+
+uint64_t platformRadioGetNext(void)
+{
+    uint64_t next = UINT64_MAX;
+    int32_t remaining;
+
+    if (sEnergyScanning)
+    {
+        remaining = (int32_t)(sEnergyScanEndTime - otPlatAlarmGetNow());
+        next = (remaining > 0) ? (uint64_t)remaining * 1000 : 0;
+    }
+
+    return next;
+}
+
+#else // OPENTHREAD_POSIX_VIRTUAL_TIME
+
+void radioReceive(otInstance *aInstance)
+{
+    struct sockaddr_in sockaddr;
+    socklen_t sockaddrLength = sizeof(sockaddr);
+    uint32_t src;
+#if OPENTHREAD_POSIX_EPOLL
+    ssize_t rval = recvfrom(sRxFd, (char *)&sReceiveMessage, sizeof(sReceiveMessage), MSG_DONTWAIT,
+                            (struct sockaddr *)&sockaddr, &sockaddrLength);
+
+    if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        ExitNow(sRxEvents &= ~(uint32_t)EPOLLIN);
+    }
+
+#else
+    ssize_t rval = recvfrom(sRxFd, (char *)&sReceiveMessage, sizeof(sReceiveMessage), 0,
+                            (struct sockaddr *)&sockaddr, &sockaddrLength);
+#endif
+
+    if (rval < 0)
+    {
+        perror("recvfrom");
+        exit(EXIT_FAILURE);
+    }
+
+    VerifyOrExit(rval > 1, ;);
+
+    // Frames leave from the sender's node port, which identifies the link for the link model.
+    src = (uint32_t)(uint16_t)(ntohs(sockaddr.sin_port) - 9000 - sPortOffset);
+
+    // The multicast medium loops our own frames back.
+    VerifyOrExit(src != NODE_ID, ;);
+
+    if (src < OPENTHREAD_POSIX_MAX_NODES)
+    {
+        if (sLinkLoss[src] != 0)
+        {
+            sLinkLossState = sLinkLossState * 1103515245 + 12345;
+            VerifyOrExit(((sLinkLossState >> 16) % 100) >= sLinkLoss[src], ;);
+        }
+
+        sReceiveRssi = sLinkRssi[src];
+    }
+    else
+    {
+        sReceiveRssi = RADIO_DEFAULT_RSSI;
+    }
+
+    sReceiveFrame.mLength = (uint8_t)(rval - 1);
+
+    radioHandleMessage(aInstance);
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_POSIX_VIRTUAL_TIME
+
 void radioSendMessage(otInstance *aInstance)
 {
     sTransmitMessage.mChannel = sTransmitFrame.mChannel;
@@ -531,39 +906,71 @@ void radioSendMessage(otInstance *aInstance)
     }
 }
 
+#if !OPENTHREAD_POSIX_VIRTUAL_TIME
 void platformRadioUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, int *aMaxFd)
 {
     if (aReadFdSet != NULL && (sState != kStateTransmit || sAckWait))
     {
-        FD_SET(sSockFd, aReadFdSet);
+        FD_SET(sRxFd, aReadFdSet);
 
-        if (aMaxFd != NULL && *aMaxFd < sSockFd)
+        if (aMaxFd != NULL && *aMaxFd < sRxFd)
         {
-            *aMaxFd = sSockFd;
+            *aMaxFd = sRxFd;
         }
     }
 
     if (aWriteFdSet != NULL && sState == kStateTransmit && !sAckWait)
     {
-        FD_SET(sSockFd, aWriteFdSet);
+        FD_SET(sTxFd, aWriteFdSet);
 
-        if (aMaxFd != NULL && *aMaxFd < sSockFd)
+        if (aMaxFd != NULL && *aMaxFd < sTxFd)
         {
-            *aMaxFd = sSockFd;
+            *aMaxFd = sTxFd;
         }
     }
 }
 
+#endif // !OPENTHREAD_POSIX_VIRTUAL_TIME
+
+#if OPENTHREAD_POSIX_EPOLL
+
+bool platformRadioIsPending(void)
+{
+    // Like the select() loop, only read frames while not holding a frame to send.
+    return (sState == kStateTransmit && !sAckWait) ||
+           ((sRxEvents & EPOLLIN) && (sState != kStateTransmit || sAckWait));
+}
+
+#endif // OPENTHREAD_POSIX_EPOLL
+
 void platformRadioProcess(otInstance *aInstance)
 {
+#if OPENTHREAD_POSIX_EPOLL
+
+    while ((sRxEvents & EPOLLIN) && (sState != kStateTransmit || sAckWait))
+    {
+        radioReceive(aInstance);
+    }
+
+#elif !OPENTHREAD_POSIX_VIRTUAL_TIME
     const int flags = POLLIN | POLLRDNORM | POLLERR | POLLNVAL | POLLHUP;
-    struct pollfd pollfd = { sSockFd, flags, 0 };
+    struct pollfd pollfd = { sRxFd, flags, 0 };
 
     if (POLL(&pollfd, 1, 0) > 0 && (pollfd.revents & flags) != 0)
     {
         radioReceive(aInstance);
     }
 
+#else
+
+    if (sEnergyScanning && (int32_t)(sEnergyScanEndTime - otPlatAlarmGetNow()) <= 0)
+    {
+        sEnergyScanning = false;
+        otPlatRadioEnergyScanDone(aInstance, otPlatRadioGetRssi(aInstance));
+    }
+
+#endif
+
     if (sState == kStateTransmit && !sAckWait)
     {
         radioSendMessage(aInstance);
@@ -573,7 +980,9 @@ void platformRadioProcess(otInstance *aInstance)
 void radioTransmit(struct RadioMessage *msg, const struct RadioPacket *pkt)
 {
     uint32_t i;
-    struct sockaddr_in sockaddr;
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    struct Event event;
+#endif
 
     uint16_t crc = 0;
     uint16_t crc_offset = pkt->mLength - sizeof(uint16_t);
@@ -586,29 +995,17 @@ void radioTransmit(struct RadioMessage *msg, const struct RadioPacket *pkt)
     msg->mPsdu[crc_offset] = crc & 0xff;
     msg->mPsdu[crc_offset + 1] = crc >> 8;
 
-    memset(&sockaddr, 0, sizeof(sockaddr));
-    sockaddr.sin_family = AF_INET;
-    inet_pton(AF_INET, "127.0.0.1", &sockaddr.sin_addr);
-
-    for (i = 1; i <= WELLKNOWN_NODE_ID; i++)
-    {
-        ssize_t rval;
-
-        if (NODE_ID == i)
-        {
-            continue;
-        }
-
-        sockaddr.sin_port = htons(9000 + sPortOffset + i);
-        rval = sendto(sSockFd, (const char *)msg, 1 + pkt->mLength,
-                      0, (struct sockaddr *)&sockaddr, sizeof(sockaddr));
-
-        if (rval < 0)
-        {
-            perror("recvfrom");
-            exit(EXIT_FAILURE);
-        }
-    }
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    // The simulator delivers the frame to every other node, including the sniffer.
+    event.mDelay = 0;
+    event.mEvent = OT_SIM_EVENT_RADIO_RECEIVED;
+    event.mDataLength = 1 + pkt->mLength;
+    memcpy(event.mData, msg, event.mDataLength);
+
+    platformSimSendEvent(&event);
+#else
+    sRadioMedium->mSend(msg, (uint16_t)(1 + pkt->mLength));
+#endif // OPENTHREAD_POSIX_VIRTUAL_TIME
 }
 
 void radioSendAck(void)
@@ -663,7 +1060,7 @@ void radioProcessFrame(otInstance *aInstance)
         ExitNow(error = kThreadError_Abort);
     }
 
-    sReceiveFrame.mPower = -20;
+    sReceiveFrame.mPower = sReceiveRssi;
     sReceiveFrame.mLqi = kPhyNoLqi;
 
     // generate acknowledgment
@@ -735,8 +1132,15 @@ ThreadError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, u
 {
     (void)aInstance;
     (void)aScanChannel;
+
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+    sEnergyScanning = true;
+    sEnergyScanEndTime = otPlatAlarmGetNow() + aScanDuration;
+    return kThreadError_None;
+#else
     (void)aScanDuration;
     return kThreadError_NotImplemented;
+#endif
 }
 
 void otPlatRadioSetDefaultTxPower(otInstance *aInstance, int8_t aPower)
@@ -45,8 +45,38 @@ static uint32_t s_state = 1;
 
 void platformRandomInit(void)
 {
+    char *seed = getenv("RANDOM_SEED");
+
+    if (seed != NULL)
+    {
+        char *endptr;
+
+        s_state = (uint32_t)strtoul(seed, &endptr, 0);
+
+        if (*endptr != '\0')
+        {
+            fprintf(stderr, "Invalid RANDOM_SEED: %s\n", seed);
+            exit(EXIT_FAILURE);
+        }
+    }
+    else
+    {
+#if OPENTHREAD_POSIX_VIRTUAL_TIME
+        // Runs must replay identically, so never draw the seed from the wall clock.
+        s_state = 0;
+#else
+        s_state = (uint32_t)time(NULL);
+#endif
+    }
+
     // Multiplying NODE_ID assures that no two nodes gets the same seed within an hour.
-    s_state = (uint32_t)time(NULL) + (3600 * NODE_ID);
+    s_state += 3600 * NODE_ID;
+
+    // The generator sticks at zero.
+    if (s_state == 0)
+    {
+        s_state = 1;
+    }
 }
 
 uint32_t otPlatRandomGet(void)
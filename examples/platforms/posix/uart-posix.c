@@ -59,6 +59,24 @@ static int s_out_fd;
 static struct termios original_stdin_termios;
 static struct termios original_stdout_termios;
 
+#if OPENTHREAD_POSIX_EPOLL
+static uint32_t s_in_events;
+static uint32_t s_out_events;
+static int original_stdin_flags;
+static int original_stdout_flags;
+
+// stdin and stdout are shared with the parent, so give them back in blocking mode.
+static void restore_stdin_flags(void)
+{
+    fcntl(s_in_fd, F_SETFL, original_stdin_flags);
+}
+
+static void restore_stdout_flags(void)
+{
+    fcntl(s_out_fd, F_SETFL, original_stdout_flags);
+}
+#endif
+
 static void restore_stdin_termios(void)
 {
     tcsetattr(s_in_fd, TCSAFLUSH, &original_stdin_termios);
@@ -147,6 +165,24 @@ ThreadError otPlatUartEnable(void)
         VerifyOrExit(tcsetattr(s_out_fd, TCSANOW, &termios) == 0, perror("tcsetattr"); error = kThreadError_Error);
     }
 
+#if OPENTHREAD_POSIX_EPOLL
+    // Edge-triggered descriptors are drained until EAGAIN, which needs non-blocking I/O.
+    original_stdin_flags = fcntl(s_in_fd, F_GETFL);
+    VerifyOrExit(original_stdin_flags != -1 && fcntl(s_in_fd, F_SETFL, original_stdin_flags | O_NONBLOCK) == 0,
+                 perror("fcntl"); error = kThreadError_Error);
+    atexit(&restore_stdin_flags);
+
+    original_stdout_flags = fcntl(s_out_fd, F_GETFL);
+    VerifyOrExit(original_stdout_flags != -1 && fcntl(s_out_fd, F_SETFL, original_stdout_flags | O_NONBLOCK) == 0,
+                 perror("fcntl"); error = kThreadError_Error);
+    atexit(&restore_stdout_flags);
+
+    s_in_events = 0;
+    s_out_events = 0;
+    platformEpollAdd(s_in_fd, &s_in_events);
+    platformEpollAdd(s_out_fd, &s_out_events);
+#endif
+
     return error;
 
 exit:
@@ -159,6 +195,11 @@ ThreadError otPlatUartDisable(void)
 {
     ThreadError error = kThreadError_None;
 
+#if OPENTHREAD_POSIX_EPOLL
+    platformEpollRemove(s_in_fd);
+    platformEpollRemove(s_out_fd);
+#endif
+
     close(s_in_fd);
     close(s_out_fd);
 
@@ -211,6 +252,78 @@ void platformUartUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aE
     }
 }
 
+#if OPENTHREAD_POSIX_EPOLL
+
+bool platformUartIsPending(void)
+{
+    return (s_in_events & (EPOLLIN | EPOLLERR | EPOLLHUP)) != 0 ||
+           ((s_write_length > 0) && (s_out_events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0);
+}
+
+void platformUartProcess(void)
+{
+    ssize_t rval;
+    const uint32_t error_flags = EPOLLERR | EPOLLHUP;
+
+    if ((s_in_events & error_flags) != 0)
+    {
+        perror("s_in_fd");
+        exit(EXIT_FAILURE);
+    }
+
+    if ((s_out_events & error_flags) != 0)
+    {
+        perror("s_out_fd");
+        exit(EXIT_FAILURE);
+    }
+
+    while (s_in_events & EPOLLIN)
+    {
+        rval = read(s_in_fd, s_receive_buffer, sizeof(s_receive_buffer));
+
+        if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            s_in_events &= ~(uint32_t)EPOLLIN;
+            break;
+        }
+
+        if (rval <= 0)
+        {
+            perror("read");
+            exit(EXIT_FAILURE);
+        }
+
+        otPlatUartReceived(s_receive_buffer, (uint16_t)rval);
+    }
+
+    if ((s_write_length > 0) && (s_out_events & EPOLLOUT))
+    {
+        rval = write(s_out_fd, s_write_buffer, s_write_length);
+
+        if (rval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            s_out_events &= ~(uint32_t)EPOLLOUT;
+        }
+        else if (rval <= 0)
+        {
+            perror("write");
+            exit(EXIT_FAILURE);
+        }
+        else
+        {
+            s_write_buffer += (uint16_t)rval;
+            s_write_length -= (uint16_t)rval;
+
+            if (s_write_length == 0)
+            {
+                otPlatUartSendDone();
+            }
+        }
+    }
+}
+
+#else // OPENTHREAD_POSIX_EPOLL
+
 void platformUartProcess(void)
 {
     ssize_t rval;
@@ -278,3 +391,5 @@ void platformUartProcess(void)
         }
     }
 }
+
+#endif // OPENTHREAD_POSIX_EPOLL
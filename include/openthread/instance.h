@@ -261,6 +261,16 @@ OTAPI void OTCALL otInstanceFactoryReset(otInstance *aInstance);
  */
 ThreadError otInstanceErasePersistentInfo(otInstance *aInstance);
 
+/**
+ * This function gets the timer scheduler counters.
+ *
+ * @param[in]  aInstance A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the timer scheduler counters.
+ *
+ */
+const otTimerCounters *otInstanceGetTimerCounters(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -223,6 +223,33 @@ int otMessageRead(otMessage *aMessage, uint16_t aOffset, void *aBuf, uint16_t aL
  */
 int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint16_t aLength);
 
+/**
+ * Initialize a cursor to a position within a message.
+ *
+ * A cursor is used with otMessageGetNextSegment() to access the message contents in place, one contiguous message
+ * buffer segment at a time. The cursor is invalidated if the message length is reduced.
+ *
+ * @param[out]  aCursor   A pointer to the cursor to initialize.
+ * @param[in]   aMessage  A pointer to a message buffer.
+ * @param[in]   aOffset   An offset in bytes.
+ *
+ * @sa otMessageGetNextSegment
+ */
+void otMessageCursorInit(otMessageCursor *aCursor, otMessage *aMessage, uint16_t aOffset);
+
+/**
+ * Get the contiguous message bytes at a cursor without copying them, and move the cursor past them.
+ *
+ * @param[inout]  aCursor     A pointer to a message cursor.
+ * @param[in]     aMaxLength  The maximum number of bytes to return.
+ * @param[out]    aData       A pointer to a pointer that is set to the bytes at the cursor.
+ *
+ * @returns The number of contiguous bytes at @p aData, or zero if the cursor is at the end of the message.
+ *
+ * @sa otMessageCursorInit
+ */
+uint16_t otMessageGetNextSegment(otMessageCursor *aCursor, uint16_t aMaxLength, const uint8_t **aData);
+
 /**
  * This structure represents an OpenThread message queue.
  */
@@ -753,6 +753,29 @@ OTAPI otDeviceRole OTCALL otThreadGetDeviceRole(otInstance *aInstance);
  */
 OTAPI ThreadError OTCALL otThreadGetEidCacheEntry(otInstance *aInstance, uint8_t aIndex, otEidCacheEntry *aEntry);
 
+/**
+ * This function gets the EID cache counters.
+ *
+ * @param[in]   aInstance  A pointer to an OpenThread instance.
+ * @param[out]  aCounters  A pointer to where the EID cache counters are placed.
+ *
+ * @retval kThreadError_None            Successfully retrieved the EID cache counters.
+ * @retval kThreadError_InvalidArgs     @p aCounters was NULL.
+ * @retval kThreadError_NotImplemented  The EID cache is not supported by this build.
+ *
+ */
+ThreadError otThreadGetEidCacheCounters(otInstance *aInstance, otEidCacheCounters *aCounters);
+
+/**
+ * This function gets the 6LoWPAN fragment reassembly counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the 6LoWPAN fragment reassembly counters.
+ *
+ */
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance);
+
 /**
  * This function get the Thread Leader Data.
  *
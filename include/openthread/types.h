@@ -353,6 +353,19 @@ typedef struct otMessage
     struct otMessage *mNext;  ///< A pointer to the next Message buffer.
 } otMessage;
 
+/**
+ * This structure represents a position within an OpenThread message.
+ *
+ * The members are private to the implementation and should not be accessed directly.
+ */
+typedef struct otMessageCursor
+{
+    const otMessage *mMessage;       ///< The message.
+    const otMessage *mBuffer;        ///< The message buffer containing the position.
+    uint16_t         mOffset;        ///< The byte offset within the message.
+    uint16_t         mBufferOffset;  ///< The byte offset within the data of @p mBuffer.
+} otMessageCursor;
+
 /**
  * @addtogroup commands  Commands
  *
@@ -852,6 +865,17 @@ typedef struct otEidCacheEntry
     bool            mValid : 1;       ///< Indicates whether or not the cache entry is valid
 } otEidCacheEntry;
 
+/**
+ * This structure represents the EID-to-RLOC cache counters.
+ *
+ */
+typedef struct otEidCacheCounters
+{
+    uint32_t mHits;                   ///< The number of lookups resolved from a cached entry.
+    uint32_t mMisses;                 ///< The number of lookups that required or awaited an Address Query.
+    uint32_t mEvictions;              ///< The number of cached entries evicted to make room for a new EID.
+} otEidCacheCounters;
+
 /**
  * This structure represents the Thread Leader Data.
  *
@@ -903,6 +927,32 @@ typedef struct otMacCounters
     uint32_t mRxErrOther;             ///< The number of received packets with other error.
 } otMacCounters;
 
+/**
+ * This structure represents the 6LoWPAN fragment reassembly counters.
+ */
+typedef struct otReassemblyCounters
+{
+    uint32_t mDatagrams;              ///< The number of datagrams successfully reassembled.
+    uint32_t mOutOfOrder;             ///< The number of fragments accepted ahead of a preceding fragment.
+    uint32_t mDuplicates;             ///< The number of duplicate fragments dropped.
+    uint32_t mFailNoBufs;             ///< The number of fragments dropped due to insufficient message buffers.
+    uint32_t mFailParse;              ///< The number of malformed or inconsistent fragments dropped.
+    uint32_t mFailSecurity;           ///< The number of datagrams rejected by the IPv6 filter.
+    uint32_t mFailEvicted;            ///< The number of partial datagrams evicted to make room for a new one.
+    uint32_t mFailTimeout;            ///< The number of partial datagrams discarded after the reassembly timeout.
+} otReassemblyCounters;
+
+/**
+ * This structure represents the timer scheduler counters.
+ */
+typedef struct otTimerCounters
+{
+    uint32_t mAlarmFired;             ///< The number of platform alarm callbacks processed.
+    uint32_t mTimersFired;            ///< The total number of timers fired.
+    uint32_t mMaxTimersPerAlarm;      ///< The maximum number of timers fired from a single platform alarm callback.
+    uint32_t mFireLimitReached;       ///< The number of times expired timers were deferred due to the per-alarm limit.
+} otTimerCounters;
+
 /**
  * This structure represents the message buffer information.
  */
@@ -924,6 +974,8 @@ typedef struct otBufferInfo
     uint16_t mArpBuffers;             ///< The number of buffers in the ARP send queue.
     uint16_t mCoapClientMessages;     ///< The number of messages in the CoAP client send queue.
     uint16_t mCoapClientBuffers;      ///< The number of buffers in the CoAP client send queue.
+    uint16_t m6loRelayMessages;       ///< The number of messages in the 6LoWPAN mesh relay queue.
+    uint16_t m6loRelayBuffers;        ///< The number of buffers in the 6LoWPAN mesh relay queue.
 } otBufferInfo;
 
 /**
@@ -434,6 +434,7 @@ void Interpreter::ProcessBufferInfo(int argc, char *argv[])
     sServer->OutputFormat("mle: %d %d\r\n", bufferInfo.mMleMessages, bufferInfo.mMleBuffers);
     sServer->OutputFormat("arp: %d %d\r\n", bufferInfo.mArpMessages, bufferInfo.mArpBuffers);
     sServer->OutputFormat("coap: %d %d\r\n", bufferInfo.mCoapClientMessages, bufferInfo.mCoapClientBuffers);
+    sServer->OutputFormat("6lo relay: %d %d\r\n", bufferInfo.m6loRelayMessages, bufferInfo.m6loRelayBuffers);
 
     AppendResult(kThreadError_None);
 }
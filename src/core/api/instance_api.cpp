@@ -214,6 +214,11 @@ exit:
     return error;
 }
 
+const otTimerCounters *otInstanceGetTimerCounters(otInstance *aInstance)
+{
+    return &aInstance->mIp6.mTimerScheduler.GetCounters();
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
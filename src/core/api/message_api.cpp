@@ -108,6 +108,17 @@ int otMessageWrite(otMessage *aMessage, uint16_t aOffset, const void *aBuf, uint
     return message->Write(aOffset, aLength, aBuf);
 }
 
+void otMessageCursorInit(otMessageCursor *aCursor, otMessage *aMessage, uint16_t aOffset)
+{
+    *static_cast<Message::Cursor *>(aCursor) = Message::Cursor(*static_cast<Message *>(aMessage), aOffset);
+}
+
+uint16_t otMessageGetNextSegment(otMessageCursor *aCursor, uint16_t aMaxLength, const uint8_t **aData)
+{
+    const Message *message = static_cast<const Message *>(aCursor->mMessage);
+    return message->GetSegment(*static_cast<Message::Cursor *>(aCursor), aMaxLength, *aData);
+}
+
 void otMessageQueueInit(otMessageQueue *aQueue)
 {
     aQueue->mData = NULL;
@@ -149,6 +160,9 @@ exit:
 
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 {
+    uint16_t messages;
+    uint16_t buffers;
+
     aBufferInfo->mTotalBuffers = OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS;
 
     aBufferInfo->mFreeBuffers = aInstance->mThreadNetif.GetIp6().mMessagePool.GetFreeBufferCount();
@@ -156,9 +170,16 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aInstance->mThreadNetif.GetMeshForwarder().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages,
                                                                       aBufferInfo->m6loSendBuffers);
 
+    aInstance->mThreadNetif.GetMeshForwarder().GetIndirectSendQueue().GetInfo(messages, buffers);
+    aBufferInfo->m6loSendMessages += messages;
+    aBufferInfo->m6loSendBuffers += buffers;
+
     aInstance->mThreadNetif.GetMeshForwarder().GetReassemblyQueue().GetInfo(aBufferInfo->m6loReassemblyMessages,
                                                                             aBufferInfo->m6loReassemblyBuffers);
 
+    aInstance->mThreadNetif.GetMeshForwarder().GetRelayQueue().GetInfo(aBufferInfo->m6loRelayMessages,
+                                                                       aBufferInfo->m6loRelayBuffers);
+
     aInstance->mThreadNetif.GetMeshForwarder().GetResolvingQueue().GetInfo(aBufferInfo->mArpMessages,
                                                                            aBufferInfo->mArpBuffers);
 
@@ -422,6 +422,22 @@ exit:
     return error;
 }
 
+ThreadError otThreadGetEidCacheCounters(otInstance *aInstance, otEidCacheCounters *aCounters)
+{
+    ThreadError error;
+
+    VerifyOrExit(aCounters != NULL, error = kThreadError_InvalidArgs);
+    error = aInstance->mThreadNetif.GetAddressResolver().GetCounters(*aCounters);
+
+exit:
+    return error;
+}
+
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance)
+{
+    return &aInstance->mThreadNetif.GetMeshForwarder().GetReassemblyCounters();
+}
+
 ThreadError otThreadGetLeaderData(otInstance *aInstance, otLeaderData *aLeaderData)
 {
     ThreadError error;
@@ -102,14 +102,7 @@ Message *Server::NewMessage(uint16_t aReserved)
 
 Message *Server::NewMeshCoPMessage(uint16_t aReserved)
 {
-    Message *message = NULL;
-
-    VerifyOrExit((message = NewMessage(aReserved)) != NULL, ;);
-
-    message->SetPriority(kMeshCoPMessagePriority);
-
-exit:
-    return message;
+    return mSocket.NewMessage(aReserved, kMeshCoPMessagePriority);
 }
 
 ThreadError Server::SendMessage(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
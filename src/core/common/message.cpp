@@ -35,18 +35,47 @@
 
 #include <common/code_utils.hpp>
 #include <common/debug.hpp>
+#include <common/encoding.hpp>
 #include <common/logging.hpp>
 #include <common/message.hpp>
 #include <net/ip6.hpp>
 
 namespace Thread {
 
+/**
+ * Buffers held back for each priority level from lower priority messages.
+ *
+ */
+static const uint16_t kReservedBuffers[Message::kNumPriorities] =
+{
+    OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH,
+    OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_MEDIUM,
+    OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_LOW,
+    0,
+};
+
+/**
+ * Upper bound on the buffers held by each priority level.
+ *
+ */
+static const uint16_t kMaxBuffers[Message::kNumPriorities] =
+{
+    OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_HIGH,
+    OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_MEDIUM,
+    OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_LOW,
+    OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_VERY_LOW,
+};
+
 MessagePool::MessagePool(otInstance *aInstance) :
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     mInstance(aInstance),
 #endif
-    mAllQueue()
+    mAllQueue(),
+    mEvictHandler(NULL),
+    mEvictContext(NULL)
 {
+    memset(mCounters, 0, sizeof(mCounters));
+
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     // Initialize Platform buffer pool management.
     otPlatMessagePoolInit(mInstance, kNumBuffers, sizeof(Buffer));
@@ -66,18 +95,20 @@ MessagePool::MessagePool(otInstance *aInstance) :
 #endif
 }
 
-Message *MessagePool::New(uint8_t aType, uint16_t aReserved)
+Message *MessagePool::New(uint8_t aType, uint16_t aReserved, uint8_t aPriority)
 {
     Message *message = NULL;
 
-    VerifyOrExit((message = static_cast<Message *>(NewBuffer())) != NULL, ;);
+    VerifyOrExit(aPriority < Message::kNumPriorities, ;);
+    SuccessOrExit(ReclaimBuffers(1, aPriority));
+    VerifyOrExit((message = static_cast<Message *>(NewBuffer(aPriority))) != NULL, ;);
 
     memset(message, 0, sizeof(*message));
     message->SetMessagePool(this);
     message->SetType(aType);
     message->SetReserved(aReserved);
     message->SetLinkSecurityEnabled(true);
-    message->SetPriority(kDefaultMessagePriority);
+    message->mInfo.mPriority = aPriority;
 
     if (message->SetLength(0) != kThreadError_None)
     {
@@ -97,10 +128,10 @@ ThreadError MessagePool::Free(Message *aMessage)
     assert(aMessage->Next(MessageInfo::kListInterface) == NULL &&
            aMessage->Prev(MessageInfo::kListInterface) == NULL);
 
-    return FreeBuffers(static_cast<Buffer *>(aMessage));
+    return FreeBuffers(static_cast<Buffer *>(aMessage), aMessage->GetPriority());
 }
 
-Buffer *MessagePool::NewBuffer(void)
+Buffer *MessagePool::NewBuffer(uint8_t aPriority)
 {
     Buffer *buffer = NULL;
 
@@ -124,11 +155,15 @@ Buffer *MessagePool::NewBuffer(void)
     {
         otLogInfoMem("No available message buffer");
     }
+    else
+    {
+        mCounters[aPriority].mBuffersInUse++;
+    }
 
     return buffer;
 }
 
-ThreadError MessagePool::FreeBuffers(Buffer *aBuffer)
+ThreadError MessagePool::FreeBuffers(Buffer *aBuffer, uint8_t aPriority)
 {
     Buffer *tmpBuffer;
 
@@ -142,33 +177,94 @@ ThreadError MessagePool::FreeBuffers(Buffer *aBuffer)
         mFreeBuffers = aBuffer;
         mNumFreeBuffers++;
 #endif // OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+        mCounters[aPriority].mBuffersInUse--;
         aBuffer = tmpBuffer;
     }
 
     return kThreadError_None;
 }
 
-ThreadError MessagePool::ReclaimBuffers(int aNumBuffers)
+void MessagePool::MoveBuffers(uint8_t aFromPriority, uint8_t aToPriority, uint8_t aNumBuffers)
 {
-    uint16_t numFreeBuffers;
+    mCounters[aFromPriority].mBuffersInUse -= aNumBuffers;
+    mCounters[aToPriority].mBuffersInUse += aNumBuffers;
+}
 
-#if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-    numFreeBuffers = otPlatMessagePoolNumFreeBuffers(mInstance);
-#else
-    numFreeBuffers = mNumFreeBuffers;
-#endif
+uint16_t MessagePool::GetAvailableBufferCount(uint8_t aPriority) const
+{
+    uint16_t numFreeBuffers = GetFreeBufferCount();
 
-    //First comparison is to get around issues with comparing
-    //signed and unsigned numbers, if aNumBuffers is negative then
-    //the second comparison wont be attempted.
-    if (aNumBuffers < 0 || aNumBuffers <= numFreeBuffers)
+    // Buffers reserved for higher priorities and not yet used by them are off limits.
+    for (uint8_t priority = 0; priority < aPriority; priority++)
     {
-        return kThreadError_None;
+        if (mCounters[priority].mBuffersInUse < kReservedBuffers[priority])
+        {
+            uint16_t reserved = kReservedBuffers[priority] - mCounters[priority].mBuffersInUse;
+            numFreeBuffers = (numFreeBuffers > reserved) ? numFreeBuffers - reserved : 0;
+        }
     }
-    else
+
+    return numFreeBuffers;
+}
+
+bool MessagePool::EvictMessage(uint8_t aPriority)
+{
+    bool evicted = false;
+
+    VerifyOrExit(mEvictHandler != NULL, ;);
+
+    // Lowest priority first, and the oldest message within a priority level.
+    for (uint8_t priority = Message::kNumPriorities - 1; priority > aPriority; priority--)
+    {
+        if (mCounters[priority].mBuffersInUse == 0)
+        {
+            continue;
+        }
+
+        for (Iterator it = GetAllMessagesHead(); !it.HasEnded(); it.GoToNext())
+        {
+            Message *message = it.GetMessage();
+
+            if (message->GetPriority() != priority)
+            {
+                continue;
+            }
+
+            if (mEvictHandler(mEvictContext, *message))
+            {
+                otLogInfoMem("Evicted priority %d message for priority %d request", priority, aPriority);
+                mCounters[priority].mEvicted++;
+                ExitNow(evicted = true);
+            }
+        }
+    }
+
+exit:
+    return evicted;
+}
+
+ThreadError MessagePool::ReclaimBuffers(int aNumBuffers, uint8_t aPriority)
+{
+    ThreadError error = kThreadError_None;
+
+    VerifyOrExit(aNumBuffers > 0, ;);
+
+    VerifyOrExit(mCounters[aPriority].mBuffersInUse + aNumBuffers <= kMaxBuffers[aPriority],
+                 error = kThreadError_NoBufs);
+
+    while (aNumBuffers > GetAvailableBufferCount(aPriority))
     {
-        return kThreadError_NoBufs;
+        VerifyOrExit(EvictMessage(aPriority), error = kThreadError_NoBufs);
     }
+
+exit:
+
+    if (error != kThreadError_None)
+    {
+        mCounters[aPriority].mAllocFailures++;
+    }
+
+    return error;
 }
 
 Message *MessagePool::Iterator::Next(void) const
@@ -241,7 +337,7 @@ ThreadError Message::ResizeMessage(uint16_t aLength)
     {
         if (curBuffer->GetNextBuffer() == NULL)
         {
-            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer());
+            curBuffer->SetNextBuffer(GetMessagePool()->NewBuffer(GetPriority()));
             VerifyOrExit(curBuffer->GetNextBuffer() != NULL, error = kThreadError_NoBufs);
         }
 
@@ -254,12 +350,32 @@ ThreadError Message::ResizeMessage(uint16_t aLength)
     curBuffer = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(NULL);
 
-    GetMessagePool()->FreeBuffers(curBuffer);
+    GetMessagePool()->FreeBuffers(curBuffer, GetPriority());
 
 exit:
     return error;
 }
 
+Message::Cursor::Cursor(const Message &aMessage, uint16_t aOffset)
+{
+    mMessage = &aMessage;
+    mBuffer = &aMessage;
+    mOffset = aOffset;
+    mBufferOffset = aMessage.GetReserved() + aOffset;
+}
+
+void Message::Cursor::SetOffset(uint16_t aOffset)
+{
+    if (aOffset < mOffset)
+    {
+        mBuffer = mMessage;
+        mOffset = 0;
+        mBufferOffset = GetMessage()->GetReserved();
+    }
+
+    MoveOffset(aOffset - mOffset);
+}
+
 ThreadError Message::Free(void)
 {
     return GetMessagePool()->Free(this);
@@ -311,7 +427,7 @@ ThreadError Message::SetLength(uint16_t aLength)
         bufs -= (((totalLengthCurrent - kHeadBufferDataSize) - 1) / kBufferDataSize) + 1;
     }
 
-    SuccessOrExit(error = GetMessagePool()->ReclaimBuffers(bufs));
+    SuccessOrExit(error = GetMessagePool()->ReclaimBuffers(bufs, GetPriority()));
 
     SuccessOrExit(error = ResizeMessage(totalLengthRequest));
     mInfo.mLength = aLength;
@@ -410,9 +526,11 @@ ThreadError Message::SetPriority(uint8_t aPriority)
     PriorityQueue *priorityQueue = NULL;
 
     VerifyOrExit(aPriority < kNumPriorities, error = kThreadError_InvalidArgs);
+    VerifyOrExit(mInfo.mPriority != aPriority, ;);
+
+    GetMessagePool()->MoveBuffers(mInfo.mPriority, aPriority, GetBufferCount());
 
     VerifyOrExit(IsInAQueue(), mInfo.mPriority = aPriority);
-    VerifyOrExit(mInfo.mPriority != aPriority, ;);
 
     if (mInfo.mInPriorityQ)
     {
@@ -455,14 +573,37 @@ exit:
     return error;
 }
 
+ThreadError Message::Append(Cursor &aCursor, const void *aBuf, uint16_t aLength)
+{
+    ThreadError error = kThreadError_None;
+    int bytesWritten;
+
+    assert(aCursor.GetOffset() == GetLength());
+
+    SuccessOrExit(error = SetLength(GetLength() + aLength));
+    bytesWritten = Write(aCursor, aLength, aBuf);
+
+    assert(bytesWritten == (int)aLength);
+    (void)bytesWritten;
+
+exit:
+    return error;
+}
+
 ThreadError Message::Prepend(const void *aBuf, uint16_t aLength)
 {
     ThreadError error = kThreadError_None;
     Buffer *newBuffer = NULL;
 
+    if (aLength > GetReserved())
+    {
+        SuccessOrExit(error = GetMessagePool()->ReclaimBuffers((aLength - GetReserved() - 1) / kBufferDataSize + 1,
+                                                               GetPriority()));
+    }
+
     while (aLength > GetReserved())
     {
-        VerifyOrExit((newBuffer = GetMessagePool()->NewBuffer()) != NULL, error = kThreadError_NoBufs);
+        VerifyOrExit((newBuffer = GetMessagePool()->NewBuffer(GetPriority())) != NULL, error = kThreadError_NoBufs);
 
         newBuffer->SetNextBuffer(GetNextBuffer());
         SetNextBuffer(newBuffer);
@@ -511,76 +652,42 @@ ThreadError Message::RemoveHeader(uint16_t aLength)
 
 uint16_t Message::Read(uint16_t aOffset, uint16_t aLength, void *aBuf) const
 {
-    Buffer *curBuffer;
+    Cursor cursor(*this, aOffset);
+
+    return Read(cursor, aLength, aBuf);
+}
+
+uint16_t Message::Read(Cursor &aCursor, uint16_t aLength, void *aBuf) const
+{
     uint16_t bytesCopied = 0;
     uint16_t bytesToCopy;
+    const uint8_t *data;
 
-    if (aOffset >= GetLength())
+    if (aCursor.GetOffset() >= GetLength())
     {
         ExitNow();
     }
 
-    if (aOffset + aLength >= GetLength())
-    {
-        aLength = GetLength() - aOffset;
-    }
-
-    aOffset += GetReserved();
-
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
-    {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
-
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(aBuf, GetFirstData() + aOffset, bytesToCopy);
-
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
-
-        aOffset = 0;
-    }
-    else
-    {
-        aOffset -= kHeadBufferDataSize;
-    }
-
-    // advance to offset
-    curBuffer = GetNextBuffer();
-
-    while (aOffset >= kBufferDataSize)
+    if (aCursor.GetOffset() + aLength >= GetLength())
     {
-        assert(curBuffer != NULL);
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
+        aLength = GetLength() - aCursor.GetOffset();
     }
 
-    // begin copy
     while (aLength > 0)
     {
-        assert(curBuffer != NULL);
-
-        bytesToCopy = kBufferDataSize - aOffset;
+        data = GetCursorData(aCursor, bytesToCopy);
 
         if (bytesToCopy > aLength)
         {
             bytesToCopy = aLength;
         }
 
-        memcpy(aBuf, curBuffer->GetData() + aOffset, bytesToCopy);
+        memcpy(aBuf, data, bytesToCopy);
 
+        aCursor.MoveOffset(bytesToCopy);
         aLength -= bytesToCopy;
         bytesCopied += bytesToCopy;
         aBuf = static_cast<uint8_t *>(aBuf) + bytesToCopy;
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset = 0;
     }
 
 exit:
@@ -589,97 +696,114 @@ exit:
 
 int Message::Write(uint16_t aOffset, uint16_t aLength, const void *aBuf)
 {
-    Buffer *curBuffer;
+    Cursor cursor(*this, aOffset);
+
+    return Write(cursor, aLength, aBuf);
+}
+
+int Message::Write(Cursor &aCursor, uint16_t aLength, const void *aBuf)
+{
     uint16_t bytesCopied = 0;
     uint16_t bytesToCopy;
+    uint8_t *data;
 
-    assert(aOffset + aLength <= GetLength());
+    assert(aCursor.GetOffset() + aLength <= GetLength());
 
-    if (aOffset + aLength >= GetLength())
+    if (aCursor.GetOffset() + aLength >= GetLength())
     {
-        aLength = GetLength() - aOffset;
+        aLength = GetLength() - aCursor.GetOffset();
     }
 
-    aOffset += GetReserved();
-
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    while (aLength > 0)
     {
-        bytesToCopy = kHeadBufferDataSize - aOffset;
+        // The cursor is on this message, so the buffer it refers to is writable.
+        data = const_cast<uint8_t *>(GetCursorData(aCursor, bytesToCopy));
 
         if (bytesToCopy > aLength)
         {
             bytesToCopy = aLength;
         }
 
-        memcpy(GetFirstData() + aOffset, aBuf, bytesToCopy);
+        memcpy(data, aBuf, bytesToCopy);
 
+        aCursor.MoveOffset(bytesToCopy);
         aLength -= bytesToCopy;
         bytesCopied += bytesToCopy;
         aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
-
-        aOffset = 0;
-    }
-    else
-    {
-        aOffset -= kHeadBufferDataSize;
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    return bytesCopied;
+}
 
-    while (aOffset >= kBufferDataSize)
-    {
-        assert(curBuffer != NULL);
+uint16_t Message::GetSegment(Cursor &aCursor, uint16_t aMaxLength, const uint8_t *&aData) const
+{
+    uint16_t length = 0;
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
+    VerifyOrExit(aCursor.GetOffset() < GetLength(), ;);
+
+    aData = GetCursorData(aCursor, length);
+
+    if (length > GetLength() - aCursor.GetOffset())
+    {
+        length = GetLength() - aCursor.GetOffset();
     }
 
-    // begin copy
-    while (aLength > 0)
+    if (length > aMaxLength)
     {
-        assert(curBuffer != NULL);
+        length = aMaxLength;
+    }
 
-        bytesToCopy = kBufferDataSize - aOffset;
+    aCursor.MoveOffset(length);
 
-        if (bytesToCopy > aLength)
-        {
-            bytesToCopy = aLength;
-        }
-
-        memcpy(curBuffer->GetData() + aOffset, aBuf, bytesToCopy);
+exit:
+    return length;
+}
 
-        aLength -= bytesToCopy;
-        bytesCopied += bytesToCopy;
-        aBuf = static_cast<const uint8_t *>(aBuf) + bytesToCopy;
+uint16_t Message::GetSegment(Cursor &aCursor, uint16_t aMaxLength, uint8_t *&aData)
+{
+    const uint8_t *data = NULL;
+    uint16_t length = static_cast<const Message *>(this)->GetSegment(aCursor, aMaxLength, data);
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset = 0;
-    }
+    aData = const_cast<uint8_t *>(data);
 
-    return bytesCopied;
+    return length;
 }
 
 int Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
 {
+    Cursor source(*this, aSourceOffset);
+    Cursor destination(aMessage, aDestinationOffset);
     uint16_t bytesCopied = 0;
     uint16_t bytesToCopy;
-    uint8_t buf[16];
+    const uint8_t *data;
+
+    if (aSourceOffset >= GetLength())
+    {
+        ExitNow();
+    }
+
+    if (aSourceOffset + aLength >= GetLength())
+    {
+        aLength = GetLength() - aSourceOffset;
+    }
 
     while (aLength > 0)
     {
-        bytesToCopy = (aLength < sizeof(buf)) ? aLength : sizeof(buf);
+        data = GetCursorData(source, bytesToCopy);
 
-        Read(aSourceOffset, bytesToCopy, buf);
-        aMessage.Write(aDestinationOffset, bytesToCopy, buf);
+        if (bytesToCopy > aLength)
+        {
+            bytesToCopy = aLength;
+        }
+
+        aMessage.Write(destination, bytesToCopy, data);
 
-        aSourceOffset += bytesToCopy;
-        aDestinationOffset += bytesToCopy;
+        source.MoveOffset(bytesToCopy);
         aLength -= bytesToCopy;
         bytesCopied += bytesToCopy;
     }
 
+exit:
     return bytesCopied;
 }
 
@@ -688,7 +812,7 @@ Message *Message::Clone(uint16_t aLength) const
     ThreadError error = kThreadError_None;
     Message *messageCopy;
 
-    VerifyOrExit((messageCopy = GetMessagePool()->New(GetType(), GetReserved())) != NULL, error = kThreadError_NoBufs);
+    VerifyOrExit((messageCopy = GetMessagePool()->New(GetType(), GetReserved(), GetPriority())) != NULL, error = kThreadError_NoBufs);
     SuccessOrExit(error = messageCopy->SetLength(aLength));
     CopyTo(0, 0, aLength, *messageCopy);
 
@@ -696,7 +820,6 @@ Message *Message::Clone(uint16_t aLength) const
     messageCopy->SetOffset(GetOffset());
     messageCopy->SetInterfaceId(GetInterfaceId());
     messageCopy->SetSubType(GetSubType());
-    messageCopy->SetPriority(GetPriority());
     messageCopy->SetLinkSecurityEnabled(IsLinkSecurityEnabled());
 
 exit:
@@ -720,6 +843,46 @@ void Message::SetDatagramTag(uint16_t aTag)
     mInfo.mDatagramTag = aTag;
 }
 
+uint16_t Message::GetMeshNextHop(void) const
+{
+    return mInfo.mMeshNextHop;
+}
+
+void Message::SetMeshNextHop(uint16_t aNextHop)
+{
+    mInfo.mMeshNextHop = aNextHop;
+}
+
+uint16_t Message::GetSendSequence(void) const
+{
+    return mInfo.mSendSequence;
+}
+
+void Message::SetSendSequence(uint16_t aSequence)
+{
+    mInfo.mSendSequence = aSequence;
+}
+
+Message *Message::GetNextIndirect(void) const
+{
+    return mInfo.mNextIndirect;
+}
+
+void Message::SetNextIndirect(Message *aMessage)
+{
+    mInfo.mNextIndirect = aMessage;
+}
+
+bool Message::IsBroadcastIndirect(void) const
+{
+    return mInfo.mBroadcastTx;
+}
+
+void Message::SetBroadcastIndirect(bool aBroadcast)
+{
+    mInfo.mBroadcastTx = aBroadcast;
+}
+
 bool Message::GetChildMask(uint8_t aChildIndex) const
 {
     assert(aChildIndex < sizeof(mInfo.mChildMask) * 8);
@@ -821,69 +984,64 @@ void Message::SetLinkSecurityEnabled(bool aLinkSecurityEnabled)
 
 uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aOffset, uint16_t aLength) const
 {
-    Buffer *curBuffer;
+    Cursor cursor(*this, aOffset);
     uint16_t bytesCovered = 0;
     uint16_t bytesToCover;
+    const uint8_t *data;
 
     assert(aOffset + aLength <= GetLength());
 
-    aOffset += GetReserved();
-
-    // special case first buffer
-    if (aOffset < kHeadBufferDataSize)
+    while (aLength > 0)
     {
-        bytesToCover = kHeadBufferDataSize - aOffset;
+        data = GetCursorData(cursor, bytesToCover);
 
         if (bytesToCover > aLength)
         {
             bytesToCover = aLength;
         }
 
-        aChecksum = Ip6::Ip6::UpdateChecksum(aChecksum, GetFirstData() + aOffset, bytesToCover);
+        aChecksum = UpdateChecksum(aChecksum, bytesCovered, data, bytesToCover);
 
+        cursor.MoveOffset(bytesToCover);
         aLength -= bytesToCover;
         bytesCovered += bytesToCover;
-
-        aOffset = 0;
-    }
-    else
-    {
-        aOffset -= kHeadBufferDataSize;
     }
 
-    // advance to offset
-    curBuffer = GetNextBuffer();
+    return aChecksum;
+}
 
-    while (aOffset >= kBufferDataSize)
+uint16_t Message::UpdateChecksum(uint16_t aChecksum, uint16_t aBytesCovered, const uint8_t *aData, uint16_t aLength)
+{
+    // A segment that starts at an odd position within the checksummed range has its bytes in swapped lanes.
+    // Byte-swapping the checksum before and after summing the segment keeps the lanes aligned across buffers.
+    if (aBytesCovered & 1)
     {
-        assert(curBuffer != NULL);
-
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset -= kBufferDataSize;
+        aChecksum = Encoding::Swap16(Ip6::Ip6::UpdateChecksum(Encoding::Swap16(aChecksum), aData, aLength));
     }
-
-    // begin copy
-    while (aLength > 0)
+    else
     {
-        assert(curBuffer != NULL);
-
-        bytesToCover = kBufferDataSize - aOffset;
+        aChecksum = Ip6::Ip6::UpdateChecksum(aChecksum, aData, aLength);
+    }
 
-        if (bytesToCover > aLength)
-        {
-            bytesToCover = aLength;
-        }
+    return aChecksum;
+}
 
-        aChecksum = Ip6::Ip6::UpdateChecksum(aChecksum, curBuffer->GetData() + aOffset, bytesToCover);
+const uint8_t *Message::GetCursorData(Cursor &aCursor, uint16_t &aLength) const
+{
+    uint16_t bufferDataSize = (aCursor.GetBuffer() == this) ? kHeadBufferDataSize : kBufferDataSize;
 
-        aLength -= bytesToCover;
-        bytesCovered += bytesToCover;
+    assert(aCursor.GetMessage() == this);
 
-        curBuffer = curBuffer->GetNextBuffer();
-        aOffset = 0;
+    while (aCursor.mBufferOffset >= bufferDataSize && aCursor.GetBuffer()->GetNextBuffer() != NULL)
+    {
+        aCursor.mBuffer = aCursor.GetBuffer()->GetNextBuffer();
+        aCursor.mBufferOffset -= bufferDataSize;
+        bufferDataSize = kBufferDataSize;
     }
 
-    return aChecksum;
+    aLength = (aCursor.mBufferOffset < bufferDataSize) ? bufferDataSize - aCursor.mBufferOffset : 0;
+
+    return ((aCursor.GetBuffer() == this) ? GetFirstData() : aCursor.GetBuffer()->GetData()) + aCursor.mBufferOffset;
 }
 
 uint16_t Message::GetReserved(void) const
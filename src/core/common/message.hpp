@@ -98,7 +98,13 @@ struct MessageInfo
     uint16_t         mReserved;          ///< Number of header bytes reserved for the message.
     uint16_t         mLength;            ///< Number of bytes within the message.
     uint16_t         mOffset;            ///< A byte offset within the message.
-    uint16_t         mDatagramTag;       ///< The datagram tag used for 6LoWPAN fragmentation.
+    union
+    {
+        uint16_t     mDatagramTag;       ///< The datagram tag used for 6LoWPAN fragmentation.
+        uint16_t     mMeshNextHop;       ///< The next hop RLOC16 used for relayed 6LoWPAN mesh frames.
+    };
+    uint16_t         mSendSequence;      ///< The order in which the message was queued for transmission.
+    Message         *mNextIndirect;      ///< The next message in the same indirect transmission list.
 
     uint8_t          mChildMask[8];      ///< A bit-vector to indicate which sleepy children need to receive this.
     uint8_t          mTimeout;           ///< Seconds remaining before dropping the message.
@@ -115,6 +121,7 @@ struct MessageInfo
     bool             mLinkSecurity : 1;  ///< Indicates whether or not link security is enabled.
     uint8_t          mPriority : 2;      ///< Identifies the message priority level (lower value is higher priority).
     bool             mInPriorityQ : 1;   ///< Indicates whether the message is queued in normal or priority queue.
+    bool             mBroadcastTx : 1;   ///< Indicates whether the message is forwarded to all sleepy children.
 };
 
 /**
@@ -124,6 +131,7 @@ struct MessageInfo
 class Buffer : public ::otMessage
 {
     friend class Message;
+    friend class MessagePool;
 
 public:
     /**
@@ -229,6 +237,59 @@ public:
         kNumPriorities      = 4,    ///< Number of priority levels.
     };
 
+    /**
+     * This class represents a position within a message that remembers its buffer.
+     *
+     * Sequential reads and writes through a cursor continue from the buffer where the previous access ended
+     * instead of walking the buffer chain from the head. A cursor is invalidated by `Prepend()`,
+     * `RemoveHeader()` and by shrinking the message.
+     *
+     */
+    class Cursor: public ::otMessageCursor
+    {
+        friend class Message;
+
+    public:
+        /**
+         * This constructor initializes the cursor.
+         *
+         * @param[in]  aMessage  A reference to the message.
+         * @param[in]  aOffset   Byte offset within the message.
+         *
+         */
+        Cursor(const Message &aMessage, uint16_t aOffset);
+
+        /**
+         * This method returns the byte offset of the cursor within the message.
+         *
+         * @returns The byte offset within the message.
+         *
+         */
+        uint16_t GetOffset(void) const { return mOffset; }
+
+        /**
+         * This method sets the byte offset of the cursor within the message.
+         *
+         * Moving forward continues from the current buffer; moving backward restarts from the head buffer.
+         *
+         * @param[in]  aOffset  Byte offset within the message.
+         *
+         */
+        void SetOffset(uint16_t aOffset);
+
+        /**
+         * This method moves the cursor forward.
+         *
+         * @param[in]  aLength  The number of bytes to move forward.
+         *
+         */
+        void MoveOffset(uint16_t aLength) { mOffset += aLength; mBufferOffset += aLength; }
+
+    private:
+        const Message *GetMessage(void) const { return static_cast<const Message *>(mMessage); }
+        const Buffer *GetBuffer(void) const { return static_cast<const Buffer *>(mBuffer); }
+    };
+
     /**
      * This method frees this message buffer.
      *
@@ -427,6 +488,69 @@ public:
      */
     int CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const;
 
+    /**
+     * This method appends bytes to the end of the message at a cursor.
+     *
+     * On success, this method grows the message by @p aLength bytes and moves @p aCursor past them.
+     *
+     * @param[inout]  aCursor  A cursor on this message at the end of the message.
+     * @param[in]     aBuf     A pointer to a data buffer.
+     * @param[in]     aLength  The number of bytes to append.
+     *
+     * @retval kThreadError_None    Successfully appended the bytes.
+     * @retval kThreadError_NoBufs  Insufficient available buffers to grow the message.
+     *
+     */
+    ThreadError Append(Cursor &aCursor, const void *aBuf, uint16_t aLength);
+
+    /**
+     * This method reads bytes from the message at a cursor and moves the cursor past them.
+     *
+     * @param[inout]  aCursor  A cursor on this message where to begin reading.
+     * @param[in]     aLength  Number of bytes to read.
+     * @param[in]     aBuf     A pointer to a data buffer.
+     *
+     * @returns The number of bytes read.
+     *
+     */
+    uint16_t Read(Cursor &aCursor, uint16_t aLength, void *aBuf) const;
+
+    /**
+     * This method writes bytes to the message at a cursor and moves the cursor past them.
+     *
+     * @param[inout]  aCursor  A cursor on this message where to begin writing.
+     * @param[in]     aLength  Number of bytes to write.
+     * @param[in]     aBuf     A pointer to a data buffer.
+     *
+     * @returns The number of bytes written.
+     *
+     */
+    int Write(Cursor &aCursor, uint16_t aLength, const void *aBuf);
+
+    /**
+     * This method returns the contiguous bytes at a cursor and moves the cursor past them.
+     *
+     * @param[inout]  aCursor     A cursor on this message.
+     * @param[in]     aMaxLength  The maximum number of bytes to return.
+     * @param[out]    aData       A pointer to the bytes at the cursor.
+     *
+     * @returns The number of contiguous bytes at @p aData, or zero if the cursor is at the end of the message.
+     *
+     */
+    uint16_t GetSegment(Cursor &aCursor, uint16_t aMaxLength, const uint8_t *&aData) const;
+
+    /**
+     * This method returns the contiguous bytes at a cursor for in-place modification and moves the cursor past them.
+     *
+     * @param[inout]  aCursor     A cursor on this message.
+     * @param[in]     aMaxLength  The maximum number of bytes to return.
+     * @param[out]    aData       A pointer to the bytes at the cursor.
+     *
+     * @returns The number of contiguous bytes at @p aData, or zero if the cursor is at the end of the message.
+     *
+     */
+    uint16_t GetSegment(Cursor &aCursor, uint16_t aMaxLength, uint8_t *&aData);
+
     /**
      * This method creates a copy of the current Message. It allocates the new one
      * from the same Message Poll as the original Message and copies @p aLength octets of a payload.
@@ -464,6 +588,71 @@ public:
      */
     void SetDatagramTag(uint16_t aTag);
 
+    /**
+     * This method returns the next hop RLOC16 for a relayed 6LoWPAN mesh frame.
+     *
+     * @returns The next hop RLOC16.
+     *
+     */
+    uint16_t GetMeshNextHop(void) const;
+
+    /**
+     * This method sets the next hop RLOC16 for a relayed 6LoWPAN mesh frame.
+     *
+     * @param[in]  aNextHop  The next hop RLOC16.
+     *
+     */
+    void SetMeshNextHop(uint16_t aNextHop);
+
+    /**
+     * This method returns the sequence number assigned when the message was queued for transmission.
+     *
+     * @returns The send sequence number.
+     *
+     */
+    uint16_t GetSendSequence(void) const;
+
+    /**
+     * This method sets the sequence number assigned when the message is queued for transmission.
+     *
+     * @param[in]  aSequence  The send sequence number.
+     *
+     */
+    void SetSendSequence(uint16_t aSequence);
+
+    /**
+     * This method returns the next message in the same indirect transmission list.
+     *
+     * @returns A pointer to the next message, or NULL if this is the last one.
+     *
+     */
+    Message *GetNextIndirect(void) const;
+
+    /**
+     * This method sets the next message in the same indirect transmission list.
+     *
+     * @param[in]  aMessage  A pointer to the next message, or NULL if this is the last one.
+     *
+     */
+    void SetNextIndirect(Message *aMessage);
+
+    /**
+     * This method returns whether or not the message is forwarded to all sleepy children.
+     *
+     * @retval TRUE   If the message is forwarded to all sleepy children.
+     * @retval FALSE  If the message is forwarded to a single sleepy child, or to none.
+     *
+     */
+    bool IsBroadcastIndirect(void) const;
+
+    /**
+     * This method sets whether or not the message is forwarded to all sleepy children.
+     *
+     * @param[in]  aBroadcast  TRUE if the message is forwarded to all sleepy children, FALSE otherwise.
+     *
+     */
+    void SetBroadcastIndirect(bool aBroadcast);
+
     /**
      * This method returns whether or not the message forwarding is scheduled for the child.
      *
@@ -630,6 +819,14 @@ public:
      */
     MessageQueue *GetMessageQueue(void) const { return (!mInfo.mInPriorityQ) ? mInfo.mMessageQueue : NULL; }
 
+    /**
+     * This method returns a pointer to the priority message queue (if any) where this message is queued.
+     *
+     * @returns A pointer to the priority queue or NULL if not in any priority queue.
+     *
+     */
+    PriorityQueue *GetPriorityQueue(void) const { return (mInfo.mInPriorityQ) ? mInfo.mPriorityQueue : NULL; }
+
 private:
 
     /**
@@ -657,20 +854,38 @@ private:
     bool IsInAQueue(void) const { return (mInfo.mMessageQueue != NULL); }
 
     /**
-     * This method sets the message queue information for the message.
+     * This static method updates a checksum with one buffer segment of a checksummed range.
      *
-     * @param[in]  aMessageQueue  A pointer to the message queue where this message is queued.
+     * @param[in]  aChecksum      The checksum value to update.
+     * @param[in]  aBytesCovered  The number of bytes of the range already covered by @p aChecksum.
+     * @param[in]  aData          A pointer to the segment.
+     * @param[in]  aLength        The number of bytes in the segment.
+     *
+     * @returns The updated checksum value.
      *
      */
-    void SetMessageQueue(MessageQueue *aMessageQueue);
+    static uint16_t UpdateChecksum(uint16_t aChecksum, uint16_t aBytesCovered, const uint8_t *aData,
+                                   uint16_t aLength);
 
     /**
-     * This method returns a pointer to the priority message queue (if any) where this message is queued.
+     * This method returns the contiguous bytes at a cursor, moving the cursor into the next buffer if needed.
      *
-     * @returns A pointer to the priority queue or NULL if not in any priority queue.
+     * @param[inout]  aCursor  A cursor on this message.
+     * @param[out]    aLength  The number of contiguous bytes at the cursor, including any bytes past the end of
+     *                         the message.
+     *
+     * @returns A pointer to the byte at the cursor.
      *
      */
-    PriorityQueue *GetPriorityQueue(void) const { return (mInfo.mInPriorityQ) ? mInfo.mPriorityQueue : NULL; }
+    const uint8_t *GetCursorData(Cursor &aCursor, uint16_t &aLength) const;
+
+    /**
+     * This method sets the message queue information for the message.
+     *
+     * @param[in]  aMessageQueue  A pointer to the message queue where this message is queued.
+     *
+     */
+    void SetMessageQueue(MessageQueue *aMessageQueue);
 
     /**
      * This method sets the message queue information for the message.
@@ -1055,6 +1270,32 @@ public:
      */
     MessagePool(otInstance *aInstance);
 
+    /**
+     * This type represents the buffer accounting of one message priority level.
+     *
+     */
+    struct Counters
+    {
+        uint16_t mBuffersInUse;     ///< Number of buffers held by messages of this priority.
+        uint32_t mAllocFailures;    ///< Number of buffer requests denied for this priority.
+        uint32_t mEvicted;          ///< Number of queued messages of this priority evicted to make room.
+    };
+
+    /**
+     * This function pointer is called when a higher priority request needs buffers held by a queued message.
+     *
+     * The handler must dequeue and free @p aMessage if it can do so safely, e.g. the message is not being
+     * transmitted.
+     *
+     * @param[in]  aContext  A pointer to arbitrary context information.
+     * @param[in]  aMessage  A reference to the queued message selected for eviction.
+     *
+     * @retval TRUE   The message was freed.
+     * @retval FALSE  The message may not be evicted.
+     *
+     */
+    typedef bool (*EvictHandler)(void *aContext, Message &aMessage);
+
     /**
      * This method is used to obtain a new message. The default priority `kDefaultMessagePriority`
      * is assigned to the message.
@@ -1065,7 +1306,21 @@ public:
      * @returns A pointer to the message or NULL if no message buffers are available.
      *
      */
-    Message *New(uint8_t aType, uint16_t aReserveHeader);
+    Message *New(uint8_t aType, uint16_t aReserveHeader) { return New(aType, aReserveHeader, kDefaultMessagePriority); }
+
+    /**
+     * This method is used to obtain a new message with a given priority.
+     *
+     * The first buffer is charged to @p aPriority, so the priority's reserved buffers are available to it.
+     *
+     * @param[in]  aType           The message type.
+     * @param[in]  aReserveHeader  The number of header bytes to reserve.
+     * @param[in]  aPriority       The message priority level.
+     *
+     * @returns A pointer to the message or NULL if no message buffers are available.
+     *
+     */
+    Message *New(uint8_t aType, uint16_t aReserveHeader, uint8_t aPriority);
 
     /**
      * This method is used to free a message and return all message buffers to the buffer pool.
@@ -1108,15 +1363,39 @@ public:
     uint16_t GetFreeBufferCount(void) const { return mNumFreeBuffers; }
 #endif
 
+    /**
+     * This method returns the buffer accounting of a priority level.
+     *
+     * @param[in]  aPriority  The message priority level.
+     *
+     * @returns A reference to the counters of @p aPriority.
+     *
+     */
+    const Counters &GetCounters(uint8_t aPriority) const { return mCounters[aPriority]; }
+
+    /**
+     * This method registers the handler that frees queued messages when buffers must be reclaimed.
+     *
+     * Without a handler, requests that exceed the available buffers fail without evicting anything.
+     *
+     * @param[in]  aHandler  A pointer to the evict handler, or NULL to disable eviction.
+     * @param[in]  aContext  A pointer to arbitrary context information.
+     *
+     */
+    void SetEvictHandler(EvictHandler aHandler, void *aContext) { mEvictHandler = aHandler; mEvictContext = aContext; }
+
 private:
     enum
     {
         kDefaultMessagePriority = Message::kPriorityLow,
     };
 
-    Buffer *NewBuffer(void);
-    ThreadError FreeBuffers(Buffer *aBuffer);
-    ThreadError ReclaimBuffers(int aNumBuffers);
+    Buffer *NewBuffer(uint8_t aPriority);
+    ThreadError FreeBuffers(Buffer *aBuffer, uint8_t aPriority);
+    ThreadError ReclaimBuffers(int aNumBuffers, uint8_t aPriority);
+    uint16_t GetAvailableBufferCount(uint8_t aPriority) const;
+    bool EvictMessage(uint8_t aPriority);
+    void MoveBuffers(uint8_t aFromPriority, uint8_t aToPriority, uint8_t aNumBuffers);
     PriorityQueue *GetAllMessagesQueue(void) { return &mAllQueue; }
 
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT == 0
@@ -1127,6 +1406,9 @@ private:
     otInstance *mInstance;
 #endif
     PriorityQueue mAllQueue;
+    Counters      mCounters[Message::kNumPriorities];
+    EvictHandler  mEvictHandler;
+    void         *mEvictContext;
 };
 
 /**
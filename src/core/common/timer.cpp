@@ -33,8 +33,11 @@
 
 #define WPP_NAME "timer.tmh"
 
+#include <string.h>
+
 #include "openthread/platform/alarm.h"
 
+#include <openthread-core-config.h>
 #include <common/code_utils.hpp>
 #include <common/timer.hpp>
 #include <common/debug.hpp>
@@ -45,96 +48,175 @@
 namespace Thread {
 
 TimerScheduler::TimerScheduler(void):
-    mHead(NULL)
+    mHead(NULL),
+    mLastNow(0),
+    mNowWraps(1),
+    mFiring(false)
 {
+    memset(&mCounters, 0, sizeof(mCounters));
 }
 
 void TimerScheduler::Add(Timer &aTimer)
 {
-    Remove(aTimer);
+    uint32_t now = otPlatAlarmGetNow();
+    bool wasHead = (mHead == &aTimer);
 
-    if (mHead == NULL)
+    Unlink(aTimer);
+
+    aTimer.mFireTime = ExtendTime(now) - (now - aTimer.mT0) + aTimer.mDt;
+    mHead = Meld(mHead, &aTimer);
+
+    if (wasHead || mHead == &aTimer)
     {
-        mHead = &aTimer;
-        SetAlarm();
+        SetAlarm(now);
     }
-    else
+}
+
+void TimerScheduler::Remove(Timer &aTimer)
+{
+    bool wasHead = (mHead == &aTimer);
+
+    Unlink(aTimer);
+
+    if (wasHead)
     {
-        Timer *prev = NULL;
-        Timer *cur;
+        SetAlarm(otPlatAlarmGetNow());
+    }
+}
+
+bool TimerScheduler::IsAdded(const Timer &aTimer) const
+{
+    return (mHead == &aTimer) || (aTimer.mPrev != NULL);
+}
+
+void TimerScheduler::Unlink(Timer &aTimer)
+{
+    Timer *subheap;
+
+    VerifyOrExit(IsAdded(aTimer), ;);
+
+    subheap = MergePairs(aTimer.mChild);
 
-        for (cur = mHead; cur; cur = cur->mNext)
+    if (mHead == &aTimer)
+    {
+        mHead = subheap;
+    }
+    else
+    {
+        if (aTimer.mPrev->mChild == &aTimer)
+        {
+            aTimer.mPrev->mChild = aTimer.mSibling;
+        }
+        else
         {
-            if (TimerCompare(aTimer, *cur))
-            {
-                if (prev)
-                {
-                    aTimer.mNext = cur;
-                    prev->mNext = &aTimer;
-                }
-                else
-                {
-                    aTimer.mNext = mHead;
-                    mHead = &aTimer;
-                    SetAlarm();
-                }
-
-                break;
-            }
-
-            prev = cur;
+            aTimer.mPrev->mSibling = aTimer.mSibling;
         }
 
-        if (cur == NULL)
+        if (aTimer.mSibling != NULL)
         {
-            prev->mNext = &aTimer;
+            aTimer.mSibling->mPrev = aTimer.mPrev;
         }
+
+        // The children of a non-root timer never fire before the root, so the root is unchanged.
+        mHead = Meld(mHead, subheap);
     }
+
+    aTimer.mChild = NULL;
+    aTimer.mSibling = NULL;
+    aTimer.mPrev = NULL;
+
+exit:
+    return;
 }
 
-void TimerScheduler::Remove(Timer &aTimer)
+Timer *TimerScheduler::Meld(Timer *aTimerA, Timer *aTimerB)
 {
-    if (mHead == &aTimer)
+    Timer *root = aTimerA;
+    Timer *child = aTimerB;
+
+    VerifyOrExit(aTimerA != NULL, root = aTimerB);
+    VerifyOrExit(aTimerB != NULL, ;);
+
+    if (aTimerB->mFireTime < aTimerA->mFireTime)
     {
-        mHead = aTimer.mNext;
-        aTimer.mNext = NULL;
-        SetAlarm();
+        root = aTimerB;
+        child = aTimerA;
     }
-    else
+
+    child->mPrev = root;
+    child->mSibling = root->mChild;
+
+    if (root->mChild != NULL)
     {
-        for (Timer *cur = mHead; cur; cur = cur->mNext)
-        {
-            if (cur->mNext == &aTimer)
-            {
-                cur->mNext = aTimer.mNext;
-                aTimer.mNext = NULL;
-                break;
-            }
-        }
+        root->mChild->mPrev = child;
     }
+
+    root->mChild = child;
+
+exit:
+    return root;
 }
 
-bool TimerScheduler::IsAdded(const Timer &aTimer)
+Timer *TimerScheduler::MergePairs(Timer *aFirst)
 {
-    bool rval = false;
+    Timer *pairs = NULL;
+    Timer *root = NULL;
+    Timer *next;
 
-    for (Timer *cur = mHead; cur; cur = cur->mNext)
+    // First pass: meld siblings pairwise from left to right, collecting the results in reverse order.
+    while (aFirst != NULL)
     {
-        if (cur == &aTimer)
+        Timer *first = aFirst;
+        Timer *second = first->mSibling;
+        Timer *merged;
+
+        next = (second != NULL) ? second->mSibling : NULL;
+
+        first->mSibling = NULL;
+        first->mPrev = NULL;
+
+        if (second != NULL)
         {
-            ExitNow(rval = true);
+            second->mSibling = NULL;
+            second->mPrev = NULL;
         }
+
+        merged = Meld(first, second);
+        merged->mSibling = pairs;
+        pairs = merged;
+        aFirst = next;
     }
 
-exit:
-    return rval;
+    // Second pass: meld the pairs from right to left into a single heap.
+    while (pairs != NULL)
+    {
+        next = pairs->mSibling;
+        pairs->mSibling = NULL;
+        root = Meld(pairs, root);
+        pairs = next;
+    }
+
+    return root;
 }
 
-void TimerScheduler::SetAlarm(void)
+uint64_t TimerScheduler::ExtendTime(uint32_t aNow)
 {
-    uint32_t now = otPlatAlarmGetNow();
-    uint32_t elapsed;
-    uint32_t remaining;
+    if (aNow < mLastNow)
+    {
+        mNowWraps++;
+    }
+
+    mLastNow = aNow;
+
+    return (static_cast<uint64_t>(mNowWraps) << 32) | aNow;
+}
+
+void TimerScheduler::SetAlarm(uint32_t aNow)
+{
+    uint64_t now;
+
+    // The alarm is re-armed once when `FireTimers()` completes.
+    VerifyOrExit(!mFiring, ;);
 
     if (mHead == NULL)
     {
@@ -142,11 +224,13 @@ void TimerScheduler::SetAlarm(void)
     }
     else
     {
-        elapsed = now - mHead->mT0;
-        remaining = (mHead->mDt > elapsed) ? mHead->mDt - elapsed : 0;
-
-        otPlatAlarmStartAt(GetIp6()->GetInstance(), now, remaining);
+        now = ExtendTime(aNow);
+        otPlatAlarmStartAt(GetIp6()->GetInstance(), aNow,
+                           (mHead->mFireTime > now) ? static_cast<uint32_t>(mHead->mFireTime - now) : 0);
     }
+
+exit:
+    return;
 }
 
 extern "C" void otPlatAlarmFired(otInstance *aInstance)
@@ -158,68 +242,42 @@ extern "C" void otPlatAlarmFired(otInstance *aInstance)
 
 void TimerScheduler::FireTimers()
 {
-    uint32_t now = otPlatAlarmGetNow();
-    uint32_t elapsed;
-    Timer *timer = mHead;
+    uint64_t now = ExtendTime(otPlatAlarmGetNow());
+    uint32_t numFired = 0;
+    Timer *timer;
 
-    if (timer)
-    {
-        elapsed = now - timer->mT0;
+    mFiring = true;
+    mCounters.mAlarmFired++;
 
-        if (elapsed >= timer->mDt)
-        {
-            Remove(*timer);
-            timer->Fired();
-        }
-        else
+    while ((timer = mHead) != NULL && timer->mFireTime <= now)
+    {
+        if (numFired >= OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM)
         {
-            SetAlarm();
+            mCounters.mFireLimitReached++;
+            break;
         }
+
+        Unlink(*timer);
+        numFired++;
+        timer->Fired();
     }
-    else
-    {
-        SetAlarm();
-    }
-}
 
-Ip6::Ip6 *TimerScheduler::GetIp6()
-{
-    return Ip6::Ip6FromTimerScheduler(this);
-}
+    mFiring = false;
 
-bool TimerScheduler::TimerCompare(const Timer &aTimerA, const Timer &aTimerB)
-{
-    uint32_t now = otPlatAlarmGetNow();
-    uint32_t elapsedA = now - aTimerA.mT0;
-    uint32_t elapsedB = now - aTimerB.mT0;
-    bool retval = false;
+    mCounters.mTimersFired += numFired;
 
-    if (aTimerA.mDt >= elapsedA && aTimerB.mDt >= elapsedB)
+    if (numFired > mCounters.mMaxTimersPerAlarm)
     {
-        uint32_t remainingA = aTimerA.mDt - elapsedA;
-        uint32_t remainingB = aTimerB.mDt - elapsedB;
-
-        if (remainingA < remainingB)
-        {
-            retval = true;
-        }
-    }
-    else if (aTimerA.mDt < elapsedA && aTimerB.mDt >= elapsedB)
-    {
-        retval = true;
+        mCounters.mMaxTimersPerAlarm = numFired;
     }
-    else if (aTimerA.mDt < elapsedA && aTimerB.mDt < elapsedB)
-    {
-        uint32_t expiredByA = elapsedA - aTimerA.mDt;
-        uint32_t expiredByB = elapsedB - aTimerB.mDt;
 
-        if (expiredByB < expiredByA)
-        {
-            retval = true;
-        }
-    }
+    // Handlers may have sampled a later time, so sample again before re-arming.
+    SetAlarm(otPlatAlarmGetNow());
+}
 
-    return retval;
+Ip6::Ip6 *TimerScheduler::GetIp6()
+{
+    return Ip6::Ip6FromTimerScheduler(this);
 }
 
 }  // namespace Thread
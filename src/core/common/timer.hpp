@@ -61,6 +61,9 @@ class Timer;
 /**
  * This class implements the timer scheduler.
  *
+ * Running timers are kept in an intrusive pairing heap ordered by their absolute fire time, so that starting,
+ * stopping and checking a timer do not require walking the set of running timers.
+ *
  */
 class TimerScheduler
 {
@@ -96,16 +99,25 @@ public:
      * @retval FALSE  If the timer instance is not added.
      *
      */
-    bool IsAdded(const Timer &aTimer);
+    bool IsAdded(const Timer &aTimer) const;
 
     /**
      * This method processes all running timers.
      *
-     * @param[in]  aContext  A pointer to arbitrary context information.
+     * All expired timers are fired in a single pass, up to `OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM`, and the
+     * platform alarm is re-armed once afterwards.
      *
      */
     void FireTimers(void);
 
+    /**
+     * This method returns the timer scheduler counters.
+     *
+     * @returns A reference to the timer scheduler counters.
+     *
+     */
+    const otTimerCounters &GetCounters(void) const { return mCounters; }
+
     /**
      * This method returns the pointer to the parent Ip6 structure.
      *
@@ -115,21 +127,49 @@ public:
     Ip6::Ip6 *GetIp6();
 
 private:
-    void SetAlarm(void);
+    void SetAlarm(uint32_t aNow);
+    void Unlink(Timer &aTimer);
+
+    /**
+     * This method extends a 32-bit platform alarm time into a 64-bit time that does not wrap.
+     *
+     * The platform alarm time is assumed to be monotonic, so any decrease of @p aNow is treated as a wrap.
+     *
+     * @param[in]  aNow  The current time in milliseconds as returned by `otPlatAlarmGetNow()`.
+     *
+     * @returns The current time in milliseconds extended to 64 bits.
+     *
+     */
+    uint64_t ExtendTime(uint32_t aNow);
 
     /**
-     * This method compares two timers and returns a value to indicate
-     * which timer will fire earlier.
+     * This static method melds two heaps into one and returns the root of the resulting heap.
+     *
+     * On equal fire times @p aTimerA stays the root.
+     *
+     * @param[in]  aTimerA  The root of the first heap (may be NULL).
+     * @param[in]  aTimerB  The root of the second heap (may be NULL).
+     *
+     * @returns The root of the melded heap.
+     *
+     */
+    static Timer *Meld(Timer *aTimerA, Timer *aTimerB);
+
+    /**
+     * This static method melds a list of sibling heaps using the two-pass pairing scheme.
+     *
+     * @param[in]  aFirst  The first heap in the sibling list (may be NULL).
      *
-     * @param[in] aTimerA   The first timer for comparison.
-     * @param[in] aTimerB   The second timer for comparison.
+     * @returns The root of the melded heap.
      *
-     * @returns true if aTimerA will fire before aTimerB.
-     * @returns false if aTimerA will fire at the same time or after aTimerB.
      */
-    static bool TimerCompare(const Timer &aTimerA, const Timer &aTimerB);
+    static Timer *MergePairs(Timer *aFirst);
 
-    Timer *mHead;
+    Timer          *mHead;
+    uint32_t        mLastNow;
+    uint32_t        mNowWraps;
+    bool            mFiring;
+    otTimerCounters mCounters;
 };
 
 /**
@@ -162,7 +202,10 @@ public:
         mContext(aContext),
         mT0(0),
         mDt(0),
-        mNext(NULL) {
+        mFireTime(0),
+        mChild(NULL),
+        mSibling(NULL),
+        mPrev(NULL) {
     }
 
     /**
@@ -258,7 +301,10 @@ private:
     void           *mContext;
     uint32_t        mT0;
     uint32_t        mDt;
-    Timer          *mNext;
+    uint64_t        mFireTime;  ///< Absolute fire time as extended by the scheduler.
+    Timer          *mChild;     ///< The first child in the heap.
+    Timer          *mSibling;   ///< The next sibling in the heap.
+    Timer          *mPrev;      ///< The parent if first child, otherwise the previous sibling (NULL if not in heap).
 };
 
 /**
@@ -43,14 +43,22 @@ ThreadError Tlv::Get(const Message &aMessage, uint8_t aType, uint16_t aMaxLength
     uint16_t offset;
 
     SuccessOrExit(error = GetOffset(aMessage, aType, offset));
-    aMessage.Read(offset, sizeof(Tlv), &aTlv);
 
-    if (aMaxLength > sizeof(aTlv) + aTlv.GetLength())
     {
-        aMaxLength = sizeof(aTlv) + aTlv.GetLength();
-    }
+        Message::Cursor cursor(aMessage, offset);
+
+        aMessage.Read(cursor, sizeof(Tlv), &aTlv);
+
+        if (aMaxLength > sizeof(aTlv) + aTlv.GetLength())
+        {
+            aMaxLength = sizeof(aTlv) + aTlv.GetLength();
+        }
 
-    aMessage.Read(offset, aMaxLength, &aTlv);
+        if (aMaxLength > sizeof(aTlv))
+        {
+            aMessage.Read(cursor, aMaxLength - sizeof(aTlv), reinterpret_cast<uint8_t *>(&aTlv) + sizeof(aTlv));
+        }
+    }
 
 exit:
     return error;
@@ -59,22 +67,23 @@ exit:
 ThreadError Tlv::GetOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset)
 {
     ThreadError error = kThreadError_NotFound;
-    uint16_t offset = aMessage.GetOffset();
+    Message::Cursor cursor(aMessage, aMessage.GetOffset());
     uint16_t end = aMessage.GetLength();
     Tlv tlv;
 
-    while (offset < end)
+    while (cursor.GetOffset() < end)
     {
-        aMessage.Read(offset, sizeof(Tlv), &tlv);
+        uint16_t offset = cursor.GetOffset();
+
+        aMessage.Read(cursor, sizeof(Tlv), &tlv);
 
         // skip extended TLV
         if (tlv.GetLength() == kExtendedLength)
         {
             uint16_t length = 0;
 
-            offset += sizeof(tlv);
-            aMessage.Read(offset, sizeof(length), &length);
-            offset += sizeof(length) + HostSwap16(length);
+            aMessage.Read(cursor, sizeof(length), &length);
+            cursor.MoveOffset(HostSwap16(length));
         }
         else if (tlv.GetType() == aType && (offset + sizeof(tlv) + tlv.GetLength()) <= end)
         {
@@ -83,7 +92,7 @@ ThreadError Tlv::GetOffset(const Message &aMessage, uint8_t aType, uint16_t &aOf
         }
         else
         {
-            offset += sizeof(tlv) + tlv.GetLength();
+            cursor.MoveOffset(tlv.GetLength());
         }
     }
 
@@ -94,38 +103,148 @@ exit:
 ThreadError Tlv::GetValueOffset(const Message &aMessage, uint8_t aType, uint16_t &aOffset, uint16_t &aLength)
 {
     ThreadError error = kThreadError_NotFound;
-    uint16_t offset = aMessage.GetOffset();
+    Message::Cursor cursor(aMessage, aMessage.GetOffset());
     uint16_t end = aMessage.GetLength();
 
-    while (offset < end)
+    while (cursor.GetOffset() < end)
     {
         Tlv tlv;
         uint16_t length;
 
-        aMessage.Read(offset, sizeof(tlv), &tlv);
-        offset += sizeof(tlv);
+        aMessage.Read(cursor, sizeof(tlv), &tlv);
 
         length = tlv.GetLength();
 
         if (length == kExtendedLength)
         {
-            aMessage.Read(offset, sizeof(length), &length);
-            offset += sizeof(length);
+            aMessage.Read(cursor, sizeof(length), &length);
             length = HostSwap16(length);
         }
 
         if (tlv.GetType() == aType)
         {
-            aOffset = offset;
+            aOffset = cursor.GetOffset();
             aLength = length;
             ExitNow(error = kThreadError_None);
         }
 
-        offset += length;
+        cursor.MoveOffset(length);
+    }
+
+exit:
+    return error;
+}
+
+TlvIndex::TlvIndex(const Message &aMessage):
+    mMessage(aMessage)
+{
+    Message::Cursor cursor(aMessage, aMessage.GetOffset());
+    uint16_t end = aMessage.GetLength();
+
+    memset(mOffsets, 0xff, sizeof(mOffsets));
+
+    while (cursor.GetOffset() + sizeof(Tlv) <= end)
+    {
+        uint16_t offset = cursor.GetOffset();
+        uint16_t flags = 0;
+        uint16_t length;
+        Tlv tlv;
+
+        aMessage.Read(cursor, sizeof(tlv), &tlv);
+        length = tlv.GetLength();
+
+        if (length == Tlv::kExtendedLength)
+        {
+            VerifyOrExit(aMessage.Read(cursor, sizeof(length), &length) == sizeof(length), ;);
+            length = HostSwap16(length);
+            flags = kExtendedFlag;
+        }
+
+        VerifyOrExit(cursor.GetOffset() + length <= end, ;);
+
+        if (tlv.GetType() < kNumIndexedTypes && mOffsets[tlv.GetType()] == kNotPresent)
+        {
+            mOffsets[tlv.GetType()] = offset | flags;
+        }
+
+        cursor.MoveOffset(length);
+    }
+
+exit:
+    return;
+}
+
+ThreadError TlvIndex::Get(uint8_t aType, uint16_t aMaxLength, Tlv &aTlv) const
+{
+    ThreadError error = kThreadError_NotFound;
+    uint16_t offset;
+
+    VerifyOrExit(aType < kNumIndexedTypes, error = Tlv::Get(mMessage, aType, aMaxLength, aTlv));
+    SuccessOrExit(error = GetOffset(aType, offset));
+
+    {
+        Message::Cursor cursor(mMessage, offset);
+
+        mMessage.Read(cursor, sizeof(Tlv), &aTlv);
+
+        if (aMaxLength > sizeof(aTlv) + aTlv.GetLength())
+        {
+            aMaxLength = sizeof(aTlv) + aTlv.GetLength();
+        }
+
+        if (aMaxLength > sizeof(aTlv))
+        {
+            mMessage.Read(cursor, aMaxLength - sizeof(aTlv), reinterpret_cast<uint8_t *>(&aTlv) + sizeof(aTlv));
+        }
     }
 
 exit:
     return error;
 }
 
+ThreadError TlvIndex::GetOffset(uint8_t aType, uint16_t &aOffset) const
+{
+    ThreadError error = kThreadError_NotFound;
+
+    VerifyOrExit(aType < kNumIndexedTypes, error = Tlv::GetOffset(mMessage, aType, aOffset));
+
+    // An extended TLV is not returned by offset, as its header does not fit `Tlv`.
+    VerifyOrExit(mOffsets[aType] != kNotPresent && (mOffsets[aType] & kExtendedFlag) == 0, ;);
+
+    aOffset = mOffsets[aType];
+    error = kThreadError_None;
+
+exit:
+    return error;
+}
+
+ThreadError TlvIndex::GetValueOffset(uint8_t aType, uint16_t &aOffset, uint16_t &aLength) const
+{
+    ThreadError error = kThreadError_NotFound;
+    uint16_t offset;
+    Tlv tlv;
+
+    VerifyOrExit(aType < kNumIndexedTypes, error = Tlv::GetValueOffset(mMessage, aType, aOffset, aLength));
+    VerifyOrExit((offset = mOffsets[aType]) != kNotPresent, ;);
+
+    if (offset & kExtendedFlag)
+    {
+        offset &= ~static_cast<uint16_t>(kExtendedFlag);
+        mMessage.Read(offset + sizeof(tlv), sizeof(aLength), &aLength);
+        aLength = HostSwap16(aLength);
+        aOffset = offset + sizeof(tlv) + sizeof(aLength);
+    }
+    else
+    {
+        mMessage.Read(offset, sizeof(tlv), &tlv);
+        aLength = tlv.GetLength();
+        aOffset = offset + sizeof(tlv);
+    }
+
+    error = kThreadError_None;
+
+exit:
+    return error;
+}
+
 }  // namespace Thread
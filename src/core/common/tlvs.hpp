@@ -53,6 +53,8 @@ namespace Thread {
 OT_TOOL_PACKED_BEGIN
 class Tlv
 {
+    friend class TlvIndex;
+
 public:
     /**
      * This method returns the Type value.
@@ -208,6 +210,76 @@ private:
     uint16_t mLength;
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class records where each TLV of a message starts, so a handler that looks up many TLV types walks the
+ * message only once.
+ *
+ * The index covers the TLVs from the message offset to the end of the message and, like the `Tlv` lookups, keeps
+ * the first TLV of each type. It remains valid while the message content is unchanged. Types beyond the indexed
+ * range are looked up with a scan.
+ *
+ */
+class TlvIndex
+{
+public:
+    /**
+     * This constructor indexes the TLVs of @p aMessage.
+     *
+     * @param[in]  aMessage  A reference to the message.
+     *
+     */
+    explicit TlvIndex(const Message &aMessage);
+
+    /**
+     * This method reads the requested TLV out of the indexed message.
+     *
+     * @param[in]   aType       The Type value to search for.
+     * @param[in]   aMaxLength  Maximum number of bytes to read.
+     * @param[out]  aTlv        A reference to the TLV that will be copied to.
+     *
+     * @retval kThreadError_None      Successfully copied the TLV.
+     * @retval kThreadError_NotFound  Could not find the TLV with Type @p aType.
+     *
+     */
+    ThreadError Get(uint8_t aType, uint16_t aMaxLength, Tlv &aTlv) const;
+
+    /**
+     * This method obtains the offset of a TLV within the indexed message.
+     *
+     * @param[in]   aType       The Type value to search for.
+     * @param[out]  aOffset     A reference to the offset of the TLV.
+     *
+     * @retval kThreadError_None      Successfully found the TLV.
+     * @retval kThreadError_NotFound  Could not find the TLV with Type @p aType.
+     *
+     */
+    ThreadError GetOffset(uint8_t aType, uint16_t &aOffset) const;
+
+    /**
+     * This method finds the offset and length of the value of a given TLV type, which may use an extended length.
+     *
+     * @param[in]   aType       The Type value to search for.
+     * @param[out]  aOffset     The offset where the value starts.
+     * @param[out]  aLength     The length of the value.
+     *
+     * @retval kThreadError_None      Successfully found the TLV.
+     * @retval kThreadError_NotFound  Could not find the TLV with Type @p aType.
+     *
+     */
+    ThreadError GetValueOffset(uint8_t aType, uint16_t &aOffset, uint16_t &aLength) const;
+
+private:
+    enum
+    {
+        kNumIndexedTypes = 64,
+        kExtendedFlag    = 0x8000,  ///< Marks an offset whose TLV uses the extended length format.
+        kNotPresent      = 0xffff,
+    };
+
+    const Message &mMessage;
+    uint16_t mOffsets[kNumIndexedTypes];
+};
+
 }  // namespace Thread
 
 #endif  // TLVS_HPP_
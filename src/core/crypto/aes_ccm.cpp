@@ -31,19 +31,33 @@
  *   This file implements AES-CCM.
  */
 
+#include <string.h>
+
 #include <common/code_utils.hpp>
 #include <common/debug.hpp>
+#include <common/message.hpp>
 #include <crypto/aes_ccm.hpp>
 
 namespace Thread {
 namespace Crypto {
 
+AesCcm::AesCcm(void):
+    mCipher(&mEcb)
+{
+}
+
 ThreadError AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
     mEcb.SetKey(aKey, 8 * aKeyLength);
+    mCipher = &mEcb;
     return kThreadError_None;
 }
 
+void AesCcm::SetKey(AesEcb &aEcb)
+{
+    mCipher = &aEcb;
+}
+
 void AesCcm::Init(uint32_t aHeaderLength, uint32_t aPlainTextLength, uint8_t aTagLength,
                   const void *aNonce, uint8_t aNonceLength)
 {
@@ -113,7 +127,7 @@ void AesCcm::Init(uint32_t aHeaderLength, uint32_t aPlainTextLength, uint8_t aTa
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mCipher->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -167,9 +181,22 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     // process header
     for (unsigned i = 0; i < aHeaderLength; i++)
     {
+        // Process whole blocks at once while the CBC-MAC is at a block boundary.
+        while (mBlockLength == sizeof(mBlock) && aHeaderLength - i >= AesEcb::kBlockSize)
+        {
+            mCipher->Encrypt(mBlock, mBlock);
+            XorBlock(mBlock, mBlock, headerBytes + i);
+            i += AesEcb::kBlockSize;
+        }
+
+        if (i == aHeaderLength)
+        {
+            break;
+        }
+
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mCipher->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -183,13 +210,41 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mCipher->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
     }
 }
 
+void AesCcm::XorBlock(uint8_t *aOutput, const uint8_t *aInput1, const uint8_t *aInput2)
+{
+    // Word-wide XOR, using memcpy so that unaligned buffers are handled and the compiler may vectorize.
+    uint32_t words1[AesEcb::kBlockSize / sizeof(uint32_t)];
+    uint32_t words2[AesEcb::kBlockSize / sizeof(uint32_t)];
+
+    memcpy(words1, aInput1, sizeof(words1));
+    memcpy(words2, aInput2, sizeof(words2));
+
+    for (unsigned i = 0; i < sizeof(words1) / sizeof(words1[0]); i++)
+    {
+        words1[i] ^= words2[i];
+    }
+
+    memcpy(aOutput, words1, sizeof(words1));
+}
+
+void AesCcm::IncrementCounter(void)
+{
+    for (int i = sizeof(mCtr) - 1; i > mNonceLength; i--)
+    {
+        if (++mCtr[i])
+        {
+            break;
+        }
+    }
+}
+
 void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncrypt)
 {
     uint8_t *plaintextBytes = reinterpret_cast<uint8_t *>(plaintext);
@@ -200,17 +255,42 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
 
     for (unsigned i = 0; i < len; i++)
     {
-        if (mCtrLength == 16)
+        // Process whole blocks at once while both the key stream and the CBC-MAC are at a block boundary.
+        while (mCtrLength == sizeof(mCtrPad) && (mBlockLength == 0 || mBlockLength == sizeof(mBlock)) &&
+               len - i >= AesEcb::kBlockSize)
         {
-            for (int j = sizeof(mCtr) - 1; j > mNonceLength; j--)
+            IncrementCounter();
+            mCipher->Encrypt(mCtr, mCtrPad);
+
+            if (mBlockLength == sizeof(mBlock))
             {
-                if (++mCtr[j])
-                {
-                    break;
-                }
+                mCipher->Encrypt(mBlock, mBlock);
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            if (aEncrypt)
+            {
+                XorBlock(mBlock, mBlock, plaintextBytes + i);
+                XorBlock(ciphertextBytes + i, plaintextBytes + i, mCtrPad);
+            }
+            else
+            {
+                XorBlock(plaintextBytes + i, ciphertextBytes + i, mCtrPad);
+                XorBlock(mBlock, mBlock, plaintextBytes + i);
+            }
+
+            mBlockLength = sizeof(mBlock);
+            i += AesEcb::kBlockSize;
+        }
+
+        if (i == len)
+        {
+            break;
+        }
+
+        if (mCtrLength == 16)
+        {
+            IncrementCounter();
+            mCipher->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -227,7 +307,7 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mCipher->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -240,7 +320,7 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mCipher->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -251,6 +331,19 @@ void AesCcm::Payload(void *plaintext, void *ciphertext, uint32_t len, bool aEncr
     }
 }
 
+void AesCcm::Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, bool aEncrypt)
+{
+    Message::Cursor cursor(aMessage, aOffset);
+    uint8_t *data;
+    uint16_t length;
+
+    while (aLength > 0 && (length = aMessage.GetSegment(cursor, aLength, data)) > 0)
+    {
+        Payload(data, data, length, aEncrypt);
+        aLength -= length;
+    }
+}
+
 void AesCcm::Finalize(void *tag, uint8_t *aTagLength)
 {
     uint8_t *tagBytes = reinterpret_cast<uint8_t *>(tag);
@@ -259,7 +352,7 @@ void AesCcm::Finalize(void *tag, uint8_t *aTagLength)
 
     if (mTagLength > 0)
     {
-        mEcb.Encrypt(mCtr, mCtrPad);
+        mCipher->Encrypt(mCtr, mCtrPad);
 
         for (int i = 0; i < mTagLength; i++)
         {
@@ -41,6 +41,9 @@
 #include <crypto/aes_ecb.hpp>
 
 namespace Thread {
+
+class Message;
+
 namespace Crypto {
 
 /**
@@ -57,6 +60,12 @@ namespace Crypto {
 class AesCcm
 {
 public:
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    AesCcm(void);
+
     /**
      * This method sets the key.
      *
@@ -66,6 +75,16 @@ public:
      */
     ThreadError SetKey(const uint8_t *aKey, uint16_t aKeyLength);
 
+    /**
+     * This method uses an already expanded AES key schedule instead of computing one.
+     *
+     * The referenced context is used for all following computations and must outlive this object.
+     *
+     * @param[in]  aEcb  A reference to the AES-ECB context holding the key schedule.
+     *
+     */
+    void SetKey(AesEcb &aEcb);
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -99,6 +118,19 @@ public:
      */
     void Payload(void *aPlainText, void *aCipherText, uint32_t aLength, bool aEncrypt);
 
+    /**
+     * This method processes a payload held in a message, in place.
+     *
+     * The payload is processed segment by segment directly in the message buffers.
+     *
+     * @param[inout]  aMessage  A reference to the message.
+     * @param[in]     aOffset   The offset of the payload within @p aMessage.
+     * @param[in]     aLength   Payload length in bytes.
+     * @param[in]     aEncrypt  TRUE on encrypt and FALSE on decrypt.
+     *
+     */
+    void Payload(Message &aMessage, uint16_t aOffset, uint16_t aLength, bool aEncrypt);
+
     /**
      * This method generates the tag.
      *
@@ -109,7 +141,11 @@ public:
     void Finalize(void *aTag, uint8_t *aTagLength);
 
 private:
+    static void XorBlock(uint8_t *aOutput, const uint8_t *aInput1, const uint8_t *aInput2);
+    void IncrementCounter(void);
+
     AesEcb mEcb;
+    AesEcb *mCipher;
     uint8_t mBlock[AesEcb::kBlockSize];
     uint8_t mCtr[AesEcb::kBlockSize];
     uint8_t mCtrPad[AesEcb::kBlockSize];
@@ -174,7 +174,6 @@ Mac::Mac(ThreadNetif &aThreadNetif):
     mPcapCallbackContext = NULL;
 
     otPlatRadioEnable(GetInstance());
-    mTxFrame = static_cast<Frame *>(otPlatRadioGetTransmitBuffer(GetInstance()));
 
     mKeyIdMode2FrameCounter = 0;
 }
@@ -692,7 +691,6 @@ void Mac::ProcessTransmitSecurity(Frame &aFrame)
     uint8_t nonce[kNonceSize];
     uint8_t tagLength;
     Crypto::AesCcm aesCcm;
-    const uint8_t *key = NULL;
     const ExtAddress *extAddress = NULL;
 
     if (aFrame.GetSecurityEnabled() == false)
@@ -705,7 +703,7 @@ void Mac::ProcessTransmitSecurity(Frame &aFrame)
     switch (keyIdMode)
     {
     case Frame::kKeyIdMode0:
-        key = mNetif.GetKeyManager().GetKek();
+        aesCcm.SetKey(mNetif.GetKeyManager().GetKekContext());
         extAddress = &mExtAddress;
 
         if (!aFrame.IsARetransmission())
@@ -717,7 +715,7 @@ void Mac::ProcessTransmitSecurity(Frame &aFrame)
         break;
 
     case Frame::kKeyIdMode1:
-        key = mNetif.GetKeyManager().GetCurrentMacKey();
+        aesCcm.SetKey(mNetif.GetKeyManager().GetMacKeyContext(mNetif.GetKeyManager().GetCurrentKeySequence()));
         extAddress = &mExtAddress;
 
         // If the frame is marked as a retransmission, the `Mac::Sender` which
@@ -738,7 +736,7 @@ void Mac::ProcessTransmitSecurity(Frame &aFrame)
     case Frame::kKeyIdMode2:
     {
         const uint8_t keySource[] = {0xff, 0xff, 0xff, 0xff};
-        key = sMode2Key;
+        aesCcm.SetKey(sMode2Key, sizeof(sMode2Key));
         mKeyIdMode2FrameCounter++;
         aFrame.SetFrameCounter(mKeyIdMode2FrameCounter);
         aFrame.SetKeySource(keySource);
@@ -757,7 +755,6 @@ void Mac::ProcessTransmitSecurity(Frame &aFrame)
 
     GenerateNonce(*extAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(key, 16);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
     aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -777,11 +774,14 @@ void Mac::HandleBeginTransmit(void *aContext)
 
 void Mac::HandleBeginTransmit(void)
 {
-    Frame &sendFrame(*mTxFrame);
+    Frame &sendFrame(mTxFrame);
+    RadioPacket *txPacket = otPlatRadioGetTransmitBuffer(GetInstance());
     ThreadError error = kThreadError_None;
 
     if (mCsmaAttempts == 0 && mTransmitAttempts == 0)
     {
+        // The frame is built in the PSDU of the radio's transmit buffer.
+        sendFrame.mPsdu = txPacket->mPsdu;
         sendFrame.SetPower(mMaxTransmitPower);
 
         switch (mState)
@@ -829,7 +829,8 @@ void Mac::HandleBeginTransmit(void)
 
     error = otPlatRadioReceive(GetInstance(), sendFrame.GetChannel());
     assert(error == kThreadError_None);
-    error = otPlatRadioTransmit(GetInstance(), static_cast<RadioPacket *>(&sendFrame));
+    *txPacket = sendFrame;
+    error = otPlatRadioTransmit(GetInstance(), txPacket);
     assert(error == kThreadError_None);
 
     if (sendFrame.GetAckRequest() && !(otPlatRadioGetCaps(GetInstance()) & kRadioCapsAckTimeout))
@@ -848,7 +849,7 @@ exit:
 
     if (error != kThreadError_None)
     {
-        TransmitDoneTask(mTxFrame, false, kThreadError_Abort);
+        TransmitDoneTask(false, kThreadError_Abort);
     }
 }
 
@@ -866,21 +867,22 @@ extern "C" void otPlatRadioTransmitDone(otInstance *aInstance, RadioPacket *aPac
     else
 #endif // OPENTHREAD_ENABLE_RAW_LINK_API
     {
-        aInstance->mThreadNetif.GetMac().TransmitDoneTask(aPacket, aRxPending, aError);
+        // The Mac keeps its own copy of the frame being transmitted.
+        aInstance->mThreadNetif.GetMac().TransmitDoneTask(aRxPending, aError);
     }
 
+    (void)aPacket;
     otLogFuncExit();
 }
 
-void Mac::TransmitDoneTask(RadioPacket *aPacket, bool aRxPending, ThreadError aError)
+void Mac::TransmitDoneTask(bool aRxPending, ThreadError aError)
 {
     mMacTimer.Stop();
 
     mCounters.mTxTotal++;
 
-    Frame *packet = static_cast<Frame *>(aPacket);
     Address addr;
-    packet->GetDstAddr(addr);
+    mTxFrame.GetDstAddr(addr);
 
     if (addr.mShortAddress == kShortAddrBroadcast)
     {
@@ -976,7 +978,7 @@ void Mac::HandleMacTimer(void)
         otPlatRadioReceive(GetInstance(), mChannel);
         mCounters.mTxTotal++;
 
-        mTxFrame->GetDstAddr(addr);
+        mTxFrame.GetDstAddr(addr);
 
         if (addr.mShortAddress == kShortAddrBroadcast)
         {
@@ -1023,7 +1025,7 @@ void Mac::HandleReceiveTimer(void)
 
 void Mac::SentFrame(ThreadError aError)
 {
-    Frame &sendFrame(*mTxFrame);
+    Frame &sendFrame(mTxFrame);
     Sender *sender;
 
     switch (aError)
@@ -1138,7 +1140,6 @@ ThreadError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr,
     uint8_t tagLength;
     uint8_t keyid;
     uint32_t keySequence = 0;
-    const uint8_t *macKey;
     const ExtAddress *extAddress;
     Crypto::AesCcm aesCcm;
 
@@ -1158,7 +1159,7 @@ ThreadError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr,
     switch (keyIdMode)
     {
     case Frame::kKeyIdMode0:
-        VerifyOrExit((macKey = mNetif.GetKeyManager().GetKek()) != NULL, error = kThreadError_Security);
+        aesCcm.SetKey(mNetif.GetKeyManager().GetKekContext());
         extAddress = &aSrcAddr.mExtAddress;
         break;
 
@@ -1172,19 +1173,16 @@ ThreadError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr,
         {
             // same key index
             keySequence = mNetif.GetKeyManager().GetCurrentKeySequence();
-            macKey = mNetif.GetKeyManager().GetCurrentMacKey();
         }
         else if (keyid == ((mNetif.GetKeyManager().GetCurrentKeySequence() - 1) & 0x7f))
         {
             // previous key index
             keySequence = mNetif.GetKeyManager().GetCurrentKeySequence() - 1;
-            macKey = mNetif.GetKeyManager().GetTemporaryMacKey(keySequence);
         }
         else if (keyid == ((mNetif.GetKeyManager().GetCurrentKeySequence() + 1) & 0x7f))
         {
             // next key index
             keySequence = mNetif.GetKeyManager().GetCurrentKeySequence() + 1;
-            macKey = mNetif.GetKeyManager().GetTemporaryMacKey(keySequence);
         }
         else
         {
@@ -1216,12 +1214,13 @@ ThreadError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr,
             }
         }
 
+        aesCcm.SetKey(mNetif.GetKeyManager().GetMacKeyContext(keySequence));
         extAddress = &aSrcAddr.mExtAddress;
 
         break;
 
     case Frame::kKeyIdMode2:
-        macKey = sMode2Key;
+        aesCcm.SetKey(sMode2Key, sizeof(sMode2Key));
         extAddress = static_cast<const ExtAddress *>(&sMode2ExtAddress);
         break;
 
@@ -1233,7 +1232,6 @@ ThreadError Mac::ProcessReceiveSecurity(Frame &aFrame, const Address &aSrcAddr,
     GenerateNonce(*extAddress, frameCounter, securityLevel, nonce);
     tagLength = aFrame.GetFooterLength() - Frame::kFcsSize;
 
-    aesCcm.SetKey(macKey, 16);
     aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
     aesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
     aesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), false);
@@ -1276,14 +1274,15 @@ extern "C" void otPlatRadioReceiveDone(otInstance *aInstance, RadioPacket *aFram
     else
 #endif // OPENTHREAD_ENABLE_RAW_LINK_API
     {
-        aInstance->mThreadNetif.GetMac().ReceiveDoneTask(static_cast<Frame *>(aFrame), aError);
+        aInstance->mThreadNetif.GetMac().ReceiveDoneTask(aFrame, aError);
     }
 
     otLogFuncExit();
 }
 
-void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
+void Mac::ReceiveDoneTask(RadioPacket *aPacket, ThreadError aError)
 {
+    Frame frame;
     Address srcaddr;
     Address dstaddr;
     PanId panid;
@@ -1298,21 +1297,24 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
     mCounters.mRxTotal++;
 
     VerifyOrExit(error == kThreadError_None, ;);
-    VerifyOrExit(aFrame != NULL, error = kThreadError_NoFrameReceived);
+    VerifyOrExit(aPacket != NULL, error = kThreadError_NoFrameReceived);
 
-    aFrame->SetSecurityValid(false);
+    // The radio's packet is copied into a Frame, which keeps the layout found by ValidatePsdu().
+    static_cast<RadioPacket &>(frame) = *aPacket;
+
+    frame.SetSecurityValid(false);
 
     if (mPcapCallback)
     {
-        aFrame->mDidTX = false;
-        mPcapCallback(aFrame, mPcapCallbackContext);
+        frame.mDidTX = false;
+        mPcapCallback(&frame, mPcapCallbackContext);
     }
 
     // Ensure we have a valid frame before attempting to read any contents of
     // the buffer received from the radio.
-    SuccessOrExit(error = aFrame->ValidatePsdu());
+    SuccessOrExit(error = frame.ValidatePsdu());
 
-    aFrame->GetSrcAddr(srcaddr);
+    frame.GetSrcAddr(srcaddr);
     neighbor = mNetif.GetMle().GetNeighbor(srcaddr);
 
     switch (srcaddr.mLength)
@@ -1354,7 +1356,7 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
 
         if (mWhitelist.GetFixedRssi(*whitelistEntry, rssi) == kThreadError_None)
         {
-            aFrame->mPower = rssi;
+            frame.mPower = rssi;
         }
     }
 
@@ -1365,7 +1367,7 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
     }
 
     // Destination Address Filtering
-    aFrame->GetDstAddr(dstaddr);
+    frame.GetDstAddr(dstaddr);
 
     switch (dstaddr.mLength)
     {
@@ -1373,14 +1375,14 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
         break;
 
     case sizeof(ShortAddress):
-        aFrame->GetDstPanId(panid);
+        frame.GetDstPanId(panid);
         VerifyOrExit((panid == kShortAddrBroadcast || panid == mPanId) &&
                      ((mRxOnWhenIdle && dstaddr.mShortAddress == kShortAddrBroadcast) ||
                       dstaddr.mShortAddress == mShortAddress), error = kThreadError_DestinationAddressFiltered);
         break;
 
     case sizeof(ExtAddress):
-        aFrame->GetDstPanId(panid);
+        frame.GetDstPanId(panid);
         VerifyOrExit(panid == mPanId &&
                      memcmp(&dstaddr.mExtAddress, &mExtAddress, sizeof(dstaddr.mExtAddress)) == 0,
                      error = kThreadError_DestinationAddressFiltered);
@@ -1400,13 +1402,13 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
     }
 
     // Security Processing
-    SuccessOrExit(error = ProcessReceiveSecurity(*aFrame, srcaddr, neighbor));
+    SuccessOrExit(error = ProcessReceiveSecurity(frame, srcaddr, neighbor));
 
     if (neighbor != NULL)
     {
-        neighbor->mLinkInfo.AddRss(mNoiseFloor, aFrame->mPower);
+        neighbor->mLinkInfo.AddRss(mNoiseFloor, frame.mPower);
 
-        if (aFrame->GetSecurityEnabled() == true)
+        if (frame.GetSecurityEnabled() == true)
         {
             switch (neighbor->mState)
             {
@@ -1417,8 +1419,8 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
             case Neighbor::kStateChildUpdateRequest:
 
                 // Only accept a "MAC Data Request" frame from a child being restored.
-                VerifyOrExit(aFrame->GetType() == Frame::kFcfFrameMacCmd, error = kThreadError_Drop);
-                VerifyOrExit(aFrame->GetCommandId(commandId) == kThreadError_None, error = kThreadError_Drop);
+                VerifyOrExit(frame.GetType() == Frame::kFcfFrameMacCmd, error = kThreadError_Drop);
+                VerifyOrExit(frame.GetCommandId(commandId) == kThreadError_None, error = kThreadError_Drop);
                 VerifyOrExit(commandId == Frame::kMacCmdDataRequest, error = kThreadError_Drop);
 
                 break;
@@ -1432,10 +1434,10 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
     switch (mState)
     {
     case kStateActiveScan:
-        if (aFrame->GetType() == Frame::kFcfFrameBeacon)
+        if (frame.GetType() == Frame::kFcfFrameBeacon)
         {
             mCounters.mRxBeacon++;
-            mActiveScanHandler(mScanContext, aFrame);
+            mActiveScanHandler(mScanContext, &frame);
         }
         else
         {
@@ -1451,10 +1453,10 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
             otPlatRadioSleep(GetInstance());
         }
 
-        switch (aFrame->GetType())
+        switch (frame.GetType())
         {
         case Frame::kFcfFrameMacCmd:
-            if (HandleMacCommand(*aFrame) == kThreadError_Drop)
+            if (HandleMacCommand(frame) == kThreadError_Drop)
             {
                 ExitNow(error = kThreadError_None);
             }
@@ -1479,11 +1481,11 @@ void Mac::ReceiveDoneTask(Frame *aFrame, ThreadError aError)
 
         if (receive)
         {
-            otDumpDebgMac("RX", aFrame->GetHeader(), aFrame->GetLength());
+            otDumpDebgMac("RX", frame.GetHeader(), frame.GetLength());
 
             for (Receiver *receiver = mReceiveHead; receiver; receiver = receiver->mNext)
             {
-                receiver->HandleReceivedFrame(*aFrame);
+                receiver->HandleReceivedFrame(frame);
             }
         }
 
@@ -471,12 +471,12 @@ public:
     /**
      * This method is called to handle receive events.
      *
-     * @param[in]  aFrame  A pointer to the received frame, or NULL if the receive operation aborted.
-     * @param[in]  aError  ::kThreadError_None when successfully received a frame, ::kThreadError_Abort when reception
-     *                     was aborted and a frame was not received.
+     * @param[in]  aPacket  A pointer to the received packet, or NULL if the receive operation aborted.
+     * @param[in]  aError   ::kThreadError_None when successfully received a frame, ::kThreadError_Abort when reception
+     *                      was aborted and a frame was not received.
      *
      */
-    void ReceiveDoneTask(Frame *aFrame, ThreadError aError);
+    void ReceiveDoneTask(RadioPacket *aPacket, ThreadError aError);
 
     /**
      * This method is called to handle transmit events.
@@ -488,7 +488,7 @@ public:
      *                     was aborted for other reasons.
      *
      */
-    void TransmitDoneTask(RadioPacket *aPacket, bool aRxPending, ThreadError aError);
+    void TransmitDoneTask(bool aRxPending, ThreadError aError);
 
     /**
      * This method returns if an active scan is in progress.
@@ -710,7 +710,7 @@ private:
     Whitelist mWhitelist;
     Blacklist mBlacklist;
 
-    Frame *mTxFrame;
+    Frame mTxFrame;
 
     otMacCounters mCounters;
     uint32_t mKeyIdMode2FrameCounter;
@@ -47,113 +47,78 @@ void ExtAddress::Set(const Ip6::Address &aIpAddress)
 
 ThreadError Frame::InitMacHeader(uint16_t aFcf, uint8_t aSecurityControl)
 {
+    ThreadError error;
     uint8_t *bytes = GetPsdu();
-    uint8_t length = 0;
 
     // Frame Control Field
     bytes[0] = aFcf & 0xff;
     bytes[1] = aFcf >> 8;
-    length += kFcfSize;
 
-    // Sequence Number
-    length += kDsnSize;
-
-    // Destinatinon PAN + Address
-    switch (aFcf & Frame::kFcfDstAddrMask)
+    // Security Control
+    if (aFcf & Frame::kFcfSecurityEnabled)
     {
-    case Frame::kFcfDstAddrNone:
-        break;
+        mSecurityOffset = kFcfSize + kDsnSize;
 
-    case Frame::kFcfDstAddrShort:
-        length += sizeof(PanId) + sizeof(ShortAddress);
-        break;
-
-    case Frame::kFcfDstAddrExt:
-        length += sizeof(PanId) + sizeof(ExtAddress);
-        break;
-
-    default:
-        assert(false);
-    }
+        switch (aFcf & Frame::kFcfDstAddrMask)
+        {
+        case Frame::kFcfDstAddrShort:
+            mSecurityOffset += sizeof(PanId) + sizeof(ShortAddress);
+            break;
 
-    // Source PAN + Address
-    switch (aFcf & Frame::kFcfSrcAddrMask)
-    {
-    case Frame::kFcfSrcAddrNone:
-        break;
+        case Frame::kFcfDstAddrExt:
+            mSecurityOffset += sizeof(PanId) + sizeof(ExtAddress);
+            break;
+        }
 
-    case Frame::kFcfSrcAddrShort:
-        if ((aFcf & Frame::kFcfPanidCompression) == 0)
+        switch (aFcf & Frame::kFcfSrcAddrMask)
         {
-            length += sizeof(PanId);
-        }
+        case Frame::kFcfSrcAddrShort:
+            mSecurityOffset += sizeof(ShortAddress);
+            break;
 
-        length += sizeof(ShortAddress);
-        break;
+        case Frame::kFcfSrcAddrExt:
+            mSecurityOffset += sizeof(ExtAddress);
+            break;
+        }
 
-    case Frame::kFcfSrcAddrExt:
-        if ((aFcf & Frame::kFcfPanidCompression) == 0)
+        if ((aFcf & Frame::kFcfSrcAddrMask) != Frame::kFcfSrcAddrNone && (aFcf & Frame::kFcfPanidCompression) == 0)
         {
-            length += sizeof(PanId);
+            mSecurityOffset += sizeof(PanId);
         }
 
-        length += sizeof(ExtAddress);
-        break;
-
-    default:
-        assert(false);
+        bytes[mSecurityOffset] = aSecurityControl;
     }
 
-    // Security Header
-    if (aFcf & Frame::kFcfSecurityEnabled)
-    {
-        bytes[length] = aSecurityControl;
+    error = UpdateLayout();
+    assert(error == kThreadError_None);
 
-        if (aSecurityControl & kSecLevelMask)
-        {
-            length += kSecurityControlSize + kFrameCounterSize;
-        }
-
-        switch (aSecurityControl & kKeyIdModeMask)
-        {
-        case kKeyIdMode0:
-            length += kKeySourceSizeMode0;
-            break;
-
-        case kKeyIdMode1:
-            length += kKeySourceSizeMode1 + kKeyIndexSize;
-            break;
+    SetPsduLength(mPayloadOffset + mFooterLength);
 
-        case kKeyIdMode2:
-            length += kKeySourceSizeMode2 + kKeyIndexSize;
-            break;
+    return error;
+}
 
-        case kKeyIdMode3:
-            length += kKeySourceSizeMode3 + kKeyIndexSize;
-            break;
-        }
-    }
+ThreadError Frame::ValidatePsdu(void)
+{
+    ThreadError error = kThreadError_Parse;
 
-    // Command ID
-    if ((aFcf & kFcfFrameTypeMask) == kFcfFrameMacCmd)
-    {
-        length += kCommandIdSize;
-    }
+    VerifyOrExit(kFcfSize + kDsnSize <= GetPsduLength(),);
+    SuccessOrExit(UpdateLayout());
+    VerifyOrExit(mPayloadOffset + mFooterLength <= GetPsduLength(),);
 
-    SetPsduLength(length + GetFooterLength());
+    error = kThreadError_None;
 
-    return kThreadError_None;
+exit:
+    return error;
 }
 
-ThreadError Frame::ValidatePsdu(void)
+ThreadError Frame::UpdateLayout(void)
 {
     ThreadError error = kThreadError_Parse;
-    uint8_t offset = 0;
-    uint16_t fcf;
-    uint8_t footerLength = kFcsSize;
+    uint8_t offset = kFcfSize + kDsnSize;
+    uint16_t fcf = static_cast<uint16_t>((GetPsdu()[1] << 8) | GetPsdu()[0]);
 
-    VerifyOrExit((offset += kFcfSize + kDsnSize) <= GetPsduLength(),);
-    fcf = static_cast<uint16_t>((GetPsdu()[1] << 8) | GetPsdu()[0]);
+    mFooterLength = kFcsSize;
+    mSecurityOffset = 0;
 
     // Destinatinon PAN + Address
     switch (fcf & Frame::kFcfDstAddrMask)
@@ -170,35 +135,38 @@ ThreadError Frame::ValidatePsdu(void)
         break;
 
     default:
-        goto exit;
+        ExitNow();
     }
 
-    // Source PAN + Address
+    // Source PAN
+    if ((fcf & Frame::kFcfPanidCompression) == 0)
+    {
+        offset += sizeof(PanId);
+    }
+
+    mSrcAddrOffset = offset;
+
+    // Source Address
     switch (fcf & Frame::kFcfSrcAddrMask)
     {
     case Frame::kFcfSrcAddrNone:
-        break;
-
-    case Frame::kFcfSrcAddrShort:
         if ((fcf & Frame::kFcfPanidCompression) == 0)
         {
-            offset += sizeof(PanId);
+            offset -= sizeof(PanId);
         }
 
+        break;
+
+    case Frame::kFcfSrcAddrShort:
         offset += sizeof(ShortAddress);
         break;
 
     case Frame::kFcfSrcAddrExt:
-        if ((fcf & Frame::kFcfPanidCompression) == 0)
-        {
-            offset += sizeof(PanId);
-        }
-
         offset += sizeof(ExtAddress);
         break;
 
     default:
-        goto exit;
+        ExitNow();
     }
 
     // Security Header
@@ -206,6 +174,7 @@ ThreadError Frame::ValidatePsdu(void)
     {
         uint8_t secControl = GetPsdu()[offset];
 
+        mSecurityOffset = offset;
         offset += kSecurityControlSize + kFrameCounterSize;
 
         switch (secControl & kKeyIdModeMask)
@@ -231,22 +200,22 @@ ThreadError Frame::ValidatePsdu(void)
         {
         case kSecNone:
         case kSecEnc:
-            footerLength += kMic0Size;
+            mFooterLength += kMic0Size;
             break;
 
         case kSecMic32:
         case kSecEncMic32:
-            footerLength += kMic32Size;
+            mFooterLength += kMic32Size;
             break;
 
         case kSecMic64:
         case kSecEncMic64:
-            footerLength += kMic64Size;
+            mFooterLength += kMic64Size;
             break;
 
         case kSecMic128:
         case kSecEncMic128:
-            footerLength += kMic128Size;
+            mFooterLength += kMic128Size;
             break;
         }
     }
@@ -257,8 +226,7 @@ ThreadError Frame::ValidatePsdu(void)
         offset += kCommandIdSize;
     }
 
-    VerifyOrExit((offset + footerLength) <= GetPsduLength(),);
-
+    mPayloadOffset = offset;
     error = kThreadError_None;
 
 exit:
@@ -463,24 +431,14 @@ uint8_t *Frame::FindSrcPanId(void)
     VerifyOrExit((fcf & Frame::kFcfDstAddrMask) != Frame::kFcfDstAddrNone ||
                  (fcf & Frame::kFcfSrcAddrMask) != Frame::kFcfSrcAddrNone, cur = NULL);
 
-    // Frame Control Field
-    cur += kFcfSize;
-    // Sequence Number
-    cur += kDsnSize;
-
     if ((fcf & Frame::kFcfPanidCompression) == 0)
     {
-        // Destination PAN + Address
-        switch (fcf & Frame::kFcfDstAddrMask)
-        {
-        case Frame::kFcfDstAddrShort:
-            cur += sizeof(PanId) + sizeof(ShortAddress);
-            break;
-
-        case Frame::kFcfDstAddrExt:
-            cur += sizeof(PanId) + sizeof(ExtAddress);
-            break;
-        }
+        cur += mSrcAddrOffset - sizeof(PanId);
+    }
+    else
+    {
+        // Frame Control Field + Sequence Number
+        cur += kFcfSize + kDsnSize;
     }
 
 exit:
@@ -516,33 +474,7 @@ exit:
 
 uint8_t *Frame::FindSrcAddr(void)
 {
-    uint8_t *cur = GetPsdu();
-    uint16_t fcf = static_cast<uint16_t>((GetPsdu()[1] << 8) | GetPsdu()[0]);
-
-    // Frame Control Field
-    cur += kFcfSize;
-    // Sequence Number
-    cur += kDsnSize;
-
-    // Destination PAN + Address
-    switch (fcf & Frame::kFcfDstAddrMask)
-    {
-    case Frame::kFcfDstAddrShort:
-        cur += sizeof(PanId) + sizeof(ShortAddress);
-        break;
-
-    case Frame::kFcfDstAddrExt:
-        cur += sizeof(PanId) + sizeof(ExtAddress);
-        break;
-    }
-
-    // Source PAN
-    if ((fcf & Frame::kFcfPanidCompression) == 0)
-    {
-        cur += sizeof(PanId);
-    }
-
-    return cur;
+    return GetPsdu() + mSrcAddrOffset;
 }
 
 ThreadError Frame::GetSrcAddr(Address &address)
@@ -615,52 +547,7 @@ ThreadError Frame::SetSrcAddr(const ExtAddress &aExtAddress)
 
 uint8_t *Frame::FindSecurityHeader(void)
 {
-    uint8_t *cur = GetPsdu();
-    uint16_t fcf = static_cast<uint16_t>((GetPsdu()[1] << 8) | GetPsdu()[0]);
-
-    VerifyOrExit((fcf & Frame::kFcfSecurityEnabled) != 0, cur = NULL);
-
-    // Frame Control Field
-    cur += kFcfSize;
-    // Sequence Number
-    cur += kDsnSize;
-
-    // Destination PAN + Address
-    switch (fcf & Frame::kFcfDstAddrMask)
-    {
-    case Frame::kFcfDstAddrShort:
-        cur += sizeof(PanId) + sizeof(ShortAddress);
-        break;
-
-    case Frame::kFcfDstAddrExt:
-        cur += sizeof(PanId) + sizeof(ExtAddress);
-        break;
-    }
-
-    // Source PAN + Address
-    switch (fcf & Frame::kFcfSrcAddrMask)
-    {
-    case Frame::kFcfSrcAddrShort:
-        if ((fcf & Frame::kFcfPanidCompression) == 0)
-        {
-            cur += sizeof(PanId);
-        }
-
-        cur += sizeof(ShortAddress);
-        break;
-
-    case Frame::kFcfSrcAddrExt:
-        if ((fcf & Frame::kFcfPanidCompression) == 0)
-        {
-            cur += sizeof(PanId);
-        }
-
-        cur += sizeof(ExtAddress);
-        break;
-    }
-
-exit:
-    return cur;
+    return (GetPsdu()[0] & Frame::kFcfSecurityEnabled) ? GetPsdu() + mSecurityOffset : NULL;
 }
 
 ThreadError Frame::GetSecurityLevel(uint8_t &aSecurityLevel)
@@ -852,44 +739,12 @@ ThreadError Frame::SetLength(uint8_t aLength)
 
 uint8_t Frame::GetHeaderLength(void)
 {
-    return static_cast<uint8_t>(GetPayload() - GetPsdu());
+    return mPayloadOffset;
 }
 
 uint8_t Frame::GetFooterLength(void)
 {
-    uint8_t footerLength = 0;
-    uint8_t *cur;
-
-    VerifyOrExit((cur = FindSecurityHeader()) != NULL, ;);
-
-    switch (cur[0] & kSecLevelMask)
-    {
-    case kSecNone:
-    case kSecEnc:
-        footerLength += kMic0Size;
-        break;
-
-    case kSecMic32:
-    case kSecEncMic32:
-        footerLength += kMic32Size;
-        break;
-
-    case kSecMic64:
-    case kSecEncMic64:
-        footerLength += kMic64Size;
-        break;
-
-    case kSecMic128:
-    case kSecEncMic128:
-        footerLength += kMic128Size;
-        break;
-    }
-
-exit:
-    // Frame Check Sequence
-    footerLength += kFcsSize;
-
-    return footerLength;
+    return mFooterLength;
 }
 
 uint8_t Frame::GetMaxPayloadLength(void)
@@ -915,96 +770,7 @@ uint8_t *Frame::GetHeader(void)
 
 uint8_t *Frame::GetPayload(void)
 {
-    uint8_t *cur = GetPsdu();
-    uint16_t fcf = static_cast<uint16_t>((GetPsdu()[1] << 8) | GetPsdu()[0]);
-    uint8_t securityControl;
-
-    // Frame Control
-    cur += kFcfSize;
-    // Sequence Number
-    cur += kDsnSize;
-
-    // Destination PAN + Address
-    switch (fcf & Frame::kFcfDstAddrMask)
-    {
-    case Frame::kFcfDstAddrNone:
-        break;
-
-    case Frame::kFcfDstAddrShort:
-        cur += sizeof(PanId) + sizeof(ShortAddress);
-        break;
-
-    case Frame::kFcfDstAddrExt:
-        cur += sizeof(PanId) + sizeof(ExtAddress);
-        break;
-
-    default:
-        ExitNow(cur = NULL);
-    }
-
-    // Source PAN + Address
-    switch (fcf & Frame::kFcfSrcAddrMask)
-    {
-    case Frame::kFcfSrcAddrNone:
-        break;
-
-    case Frame::kFcfSrcAddrShort:
-        if ((fcf & Frame::kFcfPanidCompression) == 0)
-        {
-            cur += sizeof(PanId);
-        }
-
-        cur += sizeof(ShortAddress);
-        break;
-
-    case Frame::kFcfSrcAddrExt:
-        if ((fcf & Frame::kFcfPanidCompression) == 0)
-        {
-            cur += sizeof(PanId);
-        }
-
-        cur += sizeof(ExtAddress);
-        break;
-
-    default:
-        ExitNow(cur = NULL);
-    }
-
-    // Security Control + Frame Counter + Key Identifier
-    if ((fcf & Frame::kFcfSecurityEnabled) != 0)
-    {
-        securityControl = *cur;
-
-        cur += kSecurityControlSize + kFrameCounterSize;
-
-        switch (securityControl & kKeyIdModeMask)
-        {
-        case kKeyIdMode0:
-            cur += kKeySourceSizeMode0;
-            break;
-
-        case kKeyIdMode1:
-            cur += kKeySourceSizeMode1 + kKeyIndexSize;
-            break;
-
-        case kKeyIdMode2:
-            cur += kKeySourceSizeMode2 + kKeyIndexSize;
-            break;
-
-        case kKeyIdMode3:
-            cur += kKeySourceSizeMode3 + kKeyIndexSize;
-            break;
-        }
-    }
-
-    // Command ID
-    if ((fcf & kFcfFrameTypeMask) == kFcfFrameMacCmd)
-    {
-        cur += kCommandIdSize;
-    }
-
-exit:
-    return cur;
+    return GetPsdu() + mPayloadOffset;
 }
 
 uint8_t *Frame::GetFooter(void)
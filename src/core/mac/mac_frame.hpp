@@ -165,6 +165,9 @@ struct Address
 /**
  * This class implements IEEE 802.15.4 MAC frame generation and parsing.
  *
+ * A Frame caches the layout of its MAC header beyond the RadioPacket fields, so a RadioPacket owned by the radio
+ * driver must be copied into a Frame rather than cast to one.
+ *
  */
 OT_TOOL_PACKED_BEGIN
 class Frame: public RadioPacket
@@ -243,6 +246,9 @@ public:
     /**
      * This method initializes the MAC header.
      *
+     * The frame layout used by the header field accessors is computed here, so this method must be called before
+     * any of them when building a frame.
+     *
      * @param[in]  aFcf     The Frame Control field.
      * @param[in]  aSecCtl  The Security Control field.
      *
@@ -255,6 +261,9 @@ public:
     /**
      * This method validates the frame.
      *
+     * The frame layout used by the header field accessors is computed here, so this method must be called before
+     * any of them when processing a received frame.
+     *
      * @retval kThreadError_None    Successfully parsed the MAC header.
      * @retval kThreadError_Parse   Failed to parse through the MAC header.
      *
@@ -738,7 +747,13 @@ private:
     uint8_t *FindSrcPanId(void);
     uint8_t *FindSrcAddr(void);
     uint8_t *FindSecurityHeader(void);
+    ThreadError UpdateLayout(void);
     static uint8_t GetKeySourceLength(uint8_t aKeyIdMode);
+
+    uint8_t mSrcAddrOffset;   ///< Offset of the Source Address within the PSDU.
+    uint8_t mSecurityOffset;  ///< Offset of the Auxiliary Security Header within the PSDU.
+    uint8_t mPayloadOffset;   ///< Offset of the MAC payload within the PSDU (i.e. the MAC header length).
+    uint8_t mFooterLength;    ///< Length of the MIC and FCS.
 } OT_TOOL_PACKED_END;
 
 OT_TOOL_PACKED_BEGIN
@@ -749,22 +749,23 @@ void Commissioner::HandleRelayReceive(Coap::Header &aHeader, Message &aMessage,
     uint16_t offset;
     uint16_t length;
     bool enableJoiner = false;
+    TlvIndex tlvIndex(aMessage);
 
     otLogFuncEntry();
 
     VerifyOrExit(aHeader.GetType() == kCoapTypeNonConfirmable &&
                  aHeader.GetCode() == kCoapRequestPost, ;);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kJoinerUdpPort, sizeof(joinerPort), joinerPort));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kJoinerUdpPort, sizeof(joinerPort), joinerPort));
     VerifyOrExit(joinerPort.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kJoinerIid, sizeof(joinerIid), joinerIid));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kJoinerIid, sizeof(joinerIid), joinerIid));
     VerifyOrExit(joinerIid.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kJoinerRouterLocator, sizeof(joinerRloc), joinerRloc));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kJoinerRouterLocator, sizeof(joinerRloc), joinerRloc));
     VerifyOrExit(joinerRloc.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetValueOffset(aMessage, Tlv::kJoinerDtlsEncapsulation, offset, length));
+    SuccessOrExit(error = tlvIndex.GetValueOffset(Tlv::kJoinerDtlsEncapsulation, offset, length));
     VerifyOrExit(length <= aMessage.GetLength() - offset, error = kThreadError_Parse);
 
     if (!mNetif.GetSecureCoapServer().IsConnectionActive())
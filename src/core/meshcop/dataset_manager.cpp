@@ -349,6 +349,7 @@ ThreadError DatasetManager::Set(Coap::Header &aHeader, Message &aMessage, const
     bool doesAffectConnectivity = false;
     bool doesAffectMasterKey = false;
     StateTlv::State state = StateTlv::kAccept;
+    TlvIndex tlvIndex(aMessage);
 
     ActiveTimestampTlv activeTimestamp;
     PendingTimestampTlv pendingTimestamp;
@@ -382,14 +383,14 @@ ThreadError DatasetManager::Set(Coap::Header &aHeader, Message &aMessage, const
 
     type = (strcmp(mUriSet, OPENTHREAD_URI_ACTIVE_SET) == 0 ? Tlv::kActiveTimestamp : Tlv::kPendingTimestamp);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) != kThreadError_None)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) != kThreadError_None)
     {
         ExitNow(state = StateTlv::kReject);
     }
 
     VerifyOrExit(activeTimestamp.IsValid(), state = StateTlv::kReject);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), state = StateTlv::kReject);
     }
@@ -403,7 +404,7 @@ ThreadError DatasetManager::Set(Coap::Header &aHeader, Message &aMessage, const
                  state = StateTlv::kReject);
 
     // check channel
-    if (Tlv::GetTlv(aMessage, Tlv::kChannel, sizeof(channel), channel) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kChannel, sizeof(channel), channel) == kThreadError_None)
     {
         VerifyOrExit(channel.IsValid() &&
                      channel.GetChannel() >= kPhyMinChannel &&
@@ -417,7 +418,7 @@ ThreadError DatasetManager::Set(Coap::Header &aHeader, Message &aMessage, const
     }
 
     // check PAN ID
-    if (Tlv::GetTlv(aMessage, Tlv::kPanId, sizeof(panId), panId) == kThreadError_None &&
+    if (tlvIndex.Get(Tlv::kPanId, sizeof(panId), panId) == kThreadError_None &&
         panId.IsValid() &&
         panId.GetPanId() != mNetif.GetMac().GetPanId())
     {
@@ -425,7 +426,7 @@ ThreadError DatasetManager::Set(Coap::Header &aHeader, Message &aMessage, const
     }
 
     // check mesh local prefix
-    if (Tlv::GetTlv(aMessage, Tlv::kMeshLocalPrefix, sizeof(meshLocalPrefix), meshLocalPrefix) == kThreadError_None &&
+    if (tlvIndex.Get(Tlv::kMeshLocalPrefix, sizeof(meshLocalPrefix), meshLocalPrefix) == kThreadError_None &&
         memcmp(meshLocalPrefix.GetMeshLocalPrefix(), mNetif.GetMle().GetMeshLocalPrefix(),
                meshLocalPrefix.GetLength()))
     {
@@ -433,7 +434,7 @@ ThreadError DatasetManager::Set(Coap::Header &aHeader, Message &aMessage, const
     }
 
     // check network master key
-    if (Tlv::GetTlv(aMessage, Tlv::kNetworkMasterKey, sizeof(masterKey), masterKey) == kThreadError_None &&
+    if (tlvIndex.Get(Tlv::kNetworkMasterKey, sizeof(masterKey), masterKey) == kThreadError_None &&
         memcmp(masterKey.GetNetworkMasterKey(), mNetif.GetKeyManager().GetMasterKey(NULL),
                masterKey.GetLength()))
     {
@@ -455,7 +456,7 @@ ThreadError DatasetManager::Set(Coap::Header &aHeader, Message &aMessage, const
     }
 
     // check commissioner session id
-    if (Tlv::GetTlv(aMessage, Tlv::kCommissionerSessionId, sizeof(sessionId), sessionId) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kCommissionerSessionId, sizeof(sessionId), sessionId) == kThreadError_None)
     {
         CommissionerSessionIdTlv *localId;
 
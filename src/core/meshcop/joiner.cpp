@@ -384,6 +384,7 @@ void Joiner::HandleJoinerEntrust(void *aContext, otCoapHeader *aHeader, otMessag
 void Joiner::HandleJoinerEntrust(Coap::Header &aHeader, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     ThreadError error;
+    TlvIndex tlvIndex(aMessage);
 
     NetworkMasterKeyTlv masterKey;
     MeshLocalPrefixTlv meshLocalPrefix;
@@ -401,22 +402,22 @@ void Joiner::HandleJoinerEntrust(Coap::Header &aHeader, Message &aMessage, const
     otLogInfoMeshCoP(GetInstance(), "Received joiner entrust");
     otLogCertMeshCoP(GetInstance(), "[THCI] direction=recv | type=JOIN_ENT.ntf");
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kNetworkMasterKey, sizeof(masterKey), masterKey));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kNetworkMasterKey, sizeof(masterKey), masterKey));
     VerifyOrExit(masterKey.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMeshLocalPrefix, sizeof(meshLocalPrefix), meshLocalPrefix));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kMeshLocalPrefix, sizeof(meshLocalPrefix), meshLocalPrefix));
     VerifyOrExit(meshLocalPrefix.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kExtendedPanId, sizeof(extendedPanId), extendedPanId));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kExtendedPanId, sizeof(extendedPanId), extendedPanId));
     VerifyOrExit(extendedPanId.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kNetworkName, sizeof(networkName), networkName));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kNetworkName, sizeof(networkName), networkName));
     VerifyOrExit(networkName.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp));
     VerifyOrExit(activeTimestamp.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kNetworkKeySequence, sizeof(networkKeySeq), networkKeySeq));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kNetworkKeySequence, sizeof(networkKeySeq), networkKeySeq));
     VerifyOrExit(networkKeySeq.IsValid(), error = kThreadError_Parse);
 
     mNetif.GetKeyManager().SetMasterKey(masterKey.GetNetworkMasterKey(), masterKey.GetLength());
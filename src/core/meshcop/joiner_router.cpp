@@ -249,6 +249,7 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
     uint16_t length;
     Message *message = NULL;
     Ip6::MessageInfo messageInfo;
+    TlvIndex tlvIndex(aMessage);
 
     otLogFuncEntry();
     VerifyOrExit(aHeader.GetType() == kCoapTypeNonConfirmable &&
@@ -256,16 +257,15 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
 
     otLogInfoMeshCoP(GetInstance(), "Received relay transmit");
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kJoinerUdpPort, sizeof(joinerPort), joinerPort));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kJoinerUdpPort, sizeof(joinerPort), joinerPort));
     VerifyOrExit(joinerPort.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kJoinerIid, sizeof(joinerIid), joinerIid));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kJoinerIid, sizeof(joinerIid), joinerIid));
     VerifyOrExit(joinerIid.IsValid(), error = kThreadError_Parse);
 
-    SuccessOrExit(error = Tlv::GetValueOffset(aMessage, Tlv::kJoinerDtlsEncapsulation, offset, length));
+    SuccessOrExit(error = tlvIndex.GetValueOffset(Tlv::kJoinerDtlsEncapsulation, offset, length));
 
-    VerifyOrExit((message = mSocket.NewMessage(0)) != NULL, error = kThreadError_NoBufs);
-    message->SetPriority(kMeshCoPMessagePriority);
+    VerifyOrExit((message = mSocket.NewMessage(0, kMeshCoPMessagePriority)) != NULL, error = kThreadError_NoBufs);
     message->SetLinkSecurityEnabled(false);
 
     while (length)
@@ -294,7 +294,7 @@ void JoinerRouter::HandleRelayTransmit(Coap::Header &aHeader, Message &aMessage,
 
     SuccessOrExit(error = mSocket.SendTo(*message, messageInfo));
 
-    if (Tlv::GetTlv(aMessage, Tlv::kJoinerRouterKek, sizeof(kek), kek) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kJoinerRouterKek, sizeof(kek), kek) == kThreadError_None)
     {
         otLogInfoMeshCoP(GetInstance(), "Received kek");
 
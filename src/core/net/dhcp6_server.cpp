@@ -306,19 +306,21 @@ exit:
 
 uint16_t Dhcp6Server::FindOption(Message &aMessage, uint16_t aOffset, uint16_t aLength, Code aCode)
 {
+    Message::Cursor cursor(aMessage, aOffset);
     uint16_t end = aOffset + aLength;
 
-    while (aOffset <= end)
+    while (cursor.GetOffset() <= end)
     {
         Dhcp6Option option;
-        VerifyOrExit(aMessage.Read(aOffset, sizeof(option), &option) == sizeof(option),);
+        uint16_t offset = cursor.GetOffset();
+        VerifyOrExit(aMessage.Read(cursor, sizeof(option), &option) == sizeof(option),);
 
         if (option.GetCode() == aCode)
         {
-            return aOffset;
+            return offset;
         }
 
-        aOffset += sizeof(option) + option.GetLength();
+        cursor.MoveOffset(option.GetLength());
     }
 
 exit:
@@ -35,6 +35,7 @@
 
 #include <common/code_utils.hpp>
 #include <common/debug.hpp>
+#include <common/encoding.hpp>
 #include <common/logging.hpp>
 #include <common/message.hpp>
 #include <net/icmp6.hpp>
@@ -46,6 +47,8 @@
 #include <thread/mle.hpp>
 #include <openthread-instance.h>
 
+using Thread::Encoding::BigEndian::HostSwap16;
+
 namespace Thread {
 namespace Ip6 {
 
@@ -66,7 +69,13 @@ Ip6::Ip6(void):
 
 Message *Ip6::NewMessage(uint16_t reserved)
 {
-    return mMessagePool.New(Message::kTypeIp6, sizeof(Header) + sizeof(HopByHopHeader) + sizeof(OptionMpl) + reserved);
+    return NewMessage(reserved, Message::kPriorityLow);
+}
+
+Message *Ip6::NewMessage(uint16_t aReserved, uint8_t aPriority)
+{
+    return mMessagePool.New(Message::kTypeIp6, sizeof(Header) + sizeof(HopByHopHeader) + sizeof(OptionMpl) + aReserved,
+                            aPriority);
 }
 
 bool Ip6::IsForwardingEnabled(void)
@@ -85,16 +94,43 @@ uint16_t Ip6::UpdateChecksum(uint16_t checksum, uint16_t val)
     return result + (result < checksum);
 }
 
-uint16_t Ip6::UpdateChecksum(uint16_t checksum, const void *buf, uint16_t len)
+uint16_t Ip6::UpdateChecksum(uint16_t aChecksum, const void *aBuf, uint16_t aLength)
 {
-    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(buf);
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(aBuf);
+    uint64_t sum = 0;
+    uint32_t word32;
+    uint16_t word16;
+
+    // The one's complement sum is independent of byte order (RFC 1071), so the buffer is summed as host-order
+    // 32-bit words with the carries folded once at the end, and the result is swapped to network order.
+    for (; aLength >= sizeof(word32); aLength -= sizeof(word32), bytes += sizeof(word32))
+    {
+        memcpy(&word32, bytes, sizeof(word32));
+        sum += word32;
+    }
 
-    for (int i = 0; i < len; i++)
+    if (aLength >= sizeof(word16))
     {
-        checksum = Ip6::UpdateChecksum(checksum, (i & 1) ? bytes[i] : static_cast<uint16_t>(bytes[i] << 8));
+        memcpy(&word16, bytes, sizeof(word16));
+        sum += word16;
+        aLength -= sizeof(word16);
+        bytes += sizeof(word16);
     }
 
-    return checksum;
+    if (aLength > 0)
+    {
+        uint8_t last[sizeof(word16)] = {bytes[0], 0};
+
+        memcpy(&word16, last, sizeof(word16));
+        sum += word16;
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return UpdateChecksum(aChecksum, HostSwap16(static_cast<uint16_t>(sum)));
 }
 
 uint16_t Ip6::UpdateChecksum(uint16_t checksum, const Address &address)
@@ -114,6 +114,17 @@ public:
      */
     Message *NewMessage(uint16_t aReserved);
 
+    /**
+     * This method allocates a new message buffer with a given priority from the buffer pool.
+     *
+     * @param[in]  aReserved  The number of header bytes to reserve following the IPv6 header.
+     * @param[in]  aPriority  The message priority level.
+     *
+     * @returns A pointer to the message or NULL if insufficient message buffers are available.
+     *
+     */
+    Message *NewMessage(uint16_t aReserved, uint8_t aPriority);
+
     /**
      * This constructor initializes the object.
      */
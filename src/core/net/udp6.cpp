@@ -53,6 +53,11 @@ Message *UdpSocket::NewMessage(uint16_t aReserved)
     return static_cast<Udp *>(mTransport)->NewMessage(aReserved);
 }
 
+Message *UdpSocket::NewMessage(uint16_t aReserved, uint8_t aPriority)
+{
+    return static_cast<Udp *>(mTransport)->NewMessage(aReserved, aPriority);
+}
+
 ThreadError UdpSocket::Open(otUdpReceive aHandler, void *aContext)
 {
     memset(&mSockName, 0, sizeof(mSockName));
@@ -180,6 +185,11 @@ Message *Udp::NewMessage(uint16_t aReserved)
     return mIp6.NewMessage(sizeof(UdpHeader) + aReserved);
 }
 
+Message *Udp::NewMessage(uint16_t aReserved, uint8_t aPriority)
+{
+    return mIp6.NewMessage(sizeof(UdpHeader) + aReserved, aPriority);
+}
+
 ThreadError Udp::SendDatagram(Message &aMessage, MessageInfo &aMessageInfo, IpProto aIpProto)
 {
     return mIp6.SendDatagram(aMessage, aMessageInfo, aIpProto);
@@ -80,6 +80,17 @@ public:
      */
     Message *NewMessage(uint16_t aReserved);
 
+    /**
+     * This method returns a new UDP message with a given priority and sufficient header space reserved.
+     *
+     * @param[in]  aReserved  The number of header bytes to reserve after the UDP header.
+     * @param[in]  aPriority  The message priority level.
+     *
+     * @returns A pointer to the message or NULL if no buffers are available.
+     *
+     */
+    Message *NewMessage(uint16_t aReserved, uint8_t aPriority);
+
     /**
      * This method opens the UDP socket.
      *
@@ -203,6 +214,17 @@ public:
      */
     Message *NewMessage(uint16_t aReserved);
 
+    /**
+     * This method returns a new UDP message with a given priority and sufficient header space reserved.
+     *
+     * @param[in]  aReserved  The number of header bytes to reserve after the UDP header.
+     * @param[in]  aPriority  The message priority level.
+     *
+     * @returns A pointer to the message or NULL if no buffers are available.
+     *
+     */
+    Message *NewMessage(uint16_t aReserved, uint8_t aPriority);
+
     /**
      * This method sends an IPv6 datagram.
      *
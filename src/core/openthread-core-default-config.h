@@ -95,6 +95,78 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE                   128
 #endif  // OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+ *
+ * The number of message buffers held back for high priority messages (e.g. MLE).
+ *
+ * Lower priority messages may not allocate a reserved buffer while high priority messages hold fewer than this.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH         4
+#endif  // OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_MEDIUM
+ *
+ * The number of message buffers held back for medium priority messages (e.g. MeshCoP).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_MEDIUM
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_MEDIUM       2
+#endif  // OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_MEDIUM
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_LOW
+ *
+ * The number of message buffers held back for low priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_LOW
+#define OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_LOW          0
+#endif  // OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_LOW
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_HIGH
+ *
+ * The maximum number of message buffers that high priority messages may hold at once.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_HIGH              OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif  // OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_HIGH
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_MEDIUM
+ *
+ * The maximum number of message buffers that medium priority messages may hold at once.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_MEDIUM
+#define OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_MEDIUM            OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif  // OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_MEDIUM
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_LOW
+ *
+ * The maximum number of message buffers that low priority messages may hold at once.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_LOW
+#define OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_LOW               OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif  // OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_LOW
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_VERY_LOW
+ *
+ * The maximum number of message buffers that very low priority messages may hold at once.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_VERY_LOW
+#define OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_VERY_LOW          OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif  // OPENTHREAD_CONFIG_MESSAGE_MAX_BUFFERS_VERY_LOW
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_CHANNEL
  *
@@ -164,11 +236,24 @@
  *
  * The number of EID-to-RLOC cache entries.
  *
+ * Lookups are hashed, so platforms with RAM to spare may raise this up to 255 (the limit of the index used by
+ * `otThreadGetEidCacheEntry()`).
+ *
  */
 #ifndef OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES
 #define OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES                 10
 #endif  // OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES
 
+/**
+ * @def OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM
+ *
+ * The maximum number of expired timers fired from a single platform alarm callback before yielding.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM
+#define OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM            16
+#endif  // OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM
+
 /**
  * @def OPENTHREAD_CONFIG_MAX_CHILDREN
  *
@@ -219,6 +304,26 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT            5
 #endif  // OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES
+ *
+ * The maximum number of 6LoWPAN datagrams that may be reassembled concurrently.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES            4
+#endif  // OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES
+
+/**
+ * @def OPENTHREAD_CONFIG_MESH_RELAY_FLOWS
+ *
+ * The number of fragmented datagrams whose next hop is remembered while relaying mesh frames.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_RELAY_FLOWS
+#define OPENTHREAD_CONFIG_MESH_RELAY_FLOWS                      4
+#endif  // OPENTHREAD_CONFIG_MESH_RELAY_FLOWS
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
@@ -573,6 +678,17 @@
 #define OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE                    512
 #endif  // OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_TX_BUFFER_BULK_WATERMARK
+ *
+ *  The maximum number of bytes of the NCP tx buffer used by bulk data frames (IPv6 datagrams and raw 15.4 frames).
+ *  The rest of the buffer is reserved for control and status frames.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_TX_BUFFER_BULK_WATERMARK
+#define OPENTHREAD_CONFIG_NCP_TX_BUFFER_BULK_WATERMARK          (OPENTHREAD_CONFIG_NCP_TX_BUFFER_SIZE * 3 / 4)
+#endif  // OPENTHREAD_CONFIG_NCP_TX_BUFFER_BULK_WATERMARK
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_UART_TX_CHUNK_SIZE
  *
@@ -593,6 +709,16 @@
 #define OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE               1300
 #endif  // OPENTHREAD_CONFIG_NCP_UART_RX_BUFFER_SIZE
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_UART_FRAME_COALESCING_DEADLINE
+ *
+ *  The default time in milliseconds the NCP UART holds a frame on an idle link to coalesce it with later frames.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_UART_FRAME_COALESCING_DEADLINE
+#define OPENTHREAD_CONFIG_NCP_UART_FRAME_COALESCING_DEADLINE    2
+#endif  // OPENTHREAD_CONFIG_NCP_UART_FRAME_COALESCING_DEADLINE
+
 /**
  * @def OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
  *
@@ -603,6 +729,16 @@
 #define OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE                   1300
 #endif  // OPENTHREAD_CONFIG_NCP_SPI_BUFFER_SIZE
 
+/**
+ * @def OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_4
+ *
+ *  Define as 1 to compute the HDLC FCS four bytes at a time, using 1.5 KB of additional lookup tables.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_4
+#define OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_4               1
+#endif  // OPENTHREAD_CONFIG_NCP_HDLC_FCS_SLICE_BY_4
+
 /**
  * @def OPENTHREAD_CONFIG_PLATFORM_ASSERT_MANAGEMENT
  *
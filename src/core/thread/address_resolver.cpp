@@ -77,10 +77,20 @@ otInstance *AddressResolver::GetInstance()
 void AddressResolver::Clear()
 {
     memset(&mCache, 0, sizeof(mCache));
+    memset(&mCounters, 0, sizeof(mCounters));
 
-    for (uint8_t i = 0; i < kCacheEntries; i++)
+    for (uint16_t i = 0; i < kHashBuckets; i++)
     {
-        mCache[i].mAge = i;
+        mHashTable[i] = kInvalidIndex;
+    }
+
+    mLruHead = kInvalidIndex;
+    mLruTail = kInvalidIndex;
+
+    for (uint16_t i = 0; i < kCacheEntries; i++)
+    {
+        mCache[i].mHashNext = kInvalidIndex;
+        LruAddTail(mCache[i]);
     }
 }
 
@@ -101,32 +111,130 @@ void AddressResolver::Remove(uint8_t routerId)
 {
     for (int i = 0; i < kCacheEntries; i++)
     {
-        if (Mle::Mle::GetRouterId(mCache[i].mRloc16) == routerId)
+        if (mCache[i].mState != Cache::kStateInvalid && Mle::Mle::GetRouterId(mCache[i].mRloc16) == routerId)
         {
             InvalidateCacheEntry(mCache[i]);
         }
     }
 }
 
-AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
+uint16_t AddressResolver::GetHashBucket(const Ip6::Address &aEid)
+{
+    uint32_t hash = aEid.mFields.m32[0] ^ aEid.mFields.m32[1] ^ aEid.mFields.m32[2] ^ aEid.mFields.m32[3];
+
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bu;
+    hash ^= hash >> 16;
+
+    return static_cast<uint16_t>(hash % kHashBuckets);
+}
+
+AddressResolver::Cache *AddressResolver::FindCacheEntry(const Ip6::Address &aEid)
 {
     Cache *rval = NULL;
 
-    for (int i = 0; i < kCacheEntries; i++)
+    for (uint16_t index = mHashTable[GetHashBucket(aEid)]; index != kInvalidIndex; index = mCache[index].mHashNext)
     {
-        if (mCache[i].mState == Cache::kStateQuery && mCache[i].mFailures == 0)
+        if (mCache[index].mTarget == aEid)
         {
-            continue;
+            ExitNow(rval = &mCache[index]);
         }
+    }
+
+exit:
+    return rval;
+}
 
-        if (rval == NULL || rval->mAge < mCache[i].mAge)
+void AddressResolver::AddCacheEntry(Cache &aEntry)
+{
+    uint16_t bucket = GetHashBucket(aEntry.mTarget);
+
+    aEntry.mHashNext = mHashTable[bucket];
+    mHashTable[bucket] = GetIndex(aEntry);
+}
+
+void AddressResolver::LruRemove(Cache &aEntry)
+{
+    if (aEntry.mLruPrev != kInvalidIndex)
+    {
+        mCache[aEntry.mLruPrev].mLruNext = aEntry.mLruNext;
+    }
+    else
+    {
+        mLruHead = aEntry.mLruNext;
+    }
+
+    if (aEntry.mLruNext != kInvalidIndex)
+    {
+        mCache[aEntry.mLruNext].mLruPrev = aEntry.mLruPrev;
+    }
+    else
+    {
+        mLruTail = aEntry.mLruPrev;
+    }
+}
+
+void AddressResolver::LruAddHead(Cache &aEntry)
+{
+    uint16_t index = GetIndex(aEntry);
+
+    aEntry.mLruPrev = kInvalidIndex;
+    aEntry.mLruNext = mLruHead;
+
+    if (mLruHead != kInvalidIndex)
+    {
+        mCache[mLruHead].mLruPrev = index;
+    }
+    else
+    {
+        mLruTail = index;
+    }
+
+    mLruHead = index;
+}
+
+void AddressResolver::LruAddTail(Cache &aEntry)
+{
+    uint16_t index = GetIndex(aEntry);
+
+    aEntry.mLruPrev = mLruTail;
+    aEntry.mLruNext = kInvalidIndex;
+
+    if (mLruTail != kInvalidIndex)
+    {
+        mCache[mLruTail].mLruNext = index;
+    }
+    else
+    {
+        mLruHead = index;
+    }
+
+    mLruTail = index;
+}
+
+AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
+{
+    Cache *rval = NULL;
+
+    // Invalid entries are kept at the tail of the LRU list, so this normally stops at the first entry.
+    for (uint16_t index = mLruTail; index != kInvalidIndex; index = mCache[index].mLruPrev)
+    {
+        if (mCache[index].mState == Cache::kStateQuery && mCache[index].mFailures == 0)
         {
-            rval = &mCache[i];
+            continue;
         }
+
+        rval = &mCache[index];
+        break;
     }
 
     if (rval != NULL)
     {
+        if (rval->mState == Cache::kStateCached)
+        {
+            mCounters.mEvictions++;
+        }
+
         InvalidateCacheEntry(*rval);
     }
 
@@ -135,28 +243,31 @@ AddressResolver::Cache *AddressResolver::NewCacheEntry(void)
 
 void AddressResolver::MarkCacheEntryAsUsed(Cache &aEntry)
 {
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mAge < aEntry.mAge)
-        {
-            mCache[i].mAge++;
-        }
-    }
-
-    aEntry.mAge = 0;
+    LruRemove(aEntry);
+    LruAddHead(aEntry);
 }
 
 void AddressResolver::InvalidateCacheEntry(Cache &aEntry)
 {
-    for (int i = 0; i < kCacheEntries; i++)
+    if (aEntry.mState != Cache::kStateInvalid)
     {
-        if (mCache[i].mAge > aEntry.mAge)
+        uint16_t *link = &mHashTable[GetHashBucket(aEntry.mTarget)];
+
+        while (*link != kInvalidIndex && &mCache[*link] != &aEntry)
+        {
+            link = &mCache[*link].mHashNext;
+        }
+
+        if (*link != kInvalidIndex)
         {
-            mCache[i].mAge--;
+            *link = aEntry.mHashNext;
         }
+
+        aEntry.mHashNext = kInvalidIndex;
     }
 
-    aEntry.mAge = kCacheEntries - 1;
+    LruRemove(aEntry);
+    LruAddTail(aEntry);
     aEntry.mState = Cache::kStateInvalid;
     otLogInfoArp(GetInstance(), "cache entry removed!");
 }
@@ -164,19 +275,7 @@ void AddressResolver::InvalidateCacheEntry(Cache &aEntry)
 ThreadError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16)
 {
     ThreadError error = kThreadError_None;
-    Cache *entry = NULL;
-
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState != Cache::kStateInvalid)
-        {
-            if (memcmp(&mCache[i].mTarget, &aEid, sizeof(mCache[i].mTarget)) == 0)
-            {
-                entry = &mCache[i];
-                break;
-            }
-        }
-    }
+    Cache *entry = FindCacheEntry(aEid);
 
     if (entry == NULL)
     {
@@ -194,6 +293,7 @@ ThreadError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16
         entry->mFailures = 0;
         entry->mRetryTimeout = kAddressQueryInitialRetryDelay;
         entry->mState = Cache::kStateQuery;
+        AddCacheEntry(*entry);
         SendAddressQuery(aEid);
         error = kThreadError_AddressQuery;
         break;
@@ -223,6 +323,16 @@ ThreadError AddressResolver::Resolve(const Ip6::Address &aEid, uint16_t &aRloc16
     }
 
 exit:
+
+    if (error == kThreadError_None)
+    {
+        mCounters.mHits++;
+    }
+    else
+    {
+        mCounters.mMisses++;
+    }
+
     return error;
 }
 
@@ -285,6 +395,7 @@ void AddressResolver::HandleAddressNotification(Coap::Header &aHeader, Message &
     ThreadRloc16Tlv rloc16Tlv;
     ThreadLastTransactionTimeTlv lastTransactionTimeTlv;
     uint32_t lastTransactionTime;
+    Cache *entry;
 
     VerifyOrExit(aHeader.GetType() == kCoapTypeConfirmable &&
                  aHeader.GetCode() == kCoapRequestPost, ;);
@@ -310,50 +421,44 @@ void AddressResolver::HandleAddressNotification(Coap::Header &aHeader, Message &
         lastTransactionTime = lastTransactionTimeTlv.GetTime();
     }
 
-    for (int i = 0; i < kCacheEntries; i++)
+    VerifyOrExit((entry = FindCacheEntry(*targetTlv.GetTarget())) != NULL, ;);
+
+    switch (entry->mState)
     {
-        if (mCache[i].mTarget != *targetTlv.GetTarget())
+    case Cache::kStateInvalid:
+        break;
+
+    case Cache::kStateCached:
+        if (memcmp(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid)) != 0)
         {
-            continue;
+            SendAddressError(targetTlv, mlIidTlv, NULL);
+            ExitNow();
         }
 
-        switch (mCache[i].mState)
+        if (lastTransactionTime >= entry->mLastTransactionTime)
         {
-        case Cache::kStateInvalid:
-            break;
-
-        case Cache::kStateCached:
-            if (memcmp(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid)) != 0)
-            {
-                SendAddressError(targetTlv, mlIidTlv, NULL);
-                ExitNow();
-            }
-
-            if (lastTransactionTime >= mCache[i].mLastTransactionTime)
-            {
-                ExitNow();
-            }
-
-        // fall through
+            ExitNow();
+        }
 
-        case Cache::kStateQuery:
-            memcpy(mCache[i].mMeshLocalIid, mlIidTlv.GetIid(), sizeof(mCache[i].mMeshLocalIid));
-            mCache[i].mRloc16 = rloc16Tlv.GetRloc16();
-            mCache[i].mRetryTimeout = 0;
-            mCache[i].mLastTransactionTime = lastTransactionTime;
-            mCache[i].mTimeout = 0;
-            mCache[i].mFailures = 0;
-            mCache[i].mState = Cache::kStateCached;
-            MarkCacheEntryAsUsed(mCache[i]);
+    // fall through
 
-            if (mNetif.GetCoapServer().SendEmptyAck(aHeader, aMessageInfo) == kThreadError_None)
-            {
-                otLogInfoArp(GetInstance(), "Sent address notification acknowledgment");
-            }
+    case Cache::kStateQuery:
+        memcpy(entry->mMeshLocalIid, mlIidTlv.GetIid(), sizeof(entry->mMeshLocalIid));
+        entry->mRloc16 = rloc16Tlv.GetRloc16();
+        entry->mRetryTimeout = 0;
+        entry->mLastTransactionTime = lastTransactionTime;
+        entry->mTimeout = 0;
+        entry->mFailures = 0;
+        entry->mState = Cache::kStateCached;
+        MarkCacheEntryAsUsed(*entry);
 
-            mNetif.GetMeshForwarder().HandleResolved(*targetTlv.GetTarget(), kThreadError_None);
-            break;
+        if (mNetif.GetCoapServer().SendEmptyAck(aHeader, aMessageInfo) == kThreadError_None)
+        {
+            otLogInfoArp(GetInstance(), "Sent address notification acknowledgment");
         }
+
+        mNetif.GetMeshForwarder().HandleResolved(*targetTlv.GetTarget(), kThreadError_None);
+        break;
     }
 
 exit:
@@ -666,20 +771,14 @@ void AddressResolver::HandleIcmpReceive(Message &aMessage, const Ip6::MessageInf
                                         const Ip6::IcmpHeader &aIcmpHeader)
 {
     Ip6::Header ip6Header;
+    Cache *entry;
 
     VerifyOrExit(aIcmpHeader.GetType() == kIcmp6TypeDstUnreach, ;);
     VerifyOrExit(aIcmpHeader.GetCode() == kIcmp6CodeDstUnreachNoRoute, ;);
     VerifyOrExit(aMessage.Read(aMessage.GetOffset(), sizeof(ip6Header), &ip6Header) == sizeof(ip6Header), ;);
+    VerifyOrExit((entry = FindCacheEntry(ip6Header.GetDestination())) != NULL, ;);
 
-    for (int i = 0; i < kCacheEntries; i++)
-    {
-        if (mCache[i].mState != Cache::kStateInvalid &&
-            memcmp(&mCache[i].mTarget, &ip6Header.GetDestination(), sizeof(mCache[i].mTarget)) == 0)
-        {
-            InvalidateCacheEntry(mCache[i]);
-            break;
-        }
-    }
+    InvalidateCacheEntry(*entry);
 
 exit:
     (void)aMessageInfo;
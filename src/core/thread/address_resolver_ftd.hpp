@@ -38,6 +38,10 @@
 
 #include "openthread/types.h"
 
+#if OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES > 255
+#error "OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES must not exceed 255 (entries are indexed by uint8_t in the API)."
+#endif
+
 #include <coap/coap_client.hpp>
 #include <coap/coap_server.hpp>
 #include <common/timer.hpp>
@@ -101,6 +105,16 @@ public:
      */
     ThreadError GetEntry(uint8_t aIndex, otEidCacheEntry &aEntry) const;
 
+    /**
+     * This method gets the EID-to-RLOC cache counters.
+     *
+     * @param[out]  aCounters  A reference to where the counters are placed.
+     *
+     * @retval kThreadError_None  Successfully retrieved the counters.
+     *
+     */
+    ThreadError GetCounters(otEidCacheCounters &aCounters) const { aCounters = mCounters; return kThreadError_None; }
+
     /**
      * This method removes a Router ID from the EID-to-RLOC cache.
      *
@@ -125,6 +139,8 @@ private:
     enum
     {
         kCacheEntries = OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES,
+        kHashBuckets = OPENTHREAD_CONFIG_ADDRESS_CACHE_ENTRIES,
+        kInvalidIndex = 0xffff,
         kStateUpdatePeriod = 1000u,           ///< State update period in milliseconds.
     };
 
@@ -148,7 +164,9 @@ private:
         uint16_t          mRetryTimeout;
         uint8_t           mTimeout;
         uint8_t           mFailures;
-        uint8_t           mAge;
+        uint16_t          mHashNext;          ///< Next entry in the same hash bucket.
+        uint16_t          mLruPrev;           ///< Previous (more recently used) entry.
+        uint16_t          mLruNext;           ///< Next (less recently used) entry.
 
         enum State
         {
@@ -160,9 +178,17 @@ private:
     };
 
     Cache *NewCacheEntry(void);
+    Cache *FindCacheEntry(const Ip6::Address &aEid);
+    void AddCacheEntry(Cache &aEntry);
     void MarkCacheEntryAsUsed(Cache &aEntry);
     void InvalidateCacheEntry(Cache &aEntry);
 
+    uint16_t GetIndex(const Cache &aEntry) const { return static_cast<uint16_t>(&aEntry - mCache); }
+    static uint16_t GetHashBucket(const Ip6::Address &aEid);
+    void LruRemove(Cache &aEntry);
+    void LruAddHead(Cache &aEntry);
+    void LruAddTail(Cache &aEntry);
+
     ThreadError SendAddressQuery(const Ip6::Address &aEid);
     ThreadError SendAddressError(const ThreadTargetTlv &aTarget, const ThreadMeshLocalEidTlv &aEid,
                                  const Ip6::Address *aDestination);
@@ -195,6 +221,10 @@ private:
     Coap::Resource mAddressQuery;
     Coap::Resource mAddressNotification;
     Cache mCache[kCacheEntries];
+    uint16_t mHashTable[kHashBuckets];
+    uint16_t mLruHead;
+    uint16_t mLruTail;
+    otEidCacheCounters mCounters;
     Ip6::IcmpHandler mIcmpHandler;
     Timer mTimer;
 
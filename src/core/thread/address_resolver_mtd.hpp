@@ -44,6 +44,7 @@ public:
     explicit AddressResolver(ThreadNetif &) { }
     void Clear(void) { }
     ThreadError GetEntry(uint8_t, otEidCacheEntry &) const { return kThreadError_NotImplemented; }
+    ThreadError GetCounters(otEidCacheCounters &) const { return kThreadError_NotImplemented; }
     void Remove(uint8_t) { }
     ThreadError Resolve(const Ip6::Address &, Mac::ShortAddress &) { return kThreadError_NotImplemented; }
 };
@@ -84,19 +84,20 @@ void EnergyScanServer::HandleRequest(Coap::Header &aHeader, Message &aMessage, c
     MeshCoP::ScanDurationTlv scanDuration;
     MeshCoP::ChannelMask0Tlv channelMask;
     Ip6::MessageInfo responseInfo(aMessageInfo);
+    TlvIndex tlvIndex(aMessage);
 
     VerifyOrExit(aHeader.GetCode() == kCoapRequestPost, ;);
 
-    SuccessOrExit(MeshCoP::Tlv::GetTlv(aMessage, MeshCoP::Tlv::kCount, sizeof(count), count));
+    SuccessOrExit(tlvIndex.Get(MeshCoP::Tlv::kCount, sizeof(count), count));
     VerifyOrExit(count.IsValid(), ;);
 
-    SuccessOrExit(MeshCoP::Tlv::GetTlv(aMessage, MeshCoP::Tlv::kPeriod, sizeof(period), period));
+    SuccessOrExit(tlvIndex.Get(MeshCoP::Tlv::kPeriod, sizeof(period), period));
     VerifyOrExit(period.IsValid(), ;);
 
-    SuccessOrExit(MeshCoP::Tlv::GetTlv(aMessage, MeshCoP::Tlv::kScanDuration, sizeof(scanDuration), scanDuration));
+    SuccessOrExit(tlvIndex.Get(MeshCoP::Tlv::kScanDuration, sizeof(scanDuration), scanDuration));
     VerifyOrExit(scanDuration.IsValid(), ;);
 
-    SuccessOrExit(MeshCoP::Tlv::GetTlv(aMessage, MeshCoP::Tlv::kChannelMask, sizeof(channelMask), channelMask));
+    SuccessOrExit(tlvIndex.Get(MeshCoP::Tlv::kChannelMask, sizeof(channelMask), channelMask));
     VerifyOrExit(channelMask.IsValid(), ;);
 
     mChannelMask = channelMask.GetMask();
@@ -31,7 +31,10 @@
  *   This file implements Thread security material generation.
  */
 
+#include <string.h>
+
 #include <common/code_utils.hpp>
+#include <common/debug.hpp>
 #include <common/timer.hpp>
 #include <crypto/hmac_sha256.hpp>
 #include <thread/key_manager.hpp>
@@ -60,6 +63,9 @@ KeyManager::KeyManager(ThreadNetif &aThreadNetif):
     mKekFrameCounter(0),
     mSecurityPolicyFlags(0xff)
 {
+    memset(mKek, 0, sizeof(mKek));
+    mKekContext.SetKey(mKek, 8 * sizeof(mKek));
+    InvalidateKeyContexts(true);
 }
 
 void KeyManager::Start(void)
@@ -97,6 +103,7 @@ ThreadError KeyManager::SetMasterKey(const void *aKey, uint8_t aKeyLength)
     mMasterKeyLength = aKeyLength;
     mKeySequence = 0;
     ComputeKey(mKeySequence, mKey);
+    InvalidateKeyContexts(true);
 
     // reset parent frame counters
     routers = mNetif.GetMle().GetParent();
@@ -190,6 +197,7 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
 
     mKeySequence = aKeySequence;
     ComputeKey(mKeySequence, mKey);
+    InvalidateKeyContexts(false);
 
     mMacFrameCounter = 0;
     mMleFrameCounter = 0;
@@ -218,14 +226,72 @@ const uint8_t *KeyManager::GetCurrentMleKey(void) const
 
 const uint8_t *KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey + 16;
+    return GetKeyContext(aKeySequence).mKey + 16;
 }
 
 const uint8_t *KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    ComputeKey(aKeySequence, mTemporaryKey);
-    return mTemporaryKey;
+    return GetKeyContext(aKeySequence).mKey;
+}
+
+bool KeyManager::IsKeySequenceCached(uint32_t aKeySequence) const
+{
+    // True for the previous, current and next key sequence, including when the sequence wraps.
+    return static_cast<uint32_t>(aKeySequence - (mKeySequence - 1)) <= 2;
+}
+
+void KeyManager::InvalidateKeyContexts(bool aAll)
+{
+    for (uint8_t i = 0; i < kNumKeyContexts; i++)
+    {
+        if (aAll || !IsKeySequenceCached(mKeyContexts[i].mKeySequence))
+        {
+            mKeyContexts[i].mValid = false;
+        }
+    }
+}
+
+KeyManager::KeyContext &KeyManager::GetKeyContext(uint32_t aKeySequence)
+{
+    KeyContext *context = NULL;
+
+    for (uint8_t i = 0; i < kNumKeyContexts; i++)
+    {
+        if (mKeyContexts[i].mValid && mKeyContexts[i].mKeySequence == aKeySequence)
+        {
+            ExitNow(context = &mKeyContexts[i]);
+        }
+    }
+
+    // Reuse an entry that does not hold the previous, current or next key sequence. Since at most three
+    // entries hold those, one is always available.
+    for (uint8_t i = 0; i < kNumKeyContexts; i++)
+    {
+        if (!mKeyContexts[i].mValid || !IsKeySequenceCached(mKeyContexts[i].mKeySequence))
+        {
+            context = &mKeyContexts[i];
+            break;
+        }
+    }
+
+    assert(context != NULL);
+
+    if (aKeySequence == mKeySequence)
+    {
+        memcpy(context->mKey, mKey, sizeof(context->mKey));
+    }
+    else
+    {
+        ComputeKey(aKeySequence, context->mKey);
+    }
+
+    context->mMleKey.SetKey(context->mKey, 128);
+    context->mMacKey.SetKey(context->mKey + 16, 128);
+    context->mKeySequence = aKeySequence;
+    context->mValid = true;
+
+exit:
+    return *context;
 }
 
 uint32_t KeyManager::GetMacFrameCounter(void) const
@@ -286,6 +352,7 @@ const uint8_t *KeyManager::GetKek(void) const
 void KeyManager::SetKek(const uint8_t *aKek)
 {
     memcpy(mKek, aKek, sizeof(mKek));
+    mKekContext.SetKey(mKek, 8 * sizeof(mKek));
     mKekFrameCounter = 0;
 }
 
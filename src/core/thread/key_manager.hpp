@@ -39,6 +39,7 @@
 #include "openthread/types.h"
 
 #include <common/timer.hpp>
+#include <crypto/aes_ecb.hpp>
 #include <crypto/hmac_sha256.hpp>
 
 namespace Thread {
@@ -156,6 +157,32 @@ public:
      */
     const uint8_t *GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the expanded AES key schedule of the MAC key for the given key sequence.
+     *
+     * The key schedules of the previous, current and next key sequence are cached, so only the first frame
+     * secured with one of them pays for the key derivation and expansion.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A reference to the AES-ECB context holding the MAC key schedule.
+     *
+     */
+    Crypto::AesEcb &GetMacKeyContext(uint32_t aKeySequence) { return GetKeyContext(aKeySequence).mMacKey; }
+
+    /**
+     * This method returns the expanded AES key schedule of the MLE key for the given key sequence.
+     *
+     * The key schedules of the previous, current and next key sequence are cached, so only the first message
+     * secured with one of them pays for the key derivation and expansion.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns A reference to the AES-ECB context holding the MLE key schedule.
+     *
+     */
+    Crypto::AesEcb &GetMleKeyContext(uint32_t aKeySequence) { return GetKeyContext(aKeySequence).mMleKey; }
+
     /**
      * This method returns the current MAC Frame Counter value.
      *
@@ -232,6 +259,14 @@ public:
      */
     void SetKek(const uint8_t *aKek);
 
+    /**
+     * This method returns the expanded AES key schedule of the KEK.
+     *
+     * @returns A reference to the AES-ECB context holding the KEK schedule.
+     *
+     */
+    Crypto::AesEcb &GetKekContext(void) { return mKekContext; }
+
     /**
      * This method returns the current KEK Frame Counter value.
      *
@@ -318,9 +353,26 @@ private:
         kMaxKeyRotationTime = 0xffffffff / 3600u / 1000u,
         kDefaultKeyRotationTime = 672,
         kDefaultKeySwitchGuardTime = 624,
+        kNumKeyContexts = 4,  ///< Previous, current and next key sequence plus one for any other key sequence.
+    };
+
+    /**
+     * This structure holds the keys derived for one key sequence along with their expanded AES key schedules.
+     *
+     */
+    struct KeyContext
+    {
+        uint32_t mKeySequence;
+        bool mValid;
+        uint8_t mKey[Crypto::HmacSha256::kHashSize];
+        Crypto::AesEcb mMleKey;
+        Crypto::AesEcb mMacKey;
     };
 
     ThreadError ComputeKey(uint32_t aKeySequence, uint8_t *aKey);
+    KeyContext &GetKeyContext(uint32_t aKeySequence);
+    bool IsKeySequenceCached(uint32_t aKeySequence) const;
+    void InvalidateKeyContexts(bool aAll);
 
     static void HandleKeyRotationTimer(void *aContext);
     void HandleKeyRotationTimer(void);
@@ -333,7 +385,7 @@ private:
     uint32_t mKeySequence;
     uint8_t mKey[Crypto::HmacSha256::kHashSize];
 
-    uint8_t mTemporaryKey[Crypto::HmacSha256::kHashSize];
+    KeyContext mKeyContexts[kNumKeyContexts];
 
     uint32_t mMacFrameCounter;
     uint32_t mMleFrameCounter;
@@ -346,6 +398,7 @@ private:
     Timer    mKeyRotationTimer;
 
     uint8_t mKek[kMaxKeyLength];
+    Crypto::AesEcb mKekContext;
     uint32_t mKekFrameCounter;
 
     uint8_t mSecurityPolicyFlags;
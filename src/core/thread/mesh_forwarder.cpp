@@ -33,6 +33,8 @@
 
 #define WPP_NAME "mesh_forwarder.tmh"
 
+#include <string.h>
+
 #include "openthread/platform/random.h"
 
 #include <common/code_utils.hpp>
@@ -60,6 +62,10 @@ MeshForwarder::MeshForwarder(ThreadNetif &aThreadNetif):
     mDiscoverTimer(aThreadNetif.GetIp6().mTimerScheduler, &MeshForwarder::HandleDiscoverTimer, this),
     mPollTimer(aThreadNetif.GetIp6().mTimerScheduler, &MeshForwarder::HandlePollTimer, this),
     mReassemblyTimer(aThreadNetif.GetIp6().mTimerScheduler, &MeshForwarder::HandleReassemblyTimer, this),
+    mBroadcastMessages(NULL),
+    mRelayFlowNext(0),
+    mRelayTurn(false),
+    mSendSequence(0),
     mMessageNextOffset(0),
     mPollPeriod(0),
     mAssignPollPeriod(0),
@@ -89,6 +95,19 @@ MeshForwarder::MeshForwarder(ThreadNetif &aThreadNetif):
     mNetif.GetMac().RegisterReceiver(mMacReceiver);
     mMacSource.mLength = 0;
     mMacDest.mLength = 0;
+    memset(mChildMessages, 0, sizeof(mChildMessages));
+    memset(mChildBroadcast, 0, sizeof(mChildBroadcast));
+    memset(mIndirectChildren, 0, sizeof(mIndirectChildren));
+    memset(mDataPollChildren, 0, sizeof(mDataPollChildren));
+    memset(mReassemblyEntries, 0, sizeof(mReassemblyEntries));
+    memset(&mReassemblyCounters, 0, sizeof(mReassemblyCounters));
+
+    for (int i = 0; i < kRelayFlows; i++)
+    {
+        mRelayFlows[i].mNextHop = Mac::kShortAddrInvalid;
+    }
+
+    mNetif.GetIp6().mMessagePool.SetEvictHandler(&MeshForwarder::HandleEvictMessage, this);
 }
 
 otInstance *MeshForwarder::GetInstance()
@@ -132,12 +151,36 @@ ThreadError MeshForwarder::Stop(void)
         message->Free();
     }
 
-    while ((message = mReassemblyList.GetHead()) != NULL)
+    while ((message = mIndirectSendQueue.GetHead()) != NULL)
+    {
+        mIndirectSendQueue.Dequeue(*message);
+        message->Free();
+    }
+
+    memset(mChildMessages, 0, sizeof(mChildMessages));
+    memset(mChildBroadcast, 0, sizeof(mChildBroadcast));
+    mBroadcastMessages = NULL;
+    memset(mIndirectChildren, 0, sizeof(mIndirectChildren));
+
+    while ((message = mRelayQueue.GetHead()) != NULL)
     {
-        mReassemblyList.Dequeue(*message);
+        mRelayQueue.Dequeue(*message);
         message->Free();
     }
 
+    for (int i = 0; i < kReassemblyEntries; i++)
+    {
+        if (mReassemblyEntries[i].mMessage != NULL)
+        {
+            FreeReassemblyEntry(mReassemblyEntries[i]);
+        }
+    }
+
+    for (int i = 0; i < kRelayFlows; i++)
+    {
+        mRelayFlows[i].mNextHop = Mac::kShortAddrInvalid;
+    }
+
     mEnabled = false;
     mSendMessage = NULL;
     mNetif.GetMac().SetRxOnWhenIdle(false);
@@ -187,15 +230,12 @@ void MeshForwarder::HandleResolved(const Ip6::Address &aEid, ThreadError aError)
 
 void MeshForwarder::ClearChildIndirectMessages(Child &aChild)
 {
-    Message *nextMessage;
-
-    VerifyOrExit(aChild.mQueuedIndirectMessageCnt > 0,);
+    uint8_t childIndex = mNetif.GetMle().GetChildIndex(aChild);
+    Message *message;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = nextMessage)
+    while ((message = GetNextIndirectMessage(childIndex)) != NULL)
     {
-        nextMessage = message->GetNext();
-
-        message->ClearChildMask(mNetif.GetMle().GetChildIndex(aChild));
+        RemoveIndirectMessage(*message, childIndex);
 
         if (!message->IsChildPending() && !message->GetDirectTransmission())
         {
@@ -204,11 +244,13 @@ void MeshForwarder::ClearChildIndirectMessages(Child &aChild)
                 mSendMessage = NULL;
             }
 
-            mSendQueue.Dequeue(*message);
+            message->GetPriorityQueue()->Dequeue(*message);
             message->Free();
         }
     }
 
+    VerifyOrExit(aChild.mQueuedIndirectMessageCnt > 0,);
+
     aChild.mQueuedIndirectMessageCnt = 0;
     ClearSrcMatchEntry(aChild);
 
@@ -223,17 +265,66 @@ void MeshForwarder::UpdateIndirectMessages(void)
 
     children = mNetif.GetMle().GetChildren(&numChildren);
 
-    for (uint8_t i = 0; i < numChildren; i++)
+    for (uint8_t i = GetNextChildIndex(mIndirectChildren, 0); i < numChildren;
+         i = GetNextChildIndex(mIndirectChildren, i + 1))
     {
-        Child *child = &children[i];
+        if (!children[i].IsStateValidOrRestoring())
+        {
+            ClearChildIndirectMessages(children[i]);
+        }
+    }
+}
+
+bool MeshForwarder::HandleEvictMessage(void *aContext, Message &aMessage)
+{
+    return static_cast<MeshForwarder *>(aContext)->HandleEvictMessage(aMessage);
+}
 
-        if (child->IsStateValidOrRestoring() || child->mQueuedIndirectMessageCnt == 0)
+bool MeshForwarder::HandleEvictMessage(Message &aMessage)
+{
+    bool evicted = false;
+    Child *children;
+    uint8_t numChildren;
+
+    // Only queues that are never walked across a message allocation are eligible, and never the frame in flight.
+    VerifyOrExit(&aMessage != mSendMessage, ;);
+
+    if (aMessage.GetMessageQueue() == &mReassemblyList)
+    {
+        for (int i = 0; i < kReassemblyEntries; i++)
         {
-            continue;
+            if (mReassemblyEntries[i].mMessage == &aMessage)
+            {
+                mReassemblyCounters.mFailEvicted++;
+                FreeReassemblyEntry(mReassemblyEntries[i]);
+                ExitNow(evicted = true);
+            }
+        }
+    }
+    else if (aMessage.GetMessageQueue() == &mRelayQueue)
+    {
+        mRelayQueue.Dequeue(aMessage);
+        aMessage.Free();
+        ExitNow(evicted = true);
+    }
+    else if (aMessage.GetPriorityQueue() == &mIndirectSendQueue)
+    {
+        children = mNetif.GetMle().GetChildren(&numChildren);
+
+        // A message partway through an indirect transmission is left alone.
+        for (uint8_t i = 0; i < numChildren; i++)
+        {
+            VerifyOrExit(children[i].mIndirectSendInfo.mMessage != &aMessage, ;);
         }
 
-        ClearChildIndirectMessages(*child);
+        RemoveIndirectMessage(aMessage);
+        mIndirectSendQueue.Dequeue(aMessage);
+        aMessage.Free();
+        ExitNow(evicted = true);
     }
+
+exit:
+    return evicted;
 }
 
 void MeshForwarder::ScheduleTransmissionTask(void *aContext)
@@ -255,12 +346,15 @@ void MeshForwarder::ScheduleTransmissionTask(void)
 
     children = mNetif.GetMle().GetChildren(&numChildren);
 
-    for (int i = 0; i < numChildren; i++)
+    for (uint8_t i = GetNextChildIndex(mDataPollChildren, 0); i < numChildren;
+         i = GetNextChildIndex(mDataPollChildren, i + 1))
     {
         Child &child = children[i];
 
         if (!child.IsStateValidOrRestoring() || !child.mDataRequest)
         {
+            // The child was removed or reset since its data poll was received.
+            mDataPollChildren[i / 8] &= ~(0x80 >> (i % 8));
             continue;
         }
 
@@ -302,8 +396,22 @@ void MeshForwarder::ScheduleTransmissionTask(void)
         ExitNow();
     }
 
-    if ((mSendMessage = GetDirectTransmission()) != NULL)
+    // Alternate between relayed mesh frames and other direct transmissions when both are pending.
+    mSendMessage = mRelayTurn ? GetRelayTransmission() : NULL;
+
+    if (mSendMessage == NULL)
+    {
+        mSendMessage = GetDirectTransmission();
+    }
+
+    if (mSendMessage == NULL)
     {
+        mSendMessage = GetRelayTransmission();
+    }
+
+    if (mSendMessage != NULL)
+    {
+        mRelayTurn = (mSendMessage->GetMessageQueue() != &mRelayQueue);
         mNetif.GetMac().SendFrameRequest(mMacSender);
         mSendMessageMaxMacTxAttempts = Mac::kDirectFrameMacTxAttempts;
         ExitNow();
@@ -455,6 +563,7 @@ ThreadError MeshForwarder::SendMessage(Message &aMessage)
 
     uint8_t numChildren;
     Child *children;
+    bool broadcast = false;
 
     switch (aMessage.GetType())
     {
@@ -475,6 +584,7 @@ ThreadError MeshForwarder::SendMessage(Message &aMessage)
             if (aMessage.GetSubType() != Message::kSubTypeMplRetransmission)
             {
                 // destined for all sleepy children
+                broadcast = true;
                 children = mNetif.GetMle().GetChildren(&numChildren);
 
                 for (uint8_t i = 0; i < numChildren; i++)
@@ -540,7 +650,14 @@ ThreadError MeshForwarder::SendMessage(Message &aMessage)
 
     aMessage.SetOffset(0);
     aMessage.SetDatagramTag(0);
-    SuccessOrExit(error = mSendQueue.Enqueue(aMessage));
+    aMessage.SetSendSequence(mSendSequence++);
+    SuccessOrExit(error = (aMessage.GetDirectTransmission() ? mSendQueue : mIndirectSendQueue).Enqueue(aMessage));
+
+    if (aMessage.IsChildPending())
+    {
+        AddIndirectMessage(aMessage, broadcast);
+    }
+
     mScheduleTransmissionTask.Post();
 
 exit:
@@ -587,6 +704,7 @@ Message *MeshForwarder::GetDirectTransmission()
 
         case kThreadError_Drop:
         case kThreadError_NoBufs:
+            RemoveIndirectMessage(*curMessage);
             mSendQueue.Dequeue(*curMessage);
             curMessage->Free();
             continue;
@@ -601,17 +719,41 @@ exit:
     return curMessage;
 }
 
-Message *MeshForwarder::GetIndirectTransmission(Child &aChild)
+Message *MeshForwarder::GetRelayTransmission(void)
 {
-    Message *message = NULL;
-    uint8_t childIndex = mNetif.GetMle().GetChildIndex(aChild);
+    Message *message;
 
-    for (message = mSendQueue.GetHead(); message; message = message->GetNext())
+    while ((message = mRelayQueue.GetHead()) != NULL)
     {
-        if (message->GetChildMask(childIndex))
+        if (mNetif.GetMle().GetNeighbor(message->GetMeshNextHop()) != NULL)
         {
             break;
         }
+
+        // The next hop is no longer a neighbor.
+        mRelayQueue.Dequeue(*message);
+        message->Free();
+    }
+
+    VerifyOrExit(message != NULL, ;);
+
+    mMacDest.mLength = sizeof(mMacDest.mShortAddress);
+    mMacDest.mShortAddress = message->GetMeshNextHop();
+    mMacSource.mLength = sizeof(mMacSource.mShortAddress);
+    mMacSource.mShortAddress = mNetif.GetMac().GetShortAddress();
+    mAddMeshHeader = true;
+
+exit:
+    return message;
+}
+
+Message *MeshForwarder::GetIndirectTransmission(Child &aChild)
+{
+    Message *message = NULL;
+
+    if (aChild.mQueuedIndirectMessageCnt > 0)
+    {
+        message = GetNextIndirectMessage(mNetif.GetMle().GetChildIndex(aChild));
     }
 
     aChild.mIndirectSendInfo.mMessage = message;
@@ -621,6 +763,198 @@ Message *MeshForwarder::GetIndirectTransmission(Child &aChild)
     return message;
 }
 
+void MeshForwarder::AddIndirectMessage(Message &aMessage, bool aBroadcast)
+{
+    aMessage.SetBroadcastIndirect(aBroadcast);
+
+    if (aBroadcast)
+    {
+        InsertIndirectMessage(mBroadcastMessages, aMessage);
+    }
+
+    for (uint8_t i = 0; i < Mle::kMaxChildren; i++)
+    {
+        if (!aMessage.GetChildMask(i))
+        {
+            continue;
+        }
+
+        if (!aBroadcast)
+        {
+            InsertIndirectMessage(mChildMessages[i], aMessage);
+        }
+        else if (mChildBroadcast[i] == NULL || IsQueuedBefore(aMessage, *mChildBroadcast[i]))
+        {
+            mChildBroadcast[i] = &aMessage;
+        }
+
+        mIndirectChildren[i / 8] |= 0x80 >> (i % 8);
+    }
+}
+
+Message *MeshForwarder::GetNextIndirectMessage(uint8_t aChildIndex) const
+{
+    Message *message = mChildMessages[aChildIndex];
+    Message *broadcast = mChildBroadcast[aChildIndex];
+
+    if (broadcast != NULL && (message == NULL || IsQueuedBefore(*broadcast, *message)))
+    {
+        message = broadcast;
+    }
+
+    return message;
+}
+
+void MeshForwarder::RemoveIndirectMessage(Message &aMessage, uint8_t aChildIndex)
+{
+    Message *next;
+
+    VerifyOrExit(aMessage.GetChildMask(aChildIndex), ;);
+
+    aMessage.ClearChildMask(aChildIndex);
+
+    if (!aMessage.IsBroadcastIndirect())
+    {
+        UnlinkIndirectMessage(mChildMessages[aChildIndex], aMessage);
+    }
+    else
+    {
+        if (mChildBroadcast[aChildIndex] == &aMessage)
+        {
+            for (next = aMessage.GetNextIndirect(); next != NULL; next = next->GetNextIndirect())
+            {
+                if (next->GetChildMask(aChildIndex))
+                {
+                    break;
+                }
+            }
+
+            mChildBroadcast[aChildIndex] = next;
+        }
+
+        if (!aMessage.IsChildPending())
+        {
+            UnlinkIndirectMessage(mBroadcastMessages, aMessage);
+        }
+    }
+
+    if (mChildMessages[aChildIndex] == NULL && mChildBroadcast[aChildIndex] == NULL)
+    {
+        mIndirectChildren[aChildIndex / 8] &= ~(0x80 >> (aChildIndex % 8));
+    }
+
+exit:
+    return;
+}
+
+void MeshForwarder::RemoveIndirectMessage(Message &aMessage)
+{
+    Child *children;
+    uint8_t numChildren;
+
+    children = mNetif.GetMle().GetChildren(&numChildren);
+
+    for (uint8_t i = 0; i < Mle::kMaxChildren && aMessage.IsChildPending(); i++)
+    {
+        if (!aMessage.GetChildMask(i))
+        {
+            continue;
+        }
+
+        RemoveIndirectMessage(aMessage, i);
+
+        if (i < numChildren && children[i].mQueuedIndirectMessageCnt > 0 &&
+            --children[i].mQueuedIndirectMessageCnt == 0)
+        {
+            ClearSrcMatchEntry(children[i]);
+        }
+    }
+}
+
+void MeshForwarder::InsertIndirectMessage(Message *&aHead, Message &aMessage)
+{
+    Message *prev = NULL;
+    Message *next;
+
+    for (next = aHead; next != NULL; next = next->GetNextIndirect())
+    {
+        if (IsQueuedBefore(aMessage, *next))
+        {
+            break;
+        }
+
+        prev = next;
+    }
+
+    aMessage.SetNextIndirect(next);
+
+    if (prev == NULL)
+    {
+        aHead = &aMessage;
+    }
+    else
+    {
+        prev->SetNextIndirect(&aMessage);
+    }
+}
+
+void MeshForwarder::UnlinkIndirectMessage(Message *&aHead, Message &aMessage)
+{
+    Message *prev;
+
+    if (aHead == &aMessage)
+    {
+        aHead = aMessage.GetNextIndirect();
+    }
+    else
+    {
+        for (prev = aHead; prev != NULL; prev = prev->GetNextIndirect())
+        {
+            if (prev->GetNextIndirect() == &aMessage)
+            {
+                prev->SetNextIndirect(aMessage.GetNextIndirect());
+                break;
+            }
+        }
+    }
+
+    aMessage.SetNextIndirect(NULL);
+}
+
+uint8_t MeshForwarder::GetNextChildIndex(const uint8_t *aMask, uint8_t aChildIndex)
+{
+    for (; aChildIndex < Mle::kMaxChildren; aChildIndex++)
+    {
+        if (aMask[aChildIndex / 8] == 0)
+        {
+            // Skip the rest of an empty byte.
+            aChildIndex |= 7;
+        }
+        else if (aMask[aChildIndex / 8] & (0x80 >> (aChildIndex % 8)))
+        {
+            break;
+        }
+    }
+
+    return aChildIndex;
+}
+
+bool MeshForwarder::IsQueuedBefore(const Message &aFirst, const Message &aSecond)
+{
+    bool rval;
+
+    if (aFirst.GetPriority() != aSecond.GetPriority())
+    {
+        rval = aFirst.GetPriority() < aSecond.GetPriority();
+    }
+    else
+    {
+        rval = static_cast<int16_t>(aFirst.GetSendSequence() - aSecond.GetSendSequence()) < 0;
+    }
+
+    return rval;
+}
+
 void MeshForwarder::PrepareIndirectTransmission(Message &aMessage, const Child &aChild)
 {
     if (aChild.mIndirectSendInfo.mTxAttemptCounter > 0)
@@ -691,25 +1025,10 @@ ThreadError MeshForwarder::UpdateMeshRoute(Message &aMessage)
     ThreadError error = kThreadError_None;
     Lowpan::MeshHeader meshHeader;
     Neighbor *neighbor;
-    uint16_t nextHop;
 
     IgnoreReturnValue(meshHeader.Init(aMessage));
 
-    nextHop = mNetif.GetMle().GetNextHop(meshHeader.GetDestination());
-
-    if (nextHop != Mac::kShortAddrInvalid)
-    {
-        neighbor = mNetif.GetMle().GetNeighbor(nextHop);
-    }
-    else
-    {
-        neighbor = mNetif.GetMle().GetNeighbor(meshHeader.GetDestination());
-    }
-
-    if (neighbor == NULL)
-    {
-        ExitNow(error = kThreadError_Drop);
-    }
+    VerifyOrExit((neighbor = GetMeshNextHop(meshHeader.GetDestination())) != NULL, error = kThreadError_Drop);
 
     mMacDest.mLength = sizeof(mMacDest.mShortAddress);
     mMacDest.mShortAddress = neighbor->mValid.mRloc16;
@@ -724,6 +1043,13 @@ exit:
     return error;
 }
 
+Neighbor *MeshForwarder::GetMeshNextHop(uint16_t aMeshDest)
+{
+    uint16_t nextHop = mNetif.GetMle().GetNextHop(aMeshDest);
+
+    return mNetif.GetMle().GetNeighbor((nextHop != Mac::kShortAddrInvalid) ? nextHop : aMeshDest);
+}
+
 ThreadError MeshForwarder::UpdateIp6Route(Message &aMessage)
 {
     ThreadError error = kThreadError_None;
@@ -1662,7 +1988,9 @@ void MeshForwarder::HandleSentFrame(Mac::Frame &aFrame, ThreadError aError)
 
     if ((child = mNetif.GetMle().GetChild(macDest)) != NULL)
     {
+        childIndex = mNetif.GetMle().GetChildIndex(*child);
         child->mDataRequest = false;
+        mDataPollChildren[childIndex / 8] &= ~(0x80 >> (childIndex % 8));
 
         VerifyOrExit(mSendMessage != NULL, ;);
 
@@ -1721,11 +2049,9 @@ void MeshForwarder::HandleSentFrame(Mac::Frame &aFrame, ThreadError aError)
                 child->mIndirectSendInfo.mMessage = NULL;
             }
 
-            childIndex = mNetif.GetMle().GetChildIndex(*child);
-
             if (mSendMessage->GetChildMask(childIndex))
             {
-                mSendMessage->ClearChildMask(childIndex);
+                RemoveIndirectMessage(*mSendMessage, childIndex);
 
                 child->mQueuedIndirectMessageCnt--;
                 otLogDebgMac(GetInstance(), "Sent to child (0x%x), still queued message (%d)",
@@ -1774,11 +2100,25 @@ void MeshForwarder::HandleSentFrame(Mac::Frame &aFrame, ThreadError aError)
 
     if (mSendMessage->GetDirectTransmission() == false && mSendMessage->IsChildPending() == false)
     {
-        mSendQueue.Dequeue(*mSendMessage);
+        if (mSendMessage->GetMessageQueue() == &mRelayQueue)
+        {
+            mRelayQueue.Dequeue(*mSendMessage);
+        }
+        else
+        {
+            mSendMessage->GetPriorityQueue()->Dequeue(*mSendMessage);
+        }
+
         mSendMessage->Free();
         mSendMessage = NULL;
         mMessageNextOffset = 0;
     }
+    else if (mSendMessage->GetDirectTransmission() == false && mSendMessage->GetPriorityQueue() == &mSendQueue)
+    {
+        // The direct transmission is done, but sleepy children still need the message.
+        mSendQueue.Dequeue(*mSendMessage);
+        mIndirectSendQueue.Enqueue(*mSendMessage);
+    }
 
 exit:
 
@@ -1925,6 +2265,9 @@ void MeshForwarder::HandleMesh(uint8_t *aFrame, uint8_t aFrameLength, const Mac:
     Mac::Address meshDest;
     Mac::Address meshSource;
     Lowpan::MeshHeader meshHeader;
+    Lowpan::FragmentHeader *fragmentHeader = NULL;
+    RelayFlow *flow = NULL;
+    Neighbor *neighbor;
 
     // Check the mesh header
     VerifyOrExit(meshHeader.Init(aFrame, aFrameLength) == kThreadError_None, error = kThreadError_Drop);
@@ -1959,7 +2302,22 @@ void MeshForwarder::HandleMesh(uint8_t *aFrame, uint8_t aFrameLength, const Mac:
     {
         mNetif.GetMle().ResolveRoutingLoops(aMacSource.mShortAddress, meshDest.mShortAddress);
 
-        SuccessOrExit(error = CheckReachability(aFrame, aFrameLength, meshSource, meshDest));
+        if (aFrameLength >= meshHeader.GetHeaderLength() + sizeof(Lowpan::FragmentHeader) &&
+            reinterpret_cast<Lowpan::FragmentHeader *>(aFrame + meshHeader.GetHeaderLength())->IsFragmentHeader())
+        {
+            fragmentHeader = reinterpret_cast<Lowpan::FragmentHeader *>(aFrame + meshHeader.GetHeaderLength());
+        }
+
+        // Subsequent fragments of a datagram follow the next hop chosen for its first fragment.
+        if (fragmentHeader != NULL && fragmentHeader->GetDatagramOffset() != 0)
+        {
+            flow = FindRelayFlow(meshSource.mShortAddress, meshDest.mShortAddress, fragmentHeader->GetDatagramTag());
+        }
+
+        if (flow == NULL)
+        {
+            SuccessOrExit(error = CheckReachability(aFrame, aFrameLength, meshSource, meshDest));
+        }
 
         meshHeader.SetHopsLeft(meshHeader.GetHopsLeft() - 1);
         meshHeader.AppendTo(aFrame);
@@ -1971,7 +2329,41 @@ void MeshForwarder::HandleMesh(uint8_t *aFrame, uint8_t aFrameLength, const Mac:
         message->SetLinkSecurityEnabled(aMessageInfo.mLinkSecurity);
         message->SetPanId(aMessageInfo.mPanId);
 
-        SendMessage(*message);
+        // Frames for sleepy children are queued for indirect transmission.
+        if ((neighbor = mNetif.GetMle().GetNeighbor(meshDest.mShortAddress)) != NULL &&
+            (neighbor->mMode & Mle::ModeTlv::kModeRxOnWhenIdle) == 0)
+        {
+            SendMessage(*message);
+            ExitNow();
+        }
+
+        if (flow == NULL || (neighbor = mNetif.GetMle().GetNeighbor(flow->mNextHop)) == NULL)
+        {
+            VerifyOrExit((neighbor = GetMeshNextHop(meshDest.mShortAddress)) != NULL, error = kThreadError_Drop);
+        }
+
+        if (fragmentHeader != NULL && fragmentHeader->GetDatagramOffset() == 0)
+        {
+            flow = &mRelayFlows[mRelayFlowNext];
+            mRelayFlowNext = (mRelayFlowNext + 1) % kRelayFlows;
+
+            flow->mMeshSource = meshSource.mShortAddress;
+            flow->mMeshDest = meshDest.mShortAddress;
+            flow->mDatagramTag = fragmentHeader->GetDatagramTag();
+            flow->mNextHop = neighbor->mValid.mRloc16;
+        }
+        else if (flow != NULL &&
+                 fragmentHeader->GetDatagramOffset() + aFrameLength - meshHeader.GetHeaderLength() -
+                 fragmentHeader->GetHeaderLength() >= fragmentHeader->GetDatagramSize())
+        {
+            // The last fragment releases the flow.
+            flow->mNextHop = Mac::kShortAddrInvalid;
+        }
+
+        message->SetMeshNextHop(neighbor->mValid.mRloc16);
+        message->SetDirectTransmission();
+        mRelayQueue.Enqueue(*message);
+        mScheduleTransmissionTask.Post();
     }
 
 exit:
@@ -1987,6 +2379,26 @@ exit:
     }
 }
 
+MeshForwarder::RelayFlow *MeshForwarder::FindRelayFlow(uint16_t aMeshSource, uint16_t aMeshDest,
+                                                       uint16_t aDatagramTag)
+{
+    RelayFlow *rval = NULL;
+
+    for (int i = 0; i < kRelayFlows; i++)
+    {
+        if (mRelayFlows[i].mNextHop != Mac::kShortAddrInvalid &&
+            mRelayFlows[i].mMeshSource == aMeshSource &&
+            mRelayFlows[i].mMeshDest == aMeshDest &&
+            mRelayFlows[i].mDatagramTag == aDatagramTag)
+        {
+            ExitNow(rval = &mRelayFlows[i]);
+        }
+    }
+
+exit:
+    return rval;
+}
+
 ThreadError MeshForwarder::CheckReachability(uint8_t *aFrame, uint8_t aFrameLength,
                                              const Mac::Address &aMeshSource, const Mac::Address &aMeshDest)
 {
@@ -2031,13 +2443,25 @@ void MeshForwarder::HandleFragment(uint8_t *aFrame, uint8_t aFrameLength,
     Lowpan::FragmentHeader *fragmentHeader = reinterpret_cast<Lowpan::FragmentHeader *>(aFrame);
     uint16_t datagramLength = fragmentHeader->GetDatagramSize();
     uint16_t datagramTag = fragmentHeader->GetDatagramTag();
+    uint16_t datagramOffset = fragmentHeader->GetDatagramOffset();
+    uint16_t fragmentEnd;
+    uint8_t startBlock;
+    uint8_t endBlock;
+    ReassemblyEntry *entry = NULL;
     Message *message = NULL;
     int headerLength;
 
-    if (fragmentHeader->GetDatagramOffset() == 0)
+    VerifyOrExit(aFrameLength >= fragmentHeader->GetHeaderLength(), error = kThreadError_Parse);
+    VerifyOrExit(datagramLength <= Ip6::Ip6::kMaxDatagramLength, error = kThreadError_Parse);
+
+    aFrame += fragmentHeader->GetHeaderLength();
+    aFrameLength -= fragmentHeader->GetHeaderLength();
+
+    entry = FindReassemblyEntry(aMacSource, datagramTag, datagramLength, aMessageInfo.mLinkSecurity);
+
+    if (datagramOffset == 0)
     {
-        aFrame += fragmentHeader->GetHeaderLength();
-        aFrameLength -= fragmentHeader->GetHeaderLength();
+        VerifyOrExit(entry == NULL || !entry->IsReceived(0, 1), error = kThreadError_Duplicated);
 
         VerifyOrExit((message = mNetif.GetIp6().mMessagePool.New(Message::kTypeIp6, 0)) != NULL,
                      error = kThreadError_NoBufs);
@@ -2050,63 +2474,118 @@ void MeshForwarder::HandleFragment(uint8_t *aFrame, uint8_t aFrameLength,
         aFrame += headerLength;
         aFrameLength -= static_cast<uint8_t>(headerLength);
 
-        VerifyOrExit(datagramLength >= message->GetOffset() + aFrameLength, error = kThreadError_Parse);
+        fragmentEnd = message->GetOffset() + aFrameLength;
+        VerifyOrExit(datagramLength >= fragmentEnd, error = kThreadError_Parse);
+        VerifyOrExit(fragmentEnd == datagramLength || (fragmentEnd % kReassemblyBlockSize) == 0,
+                     error = kThreadError_Parse);
 
         SuccessOrExit(error = message->SetLength(datagramLength));
 
-        message->SetDatagramTag(datagramTag);
-        message->SetTimeout(kReassemblyTimeout);
-
         // copy Fragment
         message->Write(message->GetOffset(), aFrameLength, aFrame);
-        message->MoveOffset(aFrameLength);
 
         // Security Check
         VerifyOrExit(mNetif.GetIp6Filter().Accept(*message), error = kThreadError_Drop);
 
-        mReassemblyList.Enqueue(*message);
-
-        if (!mReassemblyTimer.IsRunning())
+        if (entry != NULL)
+        {
+            // The decompressed header may differ in length from its compressed form, so the first fragment is
+            // decompressed into a fresh message and the fragments that arrived ahead of it are carried over.
+            message->SetTimeout(entry->mMessage->GetTimeout());
+            entry->mMessage->CopyTo(fragmentEnd, fragmentEnd, datagramLength - fragmentEnd, *message);
+            mReassemblyList.Dequeue(*entry->mMessage);
+            entry->mMessage->Free();
+            entry->mMessage = message;
+            mReassemblyList.Enqueue(*message);
+        }
+        else
         {
-            mReassemblyTimer.Start(kStateUpdatePeriod);
+            message->SetTimeout(kReassemblyTimeout);
+            entry = &NewReassemblyEntry(*message, aMacSource, datagramTag, datagramLength, aMessageInfo.mLinkSecurity);
         }
+
+        message = NULL;
     }
     else
     {
-        aFrame += fragmentHeader->GetHeaderLength();
-        aFrameLength -= fragmentHeader->GetHeaderLength();
+        fragmentEnd = datagramOffset + aFrameLength;
+        VerifyOrExit(aFrameLength > 0 && fragmentEnd <= datagramLength, error = kThreadError_Parse);
+
+        // Every fragment but the last one carries a whole number of blocks.
+        VerifyOrExit(fragmentEnd == datagramLength || (aFrameLength % kReassemblyBlockSize) == 0,
+                     error = kThreadError_Parse);
 
-        for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
+        if (entry == NULL)
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (message->GetLength() == datagramLength &&
-                message->GetDatagramTag() == datagramTag &&
-                message->GetOffset() == fragmentHeader->GetDatagramOffset() &&
-                message->IsLinkSecurityEnabled() == aMessageInfo.mLinkSecurity)
-            {
-                break;
-            }
+            VerifyOrExit((message = mNetif.GetIp6().mMessagePool.New(Message::kTypeIp6, 0)) != NULL,
+                         error = kThreadError_NoBufs);
+            message->SetLinkSecurityEnabled(aMessageInfo.mLinkSecurity);
+            message->SetPanId(aMessageInfo.mPanId);
+            SuccessOrExit(error = message->SetLength(datagramLength));
+            message->SetTimeout(kReassemblyTimeout);
+            entry = &NewReassemblyEntry(*message, aMacSource, datagramTag, datagramLength, aMessageInfo.mLinkSecurity);
+            message = NULL;
         }
+    }
 
-        VerifyOrExit(message != NULL, error = kThreadError_Drop);
+    // Only the final fragment of the datagram may end part way through a block.
+    startBlock = static_cast<uint8_t>(datagramOffset / kReassemblyBlockSize);
+    endBlock = static_cast<uint8_t>((fragmentEnd + kReassemblyBlockSize - 1) / kReassemblyBlockSize);
+
+    if (datagramOffset != 0)
+    {
+        VerifyOrExit(!entry->IsReceived(startBlock, endBlock), error = kThreadError_Duplicated);
 
         // copy Fragment
-        message->Write(message->GetOffset(), aFrameLength, aFrame);
-        message->MoveOffset(aFrameLength);
+        entry->mMessage->Write(datagramOffset, aFrameLength, aFrame);
+    }
+
+    if (startBlock > 0 && !entry->IsReceived(startBlock - 1, startBlock))
+    {
+        mReassemblyCounters.mOutOfOrder++;
+    }
+
+    entry->MarkReceived(startBlock, endBlock);
+
+    if (!mReassemblyTimer.IsRunning())
+    {
+        mReassemblyTimer.Start(kStateUpdatePeriod);
     }
 
 exit:
 
     if (error == kThreadError_None)
     {
-        if (message->GetOffset() >= message->GetLength())
+        if (entry->mBlocksReceived == (datagramLength + kReassemblyBlockSize - 1) / kReassemblyBlockSize)
         {
+            message = entry->mMessage;
             mReassemblyList.Dequeue(*message);
+            entry->mMessage = NULL;
+            mReassemblyCounters.mDatagrams++;
             HandleDatagram(*message, aMessageInfo);
         }
     }
     else
     {
+        switch (error)
+        {
+        case kThreadError_Duplicated:
+            mReassemblyCounters.mDuplicates++;
+            break;
+
+        case kThreadError_NoBufs:
+            mReassemblyCounters.mFailNoBufs++;
+            break;
+
+        case kThreadError_Drop:
+            mReassemblyCounters.mFailSecurity++;
+            break;
+
+        default:
+            mReassemblyCounters.mFailParse++;
+            break;
+        }
+
         otLogDebgMacErr(GetInstance(), error, "Dropping received fragment");
 
         if (message != NULL)
@@ -2116,6 +2595,104 @@ exit:
     }
 }
 
+MeshForwarder::ReassemblyEntry *MeshForwarder::FindReassemblyEntry(const Mac::Address &aSource,
+                                                                   uint16_t aDatagramTag, uint16_t aDatagramSize,
+                                                                   bool aLinkSecurity)
+{
+    ReassemblyEntry *rval = NULL;
+
+    for (int i = 0; i < kReassemblyEntries; i++)
+    {
+        ReassemblyEntry &entry = mReassemblyEntries[i];
+
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        if (entry.mMessage != NULL &&
+            entry.mDatagramTag == aDatagramTag &&
+            entry.mDatagramSize == aDatagramSize &&
+            entry.mLinkSecurity == aLinkSecurity &&
+            entry.mSource.mLength == aSource.mLength &&
+            ((aSource.mLength == sizeof(aSource.mShortAddress)) ?
+             entry.mSource.mShortAddress == aSource.mShortAddress :
+             memcmp(&entry.mSource.mExtAddress, &aSource.mExtAddress, sizeof(aSource.mExtAddress)) == 0))
+        {
+            ExitNow(rval = &entry);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+MeshForwarder::ReassemblyEntry &MeshForwarder::NewReassemblyEntry(Message &aMessage, const Mac::Address &aSource,
+                                                                  uint16_t aDatagramTag, uint16_t aDatagramSize,
+                                                                  bool aLinkSecurity)
+{
+    ReassemblyEntry *entry = NULL;
+
+    for (int i = 0; i < kReassemblyEntries; i++)
+    {
+        if (mReassemblyEntries[i].mMessage == NULL)
+        {
+            entry = &mReassemblyEntries[i];
+            break;
+        }
+
+        // Otherwise, evict the datagram closest to its reassembly timeout.
+        if (entry == NULL || mReassemblyEntries[i].mMessage->GetTimeout() < entry->mMessage->GetTimeout())
+        {
+            entry = &mReassemblyEntries[i];
+        }
+    }
+
+    if (entry->mMessage != NULL)
+    {
+        mReassemblyCounters.mFailEvicted++;
+        FreeReassemblyEntry(*entry);
+    }
+
+    memset(entry, 0, sizeof(*entry));
+    entry->mMessage = &aMessage;
+    entry->mSource = aSource;
+    entry->mDatagramTag = aDatagramTag;
+    entry->mDatagramSize = aDatagramSize;
+    entry->mLinkSecurity = aLinkSecurity;
+    mReassemblyList.Enqueue(aMessage);
+
+    return *entry;
+}
+
+void MeshForwarder::FreeReassemblyEntry(ReassemblyEntry &aEntry)
+{
+    mReassemblyList.Dequeue(*aEntry.mMessage);
+    aEntry.mMessage->Free();
+    aEntry.mMessage = NULL;
+}
+
+bool MeshForwarder::ReassemblyEntry::IsReceived(uint8_t aStart, uint8_t aEnd) const
+{
+    bool rval = true;
+
+    for (uint8_t i = aStart; i < aEnd; i++)
+    {
+        VerifyOrExit(mBlocks[i / 8] & (0x80 >> (i % 8)), rval = false);
+    }
+
+exit:
+    return rval;
+}
+
+void MeshForwarder::ReassemblyEntry::MarkReceived(uint8_t aStart, uint8_t aEnd)
+{
+    for (uint8_t i = aStart; i < aEnd; i++)
+    {
+        if ((mBlocks[i / 8] & (0x80 >> (i % 8))) == 0)
+        {
+            mBlocks[i / 8] |= 0x80 >> (i % 8);
+            mBlocksReceived++;
+        }
+    }
+}
+
 void MeshForwarder::HandleReassemblyTimer(void *aContext)
 {
     static_cast<MeshForwarder *>(aContext)->HandleReassemblyTimer();
@@ -2123,22 +2700,27 @@ void MeshForwarder::HandleReassemblyTimer(void *aContext)
 
 void MeshForwarder::HandleReassemblyTimer()
 {
-    Message *next = NULL;
     uint8_t timeout;
 
-    for (Message *message = mReassemblyList.GetHead(); message; message = next)
+    for (int i = 0; i < kReassemblyEntries; i++)
     {
-        next = message->GetNext();
-        timeout = message->GetTimeout();
+        ReassemblyEntry &entry = mReassemblyEntries[i];
+
+        if (entry.mMessage == NULL)
+        {
+            continue;
+        }
+
+        timeout = entry.mMessage->GetTimeout();
 
         if (timeout > 0)
         {
-            message->SetTimeout(timeout - 1);
+            entry.mMessage->SetTimeout(timeout - 1);
         }
         else
         {
-            mReassemblyList.Dequeue(*message);
-            message->Free();
+            mReassemblyCounters.mFailTimeout++;
+            FreeReassemblyEntry(entry);
         }
     }
 
@@ -2202,6 +2784,7 @@ void MeshForwarder::UpdateFramePending()
 void MeshForwarder::HandleDataRequest(const Mac::Address &aMacSource, const ThreadMessageInfo &aMessageInfo)
 {
     Child *child;
+    uint8_t childIndex;
 
     // Security Check: only process secure Data Poll frames.
     VerifyOrExit(aMessageInfo.mLinkSecurity, ;);
@@ -2214,7 +2797,9 @@ void MeshForwarder::HandleDataRequest(const Mac::Address &aMacSource, const Thre
 
     if (!mSrcMatchEnabled || child->mQueuedIndirectMessageCnt > 0)
     {
+        childIndex = mNetif.GetMle().GetChildIndex(*child);
         child->mDataRequest = true;
+        mDataPollChildren[childIndex / 8] |= 0x80 >> (childIndex % 8);
     }
 
     mScheduleTransmissionTask.Post();
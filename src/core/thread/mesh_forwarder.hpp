@@ -242,6 +242,17 @@ public:
      */
     const PriorityQueue &GetSendQueue(void) const { return mSendQueue; }
 
+    /**
+     * This method returns a reference to the indirect send queue.
+     *
+     * Messages that only await indirect transmission to sleepy children are kept apart from `GetSendQueue()`, so
+     * selecting the next direct transmission does not skip over them.
+     *
+     * @returns  A reference to the indirect send queue.
+     *
+     */
+    const PriorityQueue &GetIndirectSendQueue(void) const { return mIndirectSendQueue; }
+
     /**
      * This method returns a reference to the reassembly queue.
      *
@@ -250,6 +261,22 @@ public:
      */
     const MessageQueue &GetReassemblyQueue(void) const { return mReassemblyList; }
 
+    /**
+     * This method returns the 6LoWPAN fragment reassembly counters.
+     *
+     * @returns A reference to the 6LoWPAN fragment reassembly counters.
+     *
+     */
+    const otReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+
+    /**
+     * This method returns a reference to the mesh relay queue.
+     *
+     * @returns  A reference to the mesh relay queue.
+     *
+     */
+    const MessageQueue &GetRelayQueue(void) const { return mRelayQueue; }
+
     /**
      * This method returns a reference to the resolving queue.
      *
@@ -277,6 +304,58 @@ private:
         kMaxPollTriggeredTxAttempts = OPENTHREAD_CONFIG_MAX_TX_ATTEMPTS_INDIRECT_POLLS,
     };
 
+    enum
+    {
+        kReassemblyEntries   = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES,
+        kReassemblyBlockSize = 8,  ///< Fragment offset granularity in octets.
+        kReassemblyMaxBlocks = (Ip6::Ip6::kMaxDatagramLength + kReassemblyBlockSize - 1) / kReassemblyBlockSize,
+    };
+
+    /**
+     * This structure tracks a datagram under reassembly.
+     *
+     * A datagram is identified by the (source, tag, size) tuple of RFC 4944 together with the link security setting.
+     * Received data is recorded per 8-octet block, so fragments may arrive in any order and duplicates are detected
+     * without touching the message buffer.
+     *
+     */
+    struct ReassemblyEntry
+    {
+        bool IsReceived(uint8_t aStart, uint8_t aEnd) const;
+        void MarkReceived(uint8_t aStart, uint8_t aEnd);
+
+        Message     *mMessage;          ///< The reassembly buffer, or NULL if the entry is not in use.
+        Mac::Address mSource;
+        uint16_t     mDatagramTag;
+        uint16_t     mDatagramSize;
+        uint8_t      mBlocksReceived;
+        bool         mLinkSecurity;
+        uint8_t      mBlocks[(kReassemblyMaxBlocks + 7) / 8];
+    };
+
+    enum
+    {
+        kRelayFlows = OPENTHREAD_CONFIG_MESH_RELAY_FLOWS,
+    };
+
+    enum
+    {
+        kChildMaskBytes = (Mle::kMaxChildren + 7) / 8,  ///< Size of a bit-vector with one bit per child.
+    };
+
+    /**
+     * This structure caches the next hop chosen for the first fragment of a relayed datagram, so the remaining
+     * fragments follow it without another route lookup.
+     *
+     */
+    struct RelayFlow
+    {
+        uint16_t mMeshSource;
+        uint16_t mMeshDest;
+        uint16_t mDatagramTag;
+        uint16_t mNextHop;              ///< The next hop RLOC16, or `Mac::kShortAddrInvalid` if not in use.
+    };
+
     ThreadError CheckReachability(uint8_t *aFrame, uint8_t aFrameLength,
                                   const Mac::Address &aMeshSource, const Mac::Address &aMeshDest);
 
@@ -285,12 +364,28 @@ private:
     ThreadError GetMacSourceAddress(const Ip6::Address &aIp6Addr, Mac::Address &aMacAddr);
     Message *GetDirectTransmission(void);
     Message *GetIndirectTransmission(Child &aChild);
+    void AddIndirectMessage(Message &aMessage, bool aBroadcast);
+    Message *GetNextIndirectMessage(uint8_t aChildIndex) const;
+    void RemoveIndirectMessage(Message &aMessage, uint8_t aChildIndex);
+    void RemoveIndirectMessage(Message &aMessage);
+    static void InsertIndirectMessage(Message *&aHead, Message &aMessage);
+    static void UnlinkIndirectMessage(Message *&aHead, Message &aMessage);
+    static bool IsQueuedBefore(const Message &aFirst, const Message &aSecond);
+    static uint8_t GetNextChildIndex(const uint8_t *aMask, uint8_t aChildIndex);
+    Message *GetRelayTransmission(void);
+    Neighbor *GetMeshNextHop(uint16_t aMeshDest);
+    RelayFlow *FindRelayFlow(uint16_t aMeshSource, uint16_t aMeshDest, uint16_t aDatagramTag);
     void PrepareIndirectTransmission(Message &aMessage, const Child &aChild);
     void HandleMesh(uint8_t *aFrame, uint8_t aPayloadLength, const Mac::Address &aMacSource,
                     const ThreadMessageInfo &aMessageInfo);
     void HandleFragment(uint8_t *aFrame, uint8_t aPayloadLength,
                         const Mac::Address &aMacSource, const Mac::Address &aMacDest,
                         const ThreadMessageInfo &aMessageInfo);
+    ReassemblyEntry *FindReassemblyEntry(const Mac::Address &aSource, uint16_t aDatagramTag,
+                                         uint16_t aDatagramSize, bool aLinkSecurity);
+    ReassemblyEntry &NewReassemblyEntry(Message &aMessage, const Mac::Address &aSource, uint16_t aDatagramTag,
+                                        uint16_t aDatagramSize, bool aLinkSecurity);
+    void FreeReassemblyEntry(ReassemblyEntry &aEntry);
     void HandleLowpanHC(uint8_t *aFrame, uint8_t aPayloadLength,
                         const Mac::Address &aMacSource, const Mac::Address &aMacDest,
                         const ThreadMessageInfo &aMessageInfo);
@@ -326,6 +421,9 @@ private:
     static void ScheduleTransmissionTask(void *aContext);
     void ScheduleTransmissionTask(void);
 
+    static bool HandleEvictMessage(void *aContext, Message &aMessage);
+    bool HandleEvictMessage(Message &aMessage);
+
     ThreadError AddPendingSrcMatchEntries(void);
     ThreadError AddSrcMatchEntry(Child &aChild);
     void ClearSrcMatchEntry(Child &aChild);
@@ -337,9 +435,27 @@ private:
     Timer mReassemblyTimer;
 
     PriorityQueue mSendQueue;
+    PriorityQueue mIndirectSendQueue;
+
+    // Index of the messages queued for sleepy children, kept in priority order and then in send order. A message for
+    // a single child is linked into the list of that child, and a message for all sleepy children into the broadcast
+    // list, where each child tracks the first message still pending for it.
+    Message *mChildMessages[Mle::kMaxChildren];
+    Message *mChildBroadcast[Mle::kMaxChildren];
+    Message *mBroadcastMessages;
+    uint8_t mIndirectChildren[kChildMaskBytes];   ///< Children with indexed messages.
+    uint8_t mDataPollChildren[kChildMaskBytes];   ///< Children with a data poll that is yet to be answered.
+
     MessageQueue mReassemblyList;
+    ReassemblyEntry mReassemblyEntries[kReassemblyEntries];
+    otReassemblyCounters mReassemblyCounters;
+    MessageQueue mRelayQueue;
+    RelayFlow mRelayFlows[kRelayFlows];
+    uint8_t mRelayFlowNext;
+    bool mRelayTurn;
     MessageQueue mResolvingQueue;
     uint16_t mFragTag;
+    uint16_t mSendSequence;
     uint16_t mMessageNextOffset;
     uint32_t mPollPeriod;
     uint32_t mAssignPollPeriod;
@@ -911,12 +911,11 @@ Message *Mle::NewMleMessage(void)
 {
     Message *message;
 
-    message = mSocket.NewMessage(0);
+    message = mSocket.NewMessage(0, kMleMessagePriority);
     VerifyOrExit(message != NULL, ;);
 
     message->SetSubType(Message::kSubTypeMleGeneral);
     message->SetLinkSecurityEnabled(false);
-    message->SetPriority(kMleMessagePriority);
 
 exit:
     return message;
@@ -1875,8 +1874,6 @@ ThreadError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination
     uint8_t tag[4];
     uint8_t tagLength;
     Crypto::AesCcm aesCcm;
-    uint8_t buf[64];
-    uint16_t length;
     Ip6::MessageInfo messageInfo;
 
     aMessage.Read(0, sizeof(header), &header);
@@ -1895,7 +1892,7 @@ ThreadError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination
                       Mac::Frame::kSecEncMic32,
                       nonce);
 
-        aesCcm.SetKey(mNetif.GetKeyManager().GetCurrentMleKey(), 16);
+        aesCcm.SetKey(mNetif.GetKeyManager().GetMleKeyContext(keySequence));
         aesCcm.Init(16 + 16 + header.GetHeaderLength(), aMessage.GetLength() - (header.GetLength() - 1),
                     sizeof(tag), nonce, sizeof(nonce));
 
@@ -1903,15 +1900,8 @@ ThreadError Mle::SendMessage(Message &aMessage, const Ip6::Address &aDestination
         aesCcm.Header(&aDestination, sizeof(aDestination));
         aesCcm.Header(header.GetBytes() + 1, header.GetHeaderLength());
 
-        aMessage.SetOffset(header.GetLength() - 1);
-
-        while (aMessage.GetOffset() < aMessage.GetLength())
-        {
-            length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
-            aesCcm.Payload(buf, buf, length, true);
-            aMessage.Write(aMessage.GetOffset(), length, buf);
-            aMessage.MoveOffset(length);
-        }
+        aesCcm.Payload(aMessage, header.GetLength() - 1, aMessage.GetLength() - (header.GetLength() - 1), true);
+        aMessage.SetOffset(aMessage.GetLength());
 
         tagLength = sizeof(tag);
         aesCcm.Finalize(tag, &tagLength);
@@ -1973,7 +1963,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 {
     Header header;
     uint32_t keySequence;
-    const uint8_t *mleKey;
     uint32_t frameCounter;
     uint8_t messageTag[4];
     uint16_t messageTagLength;
@@ -1981,8 +1970,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     Mac::ExtAddress macAddr;
     Crypto::AesCcm aesCcm;
     uint16_t mleOffset;
-    uint8_t buf[64];
-    uint16_t length;
     uint8_t tag[4];
     uint8_t tagLength;
     uint8_t command;
@@ -2018,15 +2005,6 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     keySequence = header.GetKeyId();
 
-    if (keySequence == mNetif.GetKeyManager().GetCurrentKeySequence())
-    {
-        mleKey = mNetif.GetKeyManager().GetCurrentMleKey();
-    }
-    else
-    {
-        mleKey = mNetif.GetKeyManager().GetTemporaryMleKey(keySequence);
-    }
-
     aMessage.MoveOffset(header.GetLength() - 1);
 
     frameCounter = header.GetFrameCounter();
@@ -2038,7 +2016,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
     macAddr.Set(aMessageInfo.GetPeerAddr());
     GenerateNonce(macAddr, frameCounter, Mac::Frame::kSecEncMic32, nonce);
 
-    aesCcm.SetKey(mleKey, 16);
+    aesCcm.SetKey(mNetif.GetKeyManager().GetMleKeyContext(keySequence));
     aesCcm.Init(sizeof(aMessageInfo.GetPeerAddr()) + sizeof(aMessageInfo.GetSockAddr()) + header.GetHeaderLength(),
                 aMessage.GetLength() - aMessage.GetOffset(), sizeof(messageTag), nonce, sizeof(nonce));
     aesCcm.Header(&aMessageInfo.GetPeerAddr(), sizeof(aMessageInfo.GetPeerAddr()));
@@ -2047,13 +2025,7 @@ void Mle::HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageIn
 
     mleOffset = aMessage.GetOffset();
 
-    while (aMessage.GetOffset() < aMessage.GetLength())
-    {
-        length = aMessage.Read(aMessage.GetOffset(), sizeof(buf), buf);
-        aesCcm.Payload(buf, buf, length, false);
-        aMessage.Write(aMessage.GetOffset(), length, buf);
-        aMessage.MoveOffset(length);
-    }
+    aesCcm.Payload(aMessage, mleOffset, aMessage.GetLength() - mleOffset, false);
 
     tagLength = sizeof(tag);
     aesCcm.Finalize(tag, &tagLength);
@@ -2222,13 +2194,14 @@ ThreadError Mle::HandleAdvertisement(const Message &aMessage, const Ip6::Message
     RouteTlv route;
     uint8_t tlvs[] = {Tlv::kNetworkData};
     uint16_t delay;
+    TlvIndex tlvIndex(aMessage);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
 
     otLogInfoMle(GetInstance(), "Received advertisement from %04x", sourceAddress.GetRloc16());
@@ -2261,7 +2234,7 @@ ThreadError Mle::HandleAdvertisement(const Message &aMessage, const Ip6::Message
             SetLeaderData(leaderData.GetPartitionId(), leaderData.GetWeighting(), leaderData.GetLeaderRouterId());
 
             if ((mDeviceMode & ModeTlv::kModeFFD) &&
-                (Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == kThreadError_None) &&
+                (tlvIndex.Get(Tlv::kRoute, sizeof(route), route) == kThreadError_None) &&
                 route.IsValid())
             {
                 // Overwrite Route Data
@@ -2334,9 +2307,10 @@ ThreadError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInf
     bool dataRequest = false;
     Tlv tlv;
     uint16_t delay;
+    TlvIndex tlvIndex(aMessage);
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
 
     if ((leaderData.GetPartitionId() != mLeaderData.GetPartitionId()) ||
@@ -2371,11 +2345,11 @@ ThreadError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInf
     }
 
     // Network Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kNetworkData, sizeof(networkData), networkData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kNetworkData, sizeof(networkData), networkData));
     VerifyOrExit(networkData.IsValid(), error = kThreadError_Parse);
 
     // Active Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
     {
         const MeshCoP::Timestamp *timestamp;
 
@@ -2385,7 +2359,7 @@ ThreadError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInf
         // if received timestamp does not match the local value and message does not contain the dataset,
         // send MLE Data Request
         if ((timestamp == NULL || timestamp->Compare(activeTimestamp) != 0) &&
-            (Tlv::GetOffset(aMessage, Tlv::kActiveDataset, activeDatasetOffset) != kThreadError_None))
+            (tlvIndex.GetOffset(Tlv::kActiveDataset, activeDatasetOffset) != kThreadError_None))
         {
             ExitNow(dataRequest = true);
         }
@@ -2396,7 +2370,7 @@ ThreadError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInf
     }
 
     // Pending Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
     {
         const MeshCoP::Timestamp *timestamp;
 
@@ -2406,7 +2380,7 @@ ThreadError Mle::HandleLeaderData(const Message &aMessage, const Ip6::MessageInf
         // if received timestamp does not match the local value and message does not contain the dataset,
         // send MLE Data Request
         if ((timestamp == NULL || timestamp->Compare(pendingTimestamp) != 0) &&
-            (Tlv::GetOffset(aMessage, Tlv::kPendingDataset, pendingDatasetOffset) != kThreadError_None))
+            (tlvIndex.GetOffset(Tlv::kPendingDataset, pendingDatasetOffset) != kThreadError_None))
         {
             ExitNow(dataRequest = true);
         }
@@ -2529,25 +2503,26 @@ ThreadError Mle::HandleParentResponse(const Message &aMessage, const Ip6::Messag
     MleFrameCounterTlv mleFrameCounter;
     ChallengeTlv challenge;
     int8_t diff;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Parent Response");
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid() &&
                  memcmp(response.GetResponse(), mParentRequest.mChallenge, response.GetLength()) == 0,
                  error = kThreadError_Parse);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
 
     // Link Quality
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkMargin, sizeof(linkMarginTlv), linkMarginTlv));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkMargin, sizeof(linkMarginTlv), linkMarginTlv));
     VerifyOrExit(linkMarginTlv.IsValid(), error = kThreadError_Parse);
 
     linkMargin = LinkQualityInfo::ConvertRssToLinkMargin(mNetif.GetMac().GetNoiseFloor(), threadMessageInfo->mRss);
@@ -2562,7 +2537,7 @@ ThreadError Mle::HandleParentResponse(const Message &aMessage, const Ip6::Messag
     VerifyOrExit(mParentRequestState != kParentRequestRouter || linkQuality == 3, ;);
 
     // Connectivity
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kConnectivity, sizeof(connectivity), connectivity));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kConnectivity, sizeof(connectivity), connectivity));
     VerifyOrExit(connectivity.IsValid(), error = kThreadError_Parse);
 
     if ((mDeviceMode & ModeTlv::kModeFFD) && (mDeviceState != kDeviceStateDetached))
@@ -2609,11 +2584,11 @@ ThreadError Mle::HandleParentResponse(const Message &aMessage, const Ip6::Messag
     }
 
     // Link Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = kThreadError_Parse);
 
     // Mle Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == kThreadError_None)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), ;);
     }
@@ -2623,7 +2598,7 @@ ThreadError Mle::HandleParentResponse(const Message &aMessage, const Ip6::Messag
     }
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = kThreadError_Parse);
     memcpy(mChildIdRequest.mChallenge, challenge.GetChallenge(), challenge.GetLength());
     mChildIdRequest.mChallengeLength = challenge.GetLength();
@@ -2669,33 +2644,34 @@ ThreadError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::Messa
     PendingTimestampTlv pendingTimestamp;
     Tlv tlv;
     uint16_t offset;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Child ID Response");
 
     VerifyOrExit(mParentRequestState == kChildIdRequest, ;);
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
 
     // ShortAddress
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kAddress16, sizeof(shortAddress), shortAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kAddress16, sizeof(shortAddress), shortAddress));
     VerifyOrExit(shortAddress.IsValid(), error = kThreadError_Parse);
 
     // Network Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kNetworkData, sizeof(networkData), networkData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kNetworkData, sizeof(networkData), networkData));
 
     // Active Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = kThreadError_Parse);
 
         // Active Dataset
-        if (Tlv::GetOffset(aMessage, Tlv::kActiveDataset, offset) == kThreadError_None)
+        if (tlvIndex.GetOffset(Tlv::kActiveDataset, offset) == kThreadError_None)
         {
             aMessage.Read(offset, sizeof(tlv), &tlv);
             mNetif.GetActiveDataset().Set(activeTimestamp, aMessage, offset + sizeof(tlv), tlv.GetLength());
@@ -2714,12 +2690,12 @@ ThreadError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::Messa
     }
 
     // Pending Timestamp
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = kThreadError_Parse);
 
         // Pending Dataset
-        if (Tlv::GetOffset(aMessage, Tlv::kPendingDataset, offset) == kThreadError_None)
+        if (tlvIndex.GetOffset(Tlv::kPendingDataset, offset) == kThreadError_None)
         {
             aMessage.Read(offset, sizeof(tlv), &tlv);
             mNetif.GetPendingDataset().Set(pendingTimestamp, aMessage, offset + sizeof(tlv), tlv.GetLength());
@@ -2748,7 +2724,7 @@ ThreadError Mle::HandleChildIdResponse(const Message &aMessage, const Ip6::Messa
     }
 
     // Route
-    if ((Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route) == kThreadError_None) &&
+    if ((tlvIndex.Get(Tlv::kRoute, sizeof(route), route) == kThreadError_None) &&
         (mDeviceMode & ModeTlv::kModeFFD))
     {
         SuccessOrExit(error = mNetif.GetMle().ProcessRouteTlv(route));
@@ -2791,16 +2767,17 @@ ThreadError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Me
     uint8_t dataRequestTlvs[] = {Tlv::kNetworkData};
     uint8_t tlvs[kMaxResponseTlvs] = {};
     uint8_t numTlvs = 0;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Child Update Request from parent");
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
     VerifyOrExit(mParent.mValid.mRloc16 == sourceAddress.GetRloc16(), error = kThreadError_Drop);
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
     {
         VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
         SetLeaderData(leaderData.GetPartitionId(), leaderData.GetWeighting(), leaderData.GetLeaderRouterId());
@@ -2814,7 +2791,7 @@ ThreadError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Me
         }
 
         // Network Data
-        if (Tlv::GetTlv(aMessage, Tlv::kNetworkData, sizeof(networkData), networkData) == kThreadError_None)
+        if (tlvIndex.Get(Tlv::kNetworkData, sizeof(networkData), networkData) == kThreadError_None)
         {
             VerifyOrExit(networkData.IsValid(), error = kThreadError_Parse);
             mNetif.GetNetworkDataLeader().SetNetworkData(leaderData.GetDataVersion(),
@@ -2826,7 +2803,7 @@ ThreadError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Me
     }
 
     // TLV Request
-    if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == kThreadError_None)
     {
         VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= sizeof(tlvs), error = kThreadError_Parse);
         memcpy(tlvs, tlvRequest.GetTlvs(), tlvRequest.GetLength());
@@ -2834,7 +2811,7 @@ ThreadError Mle::HandleChildUpdateRequest(const Message &aMessage, const Ip6::Me
     }
 
     // Challenge
-    if (Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge) == kThreadError_None)
     {
         VerifyOrExit(challenge.IsValid(), error = kThreadError_Parse);
         VerifyOrExit(static_cast<size_t>(numTlvs + 3) <= sizeof(tlvs), error = kThreadError_NoBufs);
@@ -2864,18 +2841,19 @@ ThreadError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::M
     MleFrameCounterTlv mleFrameCounter;
     SourceAddressTlv sourceAddress;
     TimeoutTlv timeout;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Child Update Response from parent");
 
     // Status
-    if (Tlv::GetTlv(aMessage, Tlv::kStatus, sizeof(status), status) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kStatus, sizeof(status), status) == kThreadError_None)
     {
         BecomeDetached();
         ExitNow();
     }
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = kThreadError_Parse);
     VerifyOrExit(mode.GetMode() == mDeviceMode, error = kThreadError_Drop);
 
@@ -2883,18 +2861,16 @@ ThreadError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::M
     {
     case kDeviceStateDetached:
         // Response
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
         VerifyOrExit(response.IsValid(), error = kThreadError_Parse);
         VerifyOrExit(memcmp(response.GetResponse(), mParentRequest.mChallenge,
                             sizeof(mParentRequest.mChallenge)) == 0,
                      error = kThreadError_Drop);
 
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter),
-                                          linkFrameCounter));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
         VerifyOrExit(linkFrameCounter.IsValid(), error = kThreadError_Parse);
 
-        if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) ==
-            kThreadError_None)
+        if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == kThreadError_None)
         {
             VerifyOrExit(mleFrameCounter.IsValid(), error = kThreadError_Parse);
         }
@@ -2912,7 +2888,7 @@ ThreadError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::M
 
     case kDeviceStateChild:
         // Source Address
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
         VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
 
         if (GetRouterId(sourceAddress.GetRloc16()) != GetRouterId(GetRloc16()))
@@ -2925,7 +2901,7 @@ ThreadError Mle::HandleChildUpdateResponse(const Message &aMessage, const Ip6::M
         SuccessOrExit(error = HandleLeaderData(aMessage, aMessageInfo));
 
         // Timeout optional
-        if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == kThreadError_None)
+        if (tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout) == kThreadError_None)
         {
             VerifyOrExit(timeout.IsValid(), error = kThreadError_Parse);
             mTimeout = timeout.GetTimeout();
@@ -2969,16 +2945,17 @@ ThreadError Mle::HandleAnnounce(const Message &aMessage, const Ip6::MessageInfo
     ActiveTimestampTlv timestamp;
     const MeshCoP::Timestamp *localTimestamp;
     PanIdTlv panid;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received announce");
 
-    SuccessOrExit(Tlv::GetTlv(aMessage, Tlv::kChannel, sizeof(channel), channel));
+    SuccessOrExit(tlvIndex.Get(Tlv::kChannel, sizeof(channel), channel));
     VerifyOrExit(channel.IsValid(),);
 
-    SuccessOrExit(Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(timestamp), timestamp));
+    SuccessOrExit(tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(timestamp), timestamp));
     VerifyOrExit(timestamp.IsValid(),);
 
-    SuccessOrExit(Tlv::GetTlv(aMessage, Tlv::kPanId, sizeof(panid), panid));
+    SuccessOrExit(tlvIndex.Get(Tlv::kPanId, sizeof(panid), panid));
     VerifyOrExit(panid.IsValid(),);
 
     localTimestamp = mNetif.GetActiveDataset().GetNetwork().GetTimestamp();
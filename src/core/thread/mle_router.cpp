@@ -58,11 +58,13 @@ MleRouter::MleRouter(ThreadNetif &aThreadNetif):
     mStateUpdateTimer(aThreadNetif.GetIp6().mTimerScheduler, &MleRouter::HandleStateUpdateTimer, this),
     mChildUpdateRequestTimer(aThreadNetif.GetIp6().mTimerScheduler, &MleRouter::HandleChildUpdateRequestTimer, this),
     mAddressSolicit(OPENTHREAD_URI_ADDRESS_SOLICIT, &MleRouter::HandleAddressSolicit, this),
-    mAddressRelease(OPENTHREAD_URI_ADDRESS_RELEASE, &MleRouter::HandleAddressRelease, this)
+    mAddressRelease(OPENTHREAD_URI_ADDRESS_RELEASE, &MleRouter::HandleAddressRelease, this),
+    mNeighborIndex(mChildren, mRouters)
 {
     mDeviceMode |= ModeTlv::kModeFFD | ModeTlv::kModeFullNetworkData;
 
     mChallengeTimeout = 0;
+    mChallengeTime = 0;
     mNextChildId = kMaxChildId;
     mRouterIdSequence = 0;
     memset(mChildren, 0, sizeof(mChildren));
@@ -78,6 +80,7 @@ MleRouter::MleRouter(ThreadNetif &aThreadNetif):
     SetRouterId(kInvalidRouterId);
     mPreviousPartitionId = 0;
     mRouterIdSequenceLastUpdated = 0;
+    mRouterSelectionJitterStart = 0;
     mRouterRoleEnabled = true;
 }
 
@@ -157,6 +160,8 @@ uint8_t MleRouter::AllocateRouterId(uint8_t aRouterId)
     router->mAllocated = true;
     router->mLastHeard = Timer::GetNow();
     memset(&router->mMacAddr, 0, sizeof(router->mMacAddr));
+    mNeighborIndex.UpdateRouter(*router);
+    ScheduleStateUpdate(router->mLastHeard, Timer::SecToMsec(kMaxLeaderToRouterTimeout));
 
     // bump sequence number
     mRouterIdSequence++;
@@ -198,6 +203,9 @@ ThreadError MleRouter::ReleaseRouterId(uint8_t aRouterId)
     mNetif.GetNetworkDataLeader().RemoveBorderRouter(GetRloc16(aRouterId));
     ResetAdvertiseInterval();
 
+    // routes through the released router are lost
+    ScheduleStateUpdate(Timer::GetNow(), 0);
+
 exit:
     return error;
 }
@@ -273,6 +281,7 @@ ThreadError MleRouter::BecomeLeader(void)
     SetRouterId(routerId);
 
     memcpy(&router->mMacAddr, mNetif.GetMac().GetExtAddress(), sizeof(router->mMacAddr));
+    mNeighborIndex.UpdateRouter(*router);
     mAdvertiseTimer.Stop();
     mNetif.GetAddressResolver().Clear();
 
@@ -324,7 +333,7 @@ ThreadError MleRouter::HandleDetachStart(void)
 ThreadError MleRouter::HandleChildStart(otMleAttachFilter aFilter)
 {
     mRouterIdSequenceLastUpdated = Timer::GetNow();
-    mRouterSelectionJitterTimeout = (otPlatRandomGet() % mRouterSelectionJitter) + 1;
+    StartRouterSelectionJitter();
 
     StopLeader();
     mStateUpdateTimer.Start(kStateUpdatePeriod);
@@ -464,6 +473,7 @@ uint8_t MleRouter::GetNetworkIdTimeout(void) const
 void MleRouter::SetNetworkIdTimeout(uint8_t aTimeout)
 {
     mNetworkIdTimeout = aTimeout;
+    ScheduleStateUpdate(mRouterIdSequenceLastUpdated, Timer::SecToMsec(mNetworkIdTimeout));
 }
 
 uint8_t MleRouter::GetRouterUpgradeThreshold(void) const
@@ -611,6 +621,8 @@ ThreadError MleRouter::SendLinkRequest(Neighbor *aNeighbor)
         }
 
         mChallengeTimeout = (((2 * kMaxResponseDelay) + kStateUpdatePeriod - 1) / kStateUpdatePeriod);
+        mChallengeTime = Timer::GetNow();
+        ScheduleStateUpdate(mChallengeTime, mChallengeTimeout * kStateUpdatePeriod);
 
         SuccessOrExit(error = AppendChallenge(*message, mChallenge, sizeof(mChallenge)));
         destination.mFields.m8[0] = 0xff;
@@ -655,6 +667,7 @@ ThreadError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Mes
     SourceAddressTlv sourceAddress;
     TlvRequestTlv tlvRequest;
     uint16_t rloc16;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received link request");
 
@@ -666,22 +679,22 @@ ThreadError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Mes
     macAddr.Set(aMessageInfo.GetPeerAddr());
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = kThreadError_Parse);
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid() && version.GetVersion() == kVersion, error = kThreadError_Parse);
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
     {
         VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
         VerifyOrExit(leaderData.GetPartitionId() == mLeaderData.GetPartitionId(), ;);
     }
 
     // Source Address
-    if (Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == kThreadError_None)
     {
         VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
 
@@ -706,6 +719,7 @@ ThreadError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Mes
                     static_cast<const ThreadMessageInfo *>(aMessageInfo.GetLinkInfo());
 
                 memcpy(&neighbor->mMacAddr, &macAddr, sizeof(neighbor->mMacAddr));
+                mNeighborIndex.UpdateRouter(*static_cast<Router *>(neighbor));
                 neighbor->mLinkInfo.Clear();
                 neighbor->mLinkInfo.AddRss(mNetif.GetMac().GetNoiseFloor(), threadMessageInfo->mRss);
                 neighbor->mLinkFailures = 0;
@@ -732,7 +746,7 @@ ThreadError MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::Mes
     }
 
     // TLV Request
-    if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == kThreadError_None)
     {
         VerifyOrExit(tlvRequest.IsValid(), error = kThreadError_Parse);
     }
@@ -877,19 +891,20 @@ ThreadError MleRouter::HandleLinkAccept(const Message &aMessage, const Ip6::Mess
     LinkMarginTlv linkMargin;
     ChallengeTlv challenge;
     TlvRequestTlv tlvRequest;
+    TlvIndex tlvIndex(aMessage);
 
     macAddr.Set(aMessageInfo.GetPeerAddr());
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid(), error = kThreadError_Parse);
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid(), error = kThreadError_Parse);
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
 
     // Remove stale neighbors
@@ -900,13 +915,11 @@ ThreadError MleRouter::HandleLinkAccept(const Message &aMessage, const Ip6::Mess
     }
 
     // Link-Layer Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter),
-                                      linkFrameCounter));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = kThreadError_Parse);
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) ==
-        kThreadError_None)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == kThreadError_None)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = kThreadError_Parse);
     }
@@ -947,17 +960,17 @@ ThreadError MleRouter::HandleLinkAccept(const Message &aMessage, const Ip6::Mess
 
     case kDeviceStateDetached:
         // Address16
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kAddress16, sizeof(address16), address16));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kAddress16, sizeof(address16), address16));
         VerifyOrExit(address16.IsValid(), error = kThreadError_Parse);
         VerifyOrExit(GetRloc16() == address16.GetRloc16(), error = kThreadError_Drop);
 
         // Route
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kRoute, sizeof(route), route));
         VerifyOrExit(route.IsValid(), error = kThreadError_Parse);
         SuccessOrExit(error = ProcessRouteTlv(route));
 
         // Leader Data
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
         VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
         SetLeaderData(leaderData.GetPartitionId(), leaderData.GetWeighting(), leaderData.GetLeaderRouterId());
 
@@ -976,7 +989,7 @@ ThreadError MleRouter::HandleLinkAccept(const Message &aMessage, const Ip6::Mess
         break;
 
     case kDeviceStateChild:
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkMargin, sizeof(linkMargin), linkMargin));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkMargin, sizeof(linkMargin), linkMargin));
         VerifyOrExit(linkMargin.IsValid(), error = kThreadError_Parse);
         router->mLinkQualityOut = LinkQualityInfo::ConvertLinkMarginToLinkQuality(linkMargin.GetLinkMargin());
         break;
@@ -984,12 +997,12 @@ ThreadError MleRouter::HandleLinkAccept(const Message &aMessage, const Ip6::Mess
     case kDeviceStateRouter:
     case kDeviceStateLeader:
         // Leader Data
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
         VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
         VerifyOrExit(leaderData.GetPartitionId() == mLeaderData.GetPartitionId(), ;);
 
         // Link Margin
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkMargin, sizeof(linkMargin), linkMargin));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkMargin, sizeof(linkMargin), linkMargin));
         VerifyOrExit(linkMargin.IsValid(), error = kThreadError_Parse);
         router->mLinkQualityOut = LinkQualityInfo::ConvertLinkMarginToLinkQuality(linkMargin.GetLinkMargin());
 
@@ -1004,6 +1017,7 @@ ThreadError MleRouter::HandleLinkAccept(const Message &aMessage, const Ip6::Mess
 
     // finish link synchronization
     memcpy(&router->mMacAddr, &macAddr, sizeof(router->mMacAddr));
+    mNeighborIndex.UpdateRouter(*router);
     router->mValid.mRloc16 = sourceAddress.GetRloc16();
     router->mValid.mLinkFrameCounter = linkFrameCounter.GetFrameCounter();
     router->mValid.mMleFrameCounter = mleFrameCounter.GetFrameCounter();
@@ -1014,15 +1028,16 @@ ThreadError MleRouter::HandleLinkAccept(const Message &aMessage, const Ip6::Mess
     router->mLinkFailures = 0;
     router->mState = Neighbor::kStateValid;
     router->mKeySequence = aKeySequence;
+    ScheduleStateUpdate(router->mLastHeard, Timer::SecToMsec(kMaxNeighborAge));
 
     if (aRequest)
     {
         // Challenge
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
         VerifyOrExit(challenge.IsValid(), error = kThreadError_Parse);
 
         // TLV Request
-        if (Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == kThreadError_None)
+        if (tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest) == kThreadError_None)
         {
             VerifyOrExit(tlvRequest.IsValid(), error = kThreadError_Parse);
         }
@@ -1070,19 +1085,7 @@ exit:
 
 Child *MleRouter::FindChild(const Mac::ExtAddress &aAddress)
 {
-    Child *rval = NULL;
-
-    for (int i = 0; i < mMaxChildrenAllowed; i++)
-    {
-        if (mChildren[i].mState != Neighbor::kStateInvalid &&
-            memcmp(&mChildren[i].mMacAddr, &aAddress, sizeof(mChildren[i].mMacAddr)) == 0)
-        {
-            ExitNow(rval = &mChildren[i]);
-        }
-    }
-
-exit:
-    return rval;
+    return mNeighborIndex.FindChild(aAddress, NeighborIndex::kInStateAnyExceptInvalid);
 }
 
 uint8_t MleRouter::LqiToCost(uint8_t aLqi)
@@ -1259,11 +1262,12 @@ ThreadError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::M
     Neighbor *neighbor;
     uint8_t routerId;
     uint8_t routerCount;
+    TlvIndex tlvIndex(aMessage);
 
     macAddr.Set(aMessageInfo.GetPeerAddr());
 
     // Source Address
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress));
     VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
 
     // Remove stale neighbors
@@ -1274,11 +1278,11 @@ ThreadError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::M
     }
 
     // Leader Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData));
     VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
 
     // Route Data
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kRoute, sizeof(route), route));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kRoute, sizeof(route), route));
     VerifyOrExit(route.IsValid(), error = kThreadError_Parse);
 
     partitionId = leaderData.GetPartitionId();
@@ -1379,7 +1383,7 @@ ThreadError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::M
             (mRouterSelectionJitterTimeout == 0) &&
             (GetActiveRouterCount() < mRouterUpgradeThreshold))
         {
-            mRouterSelectionJitterTimeout = (otPlatRandomGet() % mRouterSelectionJitter) + 1;
+            StartRouterSelectionJitter();
             ExitNow();
         }
 
@@ -1426,6 +1430,7 @@ ThreadError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::M
         else if ((mDeviceMode & ModeTlv::kModeFFD) && (router->mState != Neighbor::kStateValid))
         {
             memcpy(&router->mMacAddr, &macAddr, sizeof(router->mMacAddr));
+            mNeighborIndex.UpdateRouter(*router);
             router->mLinkInfo.Clear();
             router->mLinkInfo.AddRss(mNetif.GetMac().GetNoiseFloor(), threadMessageInfo->mRss);
             router->mLinkFailures = 0;
@@ -1456,7 +1461,7 @@ ThreadError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::M
             HasSmallNumberOfChildren() &&
             HasOneNeighborwithComparableConnectivity(route, routerId))
         {
-            mRouterSelectionJitterTimeout = (otPlatRandomGet() % mRouterSelectionJitter) + 1;
+            StartRouterSelectionJitter();
         }
 
     // fall through
@@ -1473,6 +1478,7 @@ ThreadError MleRouter::HandleAdvertisement(const Message &aMessage, const Ip6::M
         if (router->mState != Neighbor::kStateValid)
         {
             memcpy(&router->mMacAddr, &macAddr, sizeof(router->mMacAddr));
+            mNeighborIndex.UpdateRouter(*router);
             router->mLinkInfo.Clear();
             router->mLinkInfo.AddRss(mNetif.GetMac().GetNoiseFloor(), threadMessageInfo->mRss);
             router->mLinkFailures = 0;
@@ -1575,6 +1581,7 @@ void MleRouter::UpdateRoutes(const RouteTlv &aRoute, uint8_t aRouterId)
                             mRouters[i].mNextHop = kInvalidRouterId;
                             mRouters[i].mCost = 0;
                             mRouters[i].mLastHeard = Timer::GetNow();
+                            ScheduleStateUpdate(mRouters[i].mLastHeard, Timer::SecToMsec(kMaxLeaderToRouterTimeout));
                         }
                     }
                 }
@@ -1628,6 +1635,7 @@ ThreadError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::M
     ScanMaskTlv scanMask;
     ChallengeTlv challenge;
     Child *child;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received parent request");
 
@@ -1652,11 +1660,11 @@ ThreadError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::M
     macAddr.Set(aMessageInfo.GetPeerAddr());
 
     // Version
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kVersion, sizeof(version), version));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kVersion, sizeof(version), version));
     VerifyOrExit(version.IsValid() && version.GetVersion() == kVersion, error = kThreadError_Parse);
 
     // Scan Mask
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kScanMask, sizeof(scanMask), scanMask));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kScanMask, sizeof(scanMask), scanMask));
     VerifyOrExit(scanMask.IsValid(), error = kThreadError_Parse);
 
     switch (GetDeviceState())
@@ -1676,7 +1684,7 @@ ThreadError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::M
     }
 
     // Challenge
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge));
     VerifyOrExit(challenge.IsValid(), error = kThreadError_Parse);
 
     child = FindChild(macAddr);
@@ -1696,6 +1704,7 @@ ThreadError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::M
 
         // MAC Address
         memcpy(&child->mMacAddr, &macAddr, sizeof(child->mMacAddr));
+        mNeighborIndex.UpdateChild(*child);
         child->mLinkInfo.Clear();
         child->mLinkInfo.AddRss(mNetif.GetMac().GetNoiseFloor(), threadMessageInfo->mRss);
         child->mLinkFailures = 0;
@@ -1704,6 +1713,7 @@ ThreadError MleRouter::HandleParentRequest(const Message &aMessage, const Ip6::M
 
         child->mLastHeard = Timer::GetNow();
         child->mTimeout = Timer::MsecToSec(kMaxChildIdRequestTimeout);
+        ScheduleStateUpdate(child->mLastHeard, Timer::SecToMsec(child->mTimeout));
     }
 
     SuccessOrExit(error = SendParentResponse(child, challenge, !scanMask.IsEndDeviceFlagSet()));
@@ -1719,21 +1729,20 @@ void MleRouter::HandleStateUpdateTimer(void *aContext)
 
 void MleRouter::HandleStateUpdateTimer(void)
 {
+    uint32_t now = Timer::GetNow();
+    uint32_t delay = kMaxStateUpdateDelay;
     bool routerStateUpdate = false;
 
-    if (mChallengeTimeout > 0)
+    if (mChallengeTimeout > 0 && HasExpired(now, mChallengeTime, mChallengeTimeout * kStateUpdatePeriod, delay))
     {
-        mChallengeTimeout--;
+        mChallengeTimeout = 0;
     }
 
-    if (mRouterSelectionJitterTimeout > 0)
+    if (mRouterSelectionJitterTimeout > 0 &&
+        HasExpired(now, mRouterSelectionJitterStart, Timer::SecToMsec(mRouterSelectionJitterTimeout), delay))
     {
-        mRouterSelectionJitterTimeout--;
-
-        if (mRouterSelectionJitterTimeout == 0)
-        {
-            routerStateUpdate = true;
-        }
+        mRouterSelectionJitterTimeout = 0;
+        routerStateUpdate = true;
     }
 
     switch (GetDeviceState())
@@ -1773,9 +1782,15 @@ void MleRouter::HandleStateUpdateTimer(void)
         // verify path to leader
         otLogDebgMle(GetInstance(), "network id timeout = %d", GetLeaderAge());
 
-        if (GetLeaderAge() >= mNetworkIdTimeout)
+        if (HasExpired(now, mRouterIdSequenceLastUpdated, Timer::SecToMsec(mNetworkIdTimeout), delay))
         {
             BecomeChild(kMleAttachSamePartition1);
+
+            // retry while the leader remains unreachable
+            if (delay > kStateUpdatePeriod)
+            {
+                delay = kStateUpdatePeriod;
+            }
         }
 
         if (routerStateUpdate && GetActiveRouterCount() > mRouterDowngradeThreshold)
@@ -1789,15 +1804,23 @@ void MleRouter::HandleStateUpdateTimer(void)
     case kDeviceStateLeader:
 
         // update router id sequence
-        if (GetLeaderAge() >= kRouterIdSequencePeriod)
+        if (HasExpired(now, mRouterIdSequenceLastUpdated, Timer::SecToMsec(kRouterIdSequencePeriod), delay))
         {
             mRouterIdSequence++;
-            mRouterIdSequenceLastUpdated = Timer::GetNow();
+            mRouterIdSequenceLastUpdated = now;
+
+            if (delay > Timer::SecToMsec(kRouterIdSequencePeriod))
+            {
+                delay = Timer::SecToMsec(kRouterIdSequencePeriod);
+            }
         }
 
         break;
     }
 
+    // arm the timer before aging neighbors so that deadlines scheduled while removing them are kept
+    mStateUpdateTimer.Start(delay);
+
     // update children state
     for (int i = 0; i < mMaxChildrenAllowed; i++)
     {
@@ -1821,7 +1844,7 @@ void MleRouter::HandleStateUpdateTimer(void)
             break;
         }
 
-        if ((Timer::GetNow() - mChildren[i].mLastHeard) >= timeout)
+        if (HasExpired(now, mChildren[i].mLastHeard, timeout, delay))
         {
             RemoveNeighbor(mChildren[i]);
         }
@@ -1832,9 +1855,12 @@ void MleRouter::HandleStateUpdateTimer(void)
     {
         if (mRouters[i].mState == Neighbor::kStateValid)
         {
-            if ((Timer::GetNow() - mRouters[i].mLastHeard) >= Timer::SecToMsec(kMaxNeighborAge))
+            if (HasExpired(now, mRouters[i].mLastHeard, Timer::SecToMsec(kMaxNeighborAge), delay))
             {
                 RemoveNeighbor(mRouters[i]);
+
+                // RemoveNeighbor() restarts mLastHeard
+                now = Timer::GetNow();
             }
         }
 
@@ -1842,17 +1868,17 @@ void MleRouter::HandleStateUpdateTimer(void)
         {
             if (mRouters[i].mAllocated)
             {
-                if (!IsRouterIdValid(mRouters[i].mNextHop) &&
-                    GetLinkCost(i) >= kMaxRouteCost &&
-                    (Timer::GetNow() - mRouters[i].mLastHeard) >= Timer::SecToMsec(kMaxLeaderToRouterTimeout))
+                if (HasExpired(now, mRouters[i].mLastHeard, Timer::SecToMsec(kMaxLeaderToRouterTimeout), delay) &&
+                    !IsRouterIdValid(mRouters[i].mNextHop) &&
+                    GetLinkCost(i) >= kMaxRouteCost)
                 {
                     ReleaseRouterId(i);
                 }
             }
             else if (mRouters[i].mReclaimDelay)
             {
-                if ((Timer::GetNow() - mRouters[i].mLastHeard) >=
-                    Timer::SecToMsec((kMaxLeaderToRouterTimeout + kRouterIdReuseDelay)))
+                if (HasExpired(now, mRouters[i].mLastHeard,
+                               Timer::SecToMsec((kMaxLeaderToRouterTimeout + kRouterIdReuseDelay)), delay))
                 {
                     mRouters[i].mReclaimDelay = false;
                 }
@@ -1860,12 +1886,54 @@ void MleRouter::HandleStateUpdateTimer(void)
         }
     }
 
-    mStateUpdateTimer.Start(kStateUpdatePeriod);
+    ScheduleStateUpdate(now, delay);
+
+exit:
+    return;
+}
+
+void MleRouter::ScheduleStateUpdate(uint32_t aStart, uint32_t aTimeout)
+{
+    uint32_t delay = kMaxStateUpdateDelay;
+    int32_t remaining;
+
+    // only active roles age their neighbors, the timer is (re)started when entering one
+    VerifyOrExit(IsAttached() && mStateUpdateTimer.IsRunning(), ;);
+
+    if (HasExpired(Timer::GetNow(), aStart, aTimeout, delay))
+    {
+        delay = 0;
+    }
+
+    remaining = static_cast<int32_t>(mStateUpdateTimer.Gett0() + mStateUpdateTimer.Getdt() - Timer::GetNow());
+    VerifyOrExit(remaining > 0 && delay < static_cast<uint32_t>(remaining), ;);
+
+    mStateUpdateTimer.Start(delay);
 
 exit:
     return;
 }
 
+bool MleRouter::HasExpired(uint32_t aNow, uint32_t aStart, uint32_t aTimeout, uint32_t &aDelay)
+{
+    uint32_t elapsed = aNow - aStart;
+    bool rval = (elapsed >= aTimeout);
+
+    if (!rval && (aTimeout - elapsed) < aDelay)
+    {
+        aDelay = aTimeout - elapsed;
+    }
+
+    return rval;
+}
+
+void MleRouter::StartRouterSelectionJitter(void)
+{
+    mRouterSelectionJitterTimeout = (otPlatRandomGet() % mRouterSelectionJitter) + 1;
+    mRouterSelectionJitterStart = Timer::GetNow();
+    ScheduleStateUpdate(mRouterSelectionJitterStart, Timer::SecToMsec(mRouterSelectionJitterTimeout));
+}
+
 void MleRouter::HandleChildUpdateRequestTimer(void *aContext)
 {
     static_cast<MleRouter *>(aContext)->HandleChildUpdateRequestTimer();
@@ -1885,6 +1953,7 @@ void MleRouter::HandleChildUpdateRequestTimer(void)
             if ((mChildren[i].mMode & ModeTlv::kModeRxOnWhenIdle) != 0)
             {
                 mChildren[i].mTimeout = Timer::MsecToSec(kMaxChildUpdateResponseTimeout);
+                ScheduleStateUpdate(mChildren[i].mLastHeard, Timer::SecToMsec(mChildren[i].mTimeout));
             }
 
             mChildUpdateRequestTimer.Start(kChildUpdateRequestPeriod);
@@ -1987,6 +2056,8 @@ ThreadError MleRouter::UpdateChildAddresses(const AddressRegistrationTlv &aTlv,
         }
     }
 
+    mNeighborIndex.UpdateChild(aChild);
+
     return kThreadError_None;
 }
 
@@ -2007,6 +2078,7 @@ ThreadError MleRouter::HandleChildIdRequest(const Message &aMessage, const Ip6::
     PendingTimestampTlv pendingTimestamp;
     Child *child;
     uint8_t numTlvs;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Child ID Request");
 
@@ -2019,18 +2091,16 @@ ThreadError MleRouter::HandleChildIdRequest(const Message &aMessage, const Ip6::
     VerifyOrExit((child = FindChild(macAddr)) != NULL, ;);
 
     // Response
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kResponse, sizeof(response), response));
     VerifyOrExit(response.IsValid() &&
                  memcmp(response.GetResponse(), child->mAttachChallenge, sizeof(child->mAttachChallenge)) == 0, ;);
 
     // Link-Layer Frame Counter
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter),
-                                      linkFrameCounter));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter));
     VerifyOrExit(linkFrameCounter.IsValid(), error = kThreadError_Parse);
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) ==
-        kThreadError_None)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == kThreadError_None)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = kThreadError_Parse);
     }
@@ -2040,11 +2110,11 @@ ThreadError MleRouter::HandleChildIdRequest(const Message &aMessage, const Ip6::
     }
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = kThreadError_Parse);
 
     // Timeout
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout));
     VerifyOrExit(timeout.IsValid(), error = kThreadError_Parse);
 
     // Ip6 Address
@@ -2052,19 +2122,19 @@ ThreadError MleRouter::HandleChildIdRequest(const Message &aMessage, const Ip6::
 
     if ((mode.GetMode() & ModeTlv::kModeFFD) == 0)
     {
-        SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kAddressRegistration, sizeof(address), address));
+        SuccessOrExit(error = tlvIndex.Get(Tlv::kAddressRegistration, sizeof(address), address));
         VerifyOrExit(address.IsValid(), error = kThreadError_Parse);
     }
 
     // TLV Request
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
     VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= sizeof(child->mRequestTlvs),
                  error = kThreadError_Parse);
 
     // Active Timestamp
     activeTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = kThreadError_Parse);
     }
@@ -2072,7 +2142,7 @@ ThreadError MleRouter::HandleChildIdRequest(const Message &aMessage, const Ip6::
     // Pending Timestamp
     pendingTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = kThreadError_Parse);
     }
@@ -2176,11 +2246,12 @@ ThreadError MleRouter::HandleChildUpdateRequest(const Message &aMessage, const I
     Child *child;
     uint8_t tlvs[kMaxResponseTlvs];
     uint8_t tlvslength = 0;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Child Update Request from child");
 
     // Mode
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kMode, sizeof(mode), mode));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kMode, sizeof(mode), mode));
     VerifyOrExit(mode.IsValid(), error = kThreadError_Parse);
 
     // Find Child
@@ -2208,7 +2279,7 @@ ThreadError MleRouter::HandleChildUpdateRequest(const Message &aMessage, const I
     tlvs[tlvslength++] = Tlv::kLeaderData;
 
     // Challenge
-    if (Tlv::GetTlv(aMessage, Tlv::kChallenge, sizeof(challenge), challenge) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kChallenge, sizeof(challenge), challenge) == kThreadError_None)
     {
         VerifyOrExit(challenge.IsValid(), error = kThreadError_Parse);
         tlvs[tlvslength++] = Tlv::kResponse;
@@ -2217,7 +2288,7 @@ ThreadError MleRouter::HandleChildUpdateRequest(const Message &aMessage, const I
     }
 
     // Ip6 Address TLV
-    if (Tlv::GetTlv(aMessage, Tlv::kAddressRegistration, sizeof(address), address) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kAddressRegistration, sizeof(address), address) == kThreadError_None)
     {
         VerifyOrExit(address.IsValid(), error = kThreadError_Parse);
         UpdateChildAddresses(address, *child);
@@ -2225,7 +2296,7 @@ ThreadError MleRouter::HandleChildUpdateRequest(const Message &aMessage, const I
     }
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
     {
         VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
 
@@ -2256,7 +2327,7 @@ ThreadError MleRouter::HandleChildUpdateRequest(const Message &aMessage, const I
     }
 
     // Timeout
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout) == kThreadError_None)
     {
         VerifyOrExit(timeout.IsValid(), error = kThreadError_Parse);
         child->mTimeout = timeout.GetTimeout();
@@ -2264,6 +2335,7 @@ ThreadError MleRouter::HandleChildUpdateRequest(const Message &aMessage, const I
     }
 
     child->mLastHeard = Timer::GetNow();
+    ScheduleStateUpdate(child->mLastHeard, Timer::SecToMsec(child->mTimeout));
     mNetif.GetMeshForwarder().SetSrcMatchAsShort(*child, true);
 
     SendChildUpdateResponse(child, aMessageInfo, tlvs, tlvslength, &challenge);
@@ -2286,6 +2358,7 @@ ThreadError MleRouter::HandleChildUpdateResponse(const Message &aMessage, const
     MleFrameCounterTlv mleFrameCounter;
     LeaderDataTlv leaderData;
     Child *child;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Child Update Response from child");
 
@@ -2295,49 +2368,49 @@ ThreadError MleRouter::HandleChildUpdateResponse(const Message &aMessage, const
     VerifyOrExit((child = FindChild(macAddr)) != NULL, error = kThreadError_NotFound);
 
     // Source Address
-    if (Tlv::GetTlv(aMessage, Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kSourceAddress, sizeof(sourceAddress), sourceAddress) == kThreadError_None)
     {
         VerifyOrExit(sourceAddress.IsValid(), error = kThreadError_Parse);
         VerifyOrExit(child->mValid.mRloc16 == sourceAddress.GetRloc16(), error = kThreadError_Parse);
     }
 
     // Response
-    if (Tlv::GetTlv(aMessage, Tlv::kResponse, sizeof(response), response) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kResponse, sizeof(response), response) == kThreadError_None)
     {
         VerifyOrExit(response.IsValid() &&
                      memcmp(response.GetResponse(), child->mAttachChallenge, sizeof(child->mAttachChallenge)) == 0, ;);
     }
 
     // Link-Layer Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kLinkFrameCounter, sizeof(linkFrameCounter), linkFrameCounter) == kThreadError_None)
     {
         VerifyOrExit(linkFrameCounter.IsValid(), error = kThreadError_Parse);
         child->mValid.mLinkFrameCounter = linkFrameCounter.GetFrameCounter();
     }
 
     // MLE Frame Counter
-    if (Tlv::GetTlv(aMessage, Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kMleFrameCounter, sizeof(mleFrameCounter), mleFrameCounter) == kThreadError_None)
     {
         VerifyOrExit(mleFrameCounter.IsValid(), error = kThreadError_Parse);
         child->mValid.mMleFrameCounter = mleFrameCounter.GetFrameCounter();
     }
 
     // Timeout
-    if (Tlv::GetTlv(aMessage, Tlv::kTimeout, sizeof(timeout), timeout) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kTimeout, sizeof(timeout), timeout) == kThreadError_None)
     {
         VerifyOrExit(timeout.IsValid(), error = kThreadError_Parse);
         child->mTimeout = timeout.GetTimeout();
     }
 
     // Ip6 Address
-    if (Tlv::GetTlv(aMessage, Tlv::kAddressRegistration, sizeof(address), address) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kAddressRegistration, sizeof(address), address) == kThreadError_None)
     {
         VerifyOrExit(address.IsValid(), error = kThreadError_Parse);
         UpdateChildAddresses(address, *child);
     }
 
     // Leader Data
-    if (Tlv::GetTlv(aMessage, Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kLeaderData, sizeof(leaderData), leaderData) == kThreadError_None)
     {
         VerifyOrExit(leaderData.IsValid(), error = kThreadError_Parse);
 
@@ -2353,6 +2426,7 @@ ThreadError MleRouter::HandleChildUpdateResponse(const Message &aMessage, const
 
     SetChildStateToValid(child);
     child->mLastHeard = Timer::GetNow();
+    ScheduleStateUpdate(child->mLastHeard, Timer::SecToMsec(child->mTimeout));
     child->mKeySequence = aKeySequence;
     child->mLinkInfo.AddRss(mNetif.GetMac().GetNoiseFloor(), threadMessageInfo->mRss);
     mNetif.GetMeshForwarder().SetSrcMatchAsShort(*child, true);
@@ -2369,17 +2443,18 @@ ThreadError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Mes
     PendingTimestampTlv pendingTimestamp;
     uint8_t tlvs[4];
     uint8_t numTlvs;
+    TlvIndex tlvIndex(aMessage);
 
     otLogInfoMle(GetInstance(), "Received Data Request");
 
     // TLV Request
-    SuccessOrExit(error = Tlv::GetTlv(aMessage, Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
+    SuccessOrExit(error = tlvIndex.Get(Tlv::kTlvRequest, sizeof(tlvRequest), tlvRequest));
     VerifyOrExit(tlvRequest.IsValid() && tlvRequest.GetLength() <= sizeof(tlvs), error = kThreadError_Parse);
 
     // Active Timestamp
     activeTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kActiveTimestamp, sizeof(activeTimestamp), activeTimestamp) == kThreadError_None)
     {
         VerifyOrExit(activeTimestamp.IsValid(), error = kThreadError_Parse);
     }
@@ -2387,7 +2462,7 @@ ThreadError MleRouter::HandleDataRequest(const Message &aMessage, const Ip6::Mes
     // Pending Timestamp
     pendingTimestamp.SetLength(0);
 
-    if (Tlv::GetTlv(aMessage, Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
+    if (tlvIndex.Get(Tlv::kPendingTimestamp, sizeof(pendingTimestamp), pendingTimestamp) == kThreadError_None)
     {
         VerifyOrExit(pendingTimestamp.IsValid(), error = kThreadError_Parse);
     }
@@ -2649,6 +2724,7 @@ ThreadError MleRouter::SendChildIdResponse(Child *aChild)
 
         // allocate Child ID
         aChild->mValid.mRloc16 = mNetif.GetMac().GetShortAddress() | mNextChildId;
+        mNeighborIndex.UpdateChild(*aChild);
     }
 
     SuccessOrExit(error = AppendAddress16(*message, aChild->mValid.mRloc16));
@@ -2873,29 +2949,12 @@ exit:
 
 Child *MleRouter::GetChild(uint16_t aAddress)
 {
-    for (int i = 0; i < mMaxChildrenAllowed; i++)
-    {
-        if (mChildren[i].IsStateValidOrRestoring() && mChildren[i].mValid.mRloc16 == aAddress)
-        {
-            return &mChildren[i];
-        }
-    }
-
-    return NULL;
+    return mNeighborIndex.FindChild(aAddress, NeighborIndex::kInStateValidOrRestoring);
 }
 
 Child *MleRouter::GetChild(const Mac::ExtAddress &aAddress)
 {
-    for (int i = 0; i < mMaxChildrenAllowed; i++)
-    {
-        if (mChildren[i].IsStateValidOrRestoring() &&
-            memcmp(&mChildren[i].mMacAddr, &aAddress, sizeof(mChildren[i].mMacAddr)) == 0)
-        {
-            return &mChildren[i];
-        }
-    }
-
-    return NULL;
+    return mNeighborIndex.FindChild(aAddress, NeighborIndex::kInStateValidOrRestoring);
 }
 
 Child *MleRouter::GetChild(const Mac::Address &aAddress)
@@ -3007,6 +3066,12 @@ ThreadError MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
             {
                 ResetAdvertiseInterval();
             }
+
+            if (mDeviceState == kDeviceStateLeader)
+            {
+                // routes through the removed router are lost
+                ScheduleStateUpdate(Timer::GetNow(), 0);
+            }
         }
 
         break;
@@ -3021,6 +3086,7 @@ ThreadError MleRouter::RemoveNeighbor(Neighbor &aNeighbor)
 Neighbor *MleRouter::GetNeighbor(uint16_t aAddress)
 {
     Neighbor *rval = NULL;
+    Router *router;
 
     if (aAddress == Mac::kShortAddrBroadcast || aAddress == Mac::kShortAddrInvalid)
     {
@@ -3039,20 +3105,17 @@ Neighbor *MleRouter::GetNeighbor(uint16_t aAddress)
 
     case kDeviceStateRouter:
     case kDeviceStateLeader:
-        for (int i = 0; i < mMaxChildrenAllowed; i++)
+        if ((rval = GetChild(aAddress)) != NULL)
         {
-            if (mChildren[i].IsStateValidOrRestoring() && mChildren[i].mValid.mRloc16 == aAddress)
-            {
-                ExitNow(rval = &mChildren[i]);
-            }
+            ExitNow();
         }
 
-        for (int i = 0; i <= kMaxRouterId; i++)
+        // the router table is indexed by Router ID
+        router = GetRouter(GetRouterId(aAddress));
+
+        if (router != NULL && router->mState == Neighbor::kStateValid && router->mValid.mRloc16 == aAddress)
         {
-            if (mRouters[i].mState == Neighbor::kStateValid && mRouters[i].mValid.mRloc16 == aAddress)
-            {
-                ExitNow(rval = &mRouters[i]);
-            }
+            rval = router;
         }
 
         break;
@@ -3078,22 +3141,14 @@ Neighbor *MleRouter::GetNeighbor(const Mac::ExtAddress &aAddress)
 
     case kDeviceStateRouter:
     case kDeviceStateLeader:
-        for (int i = 0; i < mMaxChildrenAllowed; i++)
+        if ((rval = GetChild(aAddress)) != NULL)
         {
-            if (mChildren[i].IsStateValidOrRestoring() &&
-                memcmp(&mChildren[i].mMacAddr, &aAddress, sizeof(mChildren[i].mMacAddr)) == 0)
-            {
-                ExitNow(rval = &mChildren[i]);
-            }
+            ExitNow();
         }
 
-        for (int i = 0; i <= kMaxRouterId; i++)
+        if ((rval = mNeighborIndex.FindRouter(aAddress, NeighborIndex::kInStateValid)) != NULL)
         {
-            if (mRouters[i].mState == Neighbor::kStateValid &&
-                memcmp(&mRouters[i].mMacAddr, &aAddress, sizeof(mRouters[i].mMacAddr)) == 0)
-            {
-                ExitNow(rval = &mRouters[i]);
-            }
+            ExitNow();
         }
 
         if (mParentRequestState != kParentIdle)
@@ -3135,6 +3190,7 @@ Neighbor *MleRouter::GetNeighbor(const Ip6::Address &aAddress)
     Lowpan::Context context;
     Child *child;
     Router *router;
+    uint16_t rloc16;
     Neighbor *rval = NULL;
 
     if (aAddress.IsLinkLocal())
@@ -3155,58 +3211,37 @@ Neighbor *MleRouter::GetNeighbor(const Ip6::Address &aAddress)
         ExitNow(rval = GetNeighbor(macaddr));
     }
 
-    if (mNetif.GetNetworkDataLeader().GetContext(aAddress, context) != kThreadError_None)
+    // only an RLOC may resolve to a router, and only an RLOC needs the mesh-local context check
+    if (aAddress.mFields.m16[4] == HostSwap16(0x0000) &&
+        aAddress.mFields.m16[5] == HostSwap16(0x00ff) &&
+        aAddress.mFields.m16[6] == HostSwap16(0xfe00) &&
+        mNetif.GetNetworkDataLeader().GetContext(aAddress, context) == kThreadError_None &&
+        context.mContextId == 0)
     {
-        context.mContextId = 0xff;
-    }
-
-    for (int i = 0; i < mMaxChildrenAllowed; i++)
-    {
-        child = &mChildren[i];
-
-        if (!child->IsStateValidOrRestoring())
-        {
-            continue;
-        }
+        rloc16 = HostSwap16(aAddress.mFields.m16[7]);
 
-        if (context.mContextId == 0 &&
-            aAddress.mFields.m16[4] == HostSwap16(0x0000) &&
-            aAddress.mFields.m16[5] == HostSwap16(0x00ff) &&
-            aAddress.mFields.m16[6] == HostSwap16(0xfe00) &&
-            aAddress.mFields.m16[7] == HostSwap16(child->mValid.mRloc16))
+        if ((child = GetChild(rloc16)) != NULL)
         {
             ExitNow(rval = child);
         }
 
-        for (int j = 0; j < Child::kMaxIp6AddressPerChild; j++)
+        if ((child = mNeighborIndex.FindChild(aAddress, NeighborIndex::kInStateValidOrRestoring)) != NULL)
         {
-            if (memcmp(&child->mIp6Address[j], aAddress.mFields.m8, sizeof(child->mIp6Address[j])) == 0)
-            {
-                ExitNow(rval = child);
-            }
+            ExitNow(rval = child);
         }
-    }
 
-    VerifyOrExit(context.mContextId == 0, rval = NULL);
+        router = GetRouter(GetRouterId(rloc16));
 
-    for (int i = 0; i <= kMaxRouterId; i++)
-    {
-        router = &mRouters[i];
-
-        if (router->mState != Neighbor::kStateValid)
+        if (router != NULL && router->mState == Neighbor::kStateValid && router->mValid.mRloc16 == rloc16)
         {
-            continue;
+            rval = router;
         }
 
-        if (aAddress.mFields.m16[4] == HostSwap16(0x0000) &&
-            aAddress.mFields.m16[5] == HostSwap16(0x00ff) &&
-            aAddress.mFields.m16[6] == HostSwap16(0xfe00) &&
-            aAddress.mFields.m16[7] == HostSwap16(router->mValid.mRloc16))
-        {
-            ExitNow(rval = router);
-        }
+        ExitNow();
     }
 
+    rval = mNeighborIndex.FindChild(aAddress, NeighborIndex::kInStateValidOrRestoring);
+
 exit:
     return rval;
 }
@@ -3405,6 +3440,7 @@ ThreadError MleRouter::RestoreChildren(void)
 
         memcpy(&child->mMacAddr, &childInfo.mExtAddress, sizeof(child->mMacAddr));
         child->mValid.mRloc16 = childInfo.mRloc16;
+        mNeighborIndex.UpdateChild(*child);
         child->mTimeout = childInfo.mTimeout;
         child->mMode = (childInfo.mRxOnWhenIdle ? ModeTlv::kModeRxOnWhenIdle : 0) |
                        (childInfo.mSecureDataRequest ? ModeTlv::kModeSecureDataRequest : 0) |
@@ -3412,6 +3448,7 @@ ThreadError MleRouter::RestoreChildren(void)
                        (childInfo.mFullNetworkData ? ModeTlv::kModeFullNetworkData : 0);
         child->mState = Neighbor::kStateRestored;
         child->mLastHeard = Timer::GetNow();
+        ScheduleStateUpdate(child->mLastHeard, Timer::SecToMsec(child->mTimeout));
         mNetif.GetMeshForwarder().SetSrcMatchAsShort(*child, true);
     }
 
@@ -3592,6 +3629,11 @@ void MleRouter::ResolveRoutingLoops(uint16_t aSourceMac, uint16_t aDestRloc16)
         // invalidate next hop
         router->mNextHop = kInvalidRouterId;
         ResetAdvertiseInterval();
+
+        if (mDeviceState == kDeviceStateLeader)
+        {
+            ScheduleStateUpdate(Timer::GetNow(), 0);
+        }
     }
 }
 
@@ -3945,6 +3987,7 @@ void MleRouter::HandleAddressSolicit(Coap::Header &aHeader, Message &aMessage, c
     if (router != NULL)
     {
         memcpy(&router->mMacAddr, macAddr64Tlv.GetMacAddr(), sizeof(router->mMacAddr));
+        mNeighborIndex.UpdateRouter(*router);
     }
     else
     {
@@ -4411,6 +4454,7 @@ void MleRouter::SetChildStateToValid(Child *aChild)
     VerifyOrExit(aChild->mState != Neighbor::kStateValid, ;);
 
     aChild->mState = Neighbor::kStateValid;
+    ScheduleStateUpdate(aChild->mLastHeard, Timer::SecToMsec(aChild->mTimeout));
     mNetif.SetStateChangedFlags(OT_THREAD_CHILD_ADDED);
     StoreChild(aChild->mValid.mRloc16);
 
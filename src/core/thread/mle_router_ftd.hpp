@@ -46,6 +46,7 @@
 #include <net/udp6.hpp>
 #include <thread/mle.hpp>
 #include <thread/mle_tlvs.hpp>
+#include <thread/neighbor_index.hpp>
 #include <thread/thread_tlvs.hpp>
 #include <thread/topology.hpp>
 
@@ -608,6 +609,7 @@ private:
     {
         kDiscoveryMaxJitter = 250u,  ///< Maximum jitter time used to delay Discovery Responses in milliseconds.
         kStateUpdatePeriod = 1000u,  ///< State update period in milliseconds.
+        kMaxStateUpdateDelay = 0xffffffffu,  ///< State update delay when nothing is due, in milliseconds.
         kUnsolicitedDataResponseJitter = 500u,  ///< Maximum delay before unsolicited Data Response in milliseconds.
     };
 
@@ -694,6 +696,9 @@ private:
     bool HandleAdvertiseTimer(void);
     static void HandleStateUpdateTimer(void *aContext);
     void HandleStateUpdateTimer(void);
+    void ScheduleStateUpdate(uint32_t aStart, uint32_t aTimeout);
+    static bool HasExpired(uint32_t aNow, uint32_t aStart, uint32_t aTimeout, uint32_t &aDelay);
+    void StartRouterSelectionJitter(void);
     static void HandleChildUpdateRequestTimer(void *aContext);
     void HandleChildUpdateRequestTimer(void);
 
@@ -706,11 +711,14 @@ private:
 
     uint8_t mRouterIdSequence;
     uint32_t mRouterIdSequenceLastUpdated;
+    uint32_t mRouterSelectionJitterStart;
     Router mRouters[kMaxRouterId + 1];
     uint8_t mMaxChildrenAllowed;
     Child mChildren[kMaxChildren];
+    NeighborIndex mNeighborIndex;
 
     uint8_t mChallengeTimeout;
+    uint32_t mChallengeTime;
     uint8_t mChallenge[8];
     uint16_t mNextChildId;
     uint8_t mNetworkIdTimeout;
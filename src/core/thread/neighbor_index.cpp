@@ -0,0 +1,266 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the hashed neighbor index used by the Thread Router and Leader roles.
+ */
+
+#ifdef OPENTHREAD_CONFIG_FILE
+#include OPENTHREAD_CONFIG_FILE
+#else
+#include <openthread-config.h>
+#endif
+
+#include <string.h>
+
+#include <common/code_utils.hpp>
+#include <common/debug.hpp>
+#include <thread/neighbor_index.hpp>
+
+namespace Thread {
+
+NeighborIndex::NeighborIndex(Child *aChildren, Router *aRouters):
+    mChildren(aChildren),
+    mRouters(aRouters)
+{
+    Clear();
+}
+
+void NeighborIndex::Clear(void)
+{
+    memset(mHeads, 0xff, sizeof(mHeads));
+    memset(mNext, 0xff, sizeof(mNext));
+    memset(mBucket, 0xff, sizeof(mBucket));
+}
+
+void NeighborIndex::UpdateChild(const Child &aChild)
+{
+    uint16_t index = static_cast<uint16_t>(&aChild - mChildren);
+    uint16_t entry;
+
+    Link(kRloc16Base + index, Hash(kKeyRloc16, &aChild.mValid.mRloc16, sizeof(aChild.mValid.mRloc16)));
+    Link(kExtAddressBase + index, Hash(kKeyExtAddress, &aChild.mMacAddr, sizeof(aChild.mMacAddr)));
+
+    for (uint8_t i = 0; i < kNumChildAddresses; i++)
+    {
+        entry = static_cast<uint16_t>(kIp6AddressBase + index * kNumChildAddresses + i);
+
+        if (aChild.mIp6Address[i].IsUnspecified())
+        {
+            Unlink(entry);
+        }
+        else
+        {
+            Link(entry, Hash(kKeyIp6Address, &aChild.mIp6Address[i], sizeof(aChild.mIp6Address[i])));
+        }
+    }
+}
+
+void NeighborIndex::UpdateRouter(const Router &aRouter)
+{
+    uint16_t index = static_cast<uint16_t>(&aRouter - mRouters);
+
+    Link(kExtAddressBase + kNumChildren + index, Hash(kKeyExtAddress, &aRouter.mMacAddr, sizeof(aRouter.mMacAddr)));
+}
+
+Child *NeighborIndex::FindChild(uint16_t aRloc16, StateFilter aFilter) const
+{
+    Child *rval = NULL;
+    Child *child;
+
+    for (uint16_t entry = mHeads[Hash(kKeyRloc16, &aRloc16, sizeof(aRloc16))]; entry != kInvalidEntry;
+         entry = mNext[entry])
+    {
+        if (entry >= kExtAddressBase)
+        {
+            continue;
+        }
+
+        child = &mChildren[entry - kRloc16Base];
+
+        if (child->mValid.mRloc16 == aRloc16 && MatchesFilter(*child, aFilter) && (rval == NULL || child < rval))
+        {
+            rval = child;
+        }
+    }
+
+    return rval;
+}
+
+Child *NeighborIndex::FindChild(const Mac::ExtAddress &aAddress, StateFilter aFilter) const
+{
+    Child *rval = NULL;
+    Child *child;
+
+    for (uint16_t entry = mHeads[Hash(kKeyExtAddress, &aAddress, sizeof(aAddress))]; entry != kInvalidEntry;
+         entry = mNext[entry])
+    {
+        if (entry < kExtAddressBase || entry >= kExtAddressBase + kNumChildren)
+        {
+            continue;
+        }
+
+        child = &mChildren[entry - kExtAddressBase];
+
+        if (memcmp(&child->mMacAddr, &aAddress, sizeof(child->mMacAddr)) == 0 && MatchesFilter(*child, aFilter) &&
+            (rval == NULL || child < rval))
+        {
+            rval = child;
+        }
+    }
+
+    return rval;
+}
+
+Child *NeighborIndex::FindChild(const Ip6::Address &aAddress, StateFilter aFilter) const
+{
+    Child *rval = NULL;
+    Child *child;
+    uint16_t slot;
+
+    VerifyOrExit(!aAddress.IsUnspecified(), ;);
+
+    for (uint16_t entry = mHeads[Hash(kKeyIp6Address, &aAddress, sizeof(aAddress))]; entry != kInvalidEntry;
+         entry = mNext[entry])
+    {
+        if (entry < kIp6AddressBase)
+        {
+            continue;
+        }
+
+        slot = entry - kIp6AddressBase;
+        child = &mChildren[slot / kNumChildAddresses];
+
+        if (child->mIp6Address[slot % kNumChildAddresses] == aAddress && MatchesFilter(*child, aFilter) &&
+            (rval == NULL || child < rval))
+        {
+            rval = child;
+        }
+    }
+
+exit:
+    return rval;
+}
+
+Router *NeighborIndex::FindRouter(const Mac::ExtAddress &aAddress, StateFilter aFilter) const
+{
+    Router *rval = NULL;
+    Router *router;
+
+    for (uint16_t entry = mHeads[Hash(kKeyExtAddress, &aAddress, sizeof(aAddress))]; entry != kInvalidEntry;
+         entry = mNext[entry])
+    {
+        if (entry < kExtAddressBase + kNumChildren || entry >= kIp6AddressBase)
+        {
+            continue;
+        }
+
+        router = &mRouters[entry - kExtAddressBase - kNumChildren];
+
+        if (memcmp(&router->mMacAddr, &aAddress, sizeof(router->mMacAddr)) == 0 && MatchesFilter(*router, aFilter) &&
+            (rval == NULL || router < rval))
+        {
+            rval = router;
+        }
+    }
+
+    return rval;
+}
+
+uint16_t NeighborIndex::Hash(KeyType aType, const void *aKey, uint8_t aLength)
+{
+    // 32-bit FNV-1a, seeded with the key type so that equal bytes of different key types spread apart.
+    const uint8_t *key = static_cast<const uint8_t *>(aKey);
+    uint32_t hash = 2166136261UL ^ static_cast<uint32_t>(aType);
+
+    for (uint8_t i = 0; i < aLength; i++)
+    {
+        hash ^= key[i];
+        hash *= 16777619UL;
+    }
+
+    return static_cast<uint16_t>((hash ^ (hash >> 16)) % kNumBuckets);
+}
+
+bool NeighborIndex::MatchesFilter(const Neighbor &aNeighbor, StateFilter aFilter)
+{
+    bool rval = false;
+
+    switch (aFilter)
+    {
+    case kInStateAnyExceptInvalid:
+        rval = (aNeighbor.mState != Neighbor::kStateInvalid);
+        break;
+
+    case kInStateValidOrRestoring:
+        rval = aNeighbor.IsStateValidOrRestoring();
+        break;
+
+    case kInStateValid:
+        rval = (aNeighbor.mState == Neighbor::kStateValid);
+        break;
+    }
+
+    return rval;
+}
+
+void NeighborIndex::Link(uint16_t aEntry, uint16_t aBucket)
+{
+    VerifyOrExit(mBucket[aEntry] != aBucket, ;);
+
+    Unlink(aEntry);
+
+    mNext[aEntry] = mHeads[aBucket];
+    mHeads[aBucket] = aEntry;
+    mBucket[aEntry] = aBucket;
+
+exit:
+    return;
+}
+
+void NeighborIndex::Unlink(uint16_t aEntry)
+{
+    uint16_t *cur;
+
+    VerifyOrExit(mBucket[aEntry] != kInvalidEntry, ;);
+
+    for (cur = &mHeads[mBucket[aEntry]]; *cur != aEntry; cur = &mNext[*cur])
+    {
+        assert(*cur != kInvalidEntry);
+    }
+
+    *cur = mNext[aEntry];
+    mNext[aEntry] = kInvalidEntry;
+    mBucket[aEntry] = kInvalidEntry;
+
+exit:
+    return;
+}
+
+}  // namespace Thread
@@ -0,0 +1,196 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the hashed neighbor index used by the Thread Router and Leader roles.
+ */
+
+#ifndef NEIGHBOR_INDEX_HPP_
+#define NEIGHBOR_INDEX_HPP_
+
+#include "openthread/types.h"
+
+#include <mac/mac_frame.hpp>
+#include <net/ip6_address.hpp>
+#include <thread/mle_constants.hpp>
+#include <thread/topology.hpp>
+
+namespace Thread {
+
+/**
+ * @addtogroup core-mle-router
+ *
+ * @{
+ */
+
+/**
+ * This class implements a hash index over the child and router tables.
+ *
+ * Children are indexed by RLOC16, IEEE 802.15.4 Extended Address and registered IPv6 addresses.  Routers are indexed
+ * by IEEE 802.15.4 Extended Address (the router table is already indexed by Router ID).
+ *
+ * Every entry is re-indexed whenever one of its keys is written.  Lookups verify the key and the link state of each
+ * candidate, so entries whose state changes or whose key is cleared without re-indexing are never returned.
+ *
+ */
+class NeighborIndex
+{
+public:
+    /**
+     * This enumeration defines the link states accepted by a lookup.
+     *
+     */
+    enum StateFilter
+    {
+        kInStateAnyExceptInvalid,   ///< Accept any state except `kStateInvalid`.
+        kInStateValidOrRestoring,   ///< Accept states for which `IsStateValidOrRestoring()` is `true`.
+        kInStateValid,              ///< Accept only `kStateValid`.
+    };
+
+    /**
+     * This constructor initializes the index.
+     *
+     * @param[in]  aChildren  A pointer to the child table (`Mle::kMaxChildren` entries).
+     * @param[in]  aRouters   A pointer to the router table (`Mle::kMaxRouterId + 1` entries).
+     *
+     */
+    NeighborIndex(Child *aChildren, Router *aRouters);
+
+    /**
+     * This method removes all entries from the index.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method re-indexes the RLOC16, Extended Address and registered IPv6 addresses of a child.
+     *
+     * @param[in]  aChild  A reference to an entry of the child table.
+     *
+     */
+    void UpdateChild(const Child &aChild);
+
+    /**
+     * This method re-indexes the Extended Address of a router.
+     *
+     * @param[in]  aRouter  A reference to an entry of the router table.
+     *
+     */
+    void UpdateRouter(const Router &aRouter);
+
+    /**
+     * This method finds a child by RLOC16.
+     *
+     * @param[in]  aRloc16  The RLOC16.
+     * @param[in]  aFilter  The link states to accept.
+     *
+     * @returns A pointer to the matching child with the lowest index, or NULL if none is found.
+     *
+     */
+    Child *FindChild(uint16_t aRloc16, StateFilter aFilter) const;
+
+    /**
+     * This method finds a child by Extended Address.
+     *
+     * @param[in]  aAddress  A reference to the Extended Address.
+     * @param[in]  aFilter   The link states to accept.
+     *
+     * @returns A pointer to the matching child with the lowest index, or NULL if none is found.
+     *
+     */
+    Child *FindChild(const Mac::ExtAddress &aAddress, StateFilter aFilter) const;
+
+    /**
+     * This method finds a child by one of its registered IPv6 addresses.
+     *
+     * @param[in]  aAddress  A reference to the IPv6 address.
+     * @param[in]  aFilter   The link states to accept.
+     *
+     * @returns A pointer to the matching child with the lowest index, or NULL if none is found.
+     *
+     */
+    Child *FindChild(const Ip6::Address &aAddress, StateFilter aFilter) const;
+
+    /**
+     * This method finds a router by Extended Address.
+     *
+     * @param[in]  aAddress  A reference to the Extended Address.
+     * @param[in]  aFilter   The link states to accept.
+     *
+     * @returns A pointer to the matching router with the lowest Router ID, or NULL if none is found.
+     *
+     */
+    Router *FindRouter(const Mac::ExtAddress &aAddress, StateFilter aFilter) const;
+
+private:
+    enum
+    {
+        kNumChildren       = Mle::kMaxChildren,
+        kNumRouters        = Mle::kMaxRouterId + 1,
+        kNumChildAddresses = Child::kMaxIp6AddressPerChild,
+
+        // Entry ranges, one entry per key slot.
+        kRloc16Base        = 0,
+        kExtAddressBase    = kRloc16Base + kNumChildren,
+        kIp6AddressBase    = kExtAddressBase + kNumChildren + kNumRouters,
+        kNumEntries        = kIp6AddressBase + kNumChildren * kNumChildAddresses,
+
+        kNumBuckets        = kNumEntries,
+        kInvalidEntry      = 0xffff,
+    };
+
+    enum KeyType
+    {
+        kKeyRloc16,
+        kKeyExtAddress,
+        kKeyIp6Address,
+    };
+
+    static uint16_t Hash(KeyType aType, const void *aKey, uint8_t aLength);
+    static bool MatchesFilter(const Neighbor &aNeighbor, StateFilter aFilter);
+
+    void Link(uint16_t aEntry, uint16_t aBucket);
+    void Unlink(uint16_t aEntry);
+
+    Child *mChildren;
+    Router *mRouters;
+
+    uint16_t mHeads[kNumBuckets];
+    uint16_t mNext[kNumEntries];
+    uint16_t mBucket[kNumEntries];
+};
+
+/**
+ * @}
+ *
+ */
+
+}  // namespace Thread
+
+#endif  // NEIGHBOR_INDEX_HPP_
@@ -66,6 +66,7 @@ void LeaderBase::Reset(void)
     mVersion = static_cast<uint8_t>(otPlatRandomGet());
     mStableVersion = static_cast<uint8_t>(otPlatRandomGet());
     mLength = 0;
+    mCompiledValid = false;
     mNetif.SetStateChangedFlags(OT_THREAD_NETDATA_UPDATED);
 }
 
@@ -79,20 +80,27 @@ uint8_t LeaderBase::GetStableVersion(void) const
     return mStableVersion;
 }
 
-ThreadError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
+void LeaderBase::UpdateCompiled(void)
 {
-    PrefixTlv *prefix;
-    ContextTlv *contextTlv;
-
-    aContext.mPrefixLength = 0;
-
-    if (PrefixMatch(mNetif.GetMle().GetMeshLocalPrefix(), aAddress.mFields.m8, 64) >= 0)
+    if (!mCompiledValid || mCompiledVersion != mVersion || mCompiledLength != mLength)
     {
-        aContext.mPrefix = mNetif.GetMle().GetMeshLocalPrefix();
-        aContext.mPrefixLength = 64;
-        aContext.mContextId = 0;
-        aContext.mCompressFlag = true;
+        Compile();
     }
+}
+
+void LeaderBase::Compile(void)
+{
+    PrefixTlv *prefix;
+    CompiledPrefix *compiled;
+    BorderRouterTlv *borderRouter;
+    BorderRouterEntry *borderRouterEntry;
+    HasRouteTlv *hasRoute;
+    uint8_t numRoutes = 0;
+    uint8_t numDefaultRoutes = 0;
+    uint8_t index;
+
+    mNumCompiledPrefixes = 0;
+    memset(mCompiledContexts, kInvalidCompiledPrefix, sizeof(mCompiledContexts));
 
     for (NetworkDataTlv *cur = reinterpret_cast<NetworkDataTlv *>(mTlvs);
          cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
@@ -105,74 +113,167 @@ ThreadError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context
 
         prefix = static_cast<PrefixTlv *>(cur);
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
-        {
-            continue;
-        }
+        VerifyOrExit(mNumCompiledPrefixes < kMaxCompiledPrefixes, ;);
 
-        contextTlv = FindContext(*prefix);
+        compiled = &mCompiledPrefixes[mNumCompiledPrefixes];
+        compiled->mPrefixOffset = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(prefix) - mTlvs);
+        compiled->mContextOffset = 0;
+        compiled->mHasBorderRouter = false;
+        compiled->mRoutesStart = numRoutes;
+        compiled->mNumRoutes = 0;
+        compiled->mDefaultRoutesStart = numDefaultRoutes;
+        compiled->mNumDefaultRoutes = 0;
 
-        if (contextTlv == NULL)
+        for (NetworkDataTlv *subCur = prefix->GetSubTlvs(); subCur < prefix->GetNext(); subCur = subCur->GetNext())
         {
-            continue;
+            switch (subCur->GetType())
+            {
+            case NetworkDataTlv::kTypeContext:
+                if (compiled->mContextOffset == 0)
+                {
+                    uint8_t contextId = static_cast<ContextTlv *>(subCur)->GetContextId();
+
+                    compiled->mContextOffset = static_cast<uint8_t>(reinterpret_cast<uint8_t *>(subCur) - mTlvs);
+
+                    if (mCompiledContexts[contextId] == kInvalidCompiledPrefix)
+                    {
+                        mCompiledContexts[contextId] = mNumCompiledPrefixes;
+                    }
+                }
+
+                break;
+
+            case NetworkDataTlv::kTypeBorderRouter:
+                borderRouter = static_cast<BorderRouterTlv *>(subCur);
+                compiled->mHasBorderRouter = true;
+
+                for (uint8_t i = 0; i < borderRouter->GetNumEntries(); i++)
+                {
+                    borderRouterEntry = borderRouter->GetEntry(i);
+
+                    if (borderRouterEntry->IsDefaultRoute() && numDefaultRoutes < kMaxCompiledDefaultRoutes)
+                    {
+                        mCompiledDefaultRoutes[numDefaultRoutes++] =
+                            static_cast<uint8_t>(reinterpret_cast<uint8_t *>(borderRouterEntry) - mTlvs);
+                        compiled->mNumDefaultRoutes++;
+                    }
+                }
+
+                break;
+
+            case NetworkDataTlv::kTypeHasRoute:
+                hasRoute = static_cast<HasRouteTlv *>(subCur);
+
+                for (uint8_t i = 0; i < hasRoute->GetNumEntries() && numRoutes < kMaxCompiledRoutes; i++)
+                {
+                    mCompiledRoutes[numRoutes++] =
+                        static_cast<uint8_t>(reinterpret_cast<uint8_t *>(hasRoute->GetEntry(i)) - mTlvs);
+                    compiled->mNumRoutes++;
+                }
+
+                break;
+
+            default:
+                break;
+            }
         }
 
-        if (prefix->GetPrefixLength() > aContext.mPrefixLength)
+        // insertion sort by prefix length, longest first, keeping Network Data order for equal lengths
+        for (index = mNumCompiledPrefixes;
+             index > 0 &&
+             GetPrefixTlv(mCompiledPrefixes[mCompiledPrefixesByLength[index - 1]]).GetPrefixLength() <
+             prefix->GetPrefixLength();
+             index--)
         {
-            aContext.mPrefix = prefix->GetPrefix();
-            aContext.mPrefixLength = prefix->GetPrefixLength();
-            aContext.mContextId = contextTlv->GetContextId();
-            aContext.mCompressFlag = contextTlv->IsCompress();
+            mCompiledPrefixesByLength[index] = mCompiledPrefixesByLength[index - 1];
         }
+
+        mCompiledPrefixesByLength[index] = mNumCompiledPrefixes;
+        mNumCompiledPrefixes++;
     }
 
-    return (aContext.mPrefixLength > 0) ? kThreadError_None : kThreadError_Error;
+exit:
+    mCompiledVersion = mVersion;
+    mCompiledLength = mLength;
+    mCompiledValid = true;
 }
 
-ThreadError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
+ThreadError LeaderBase::GetContext(const Ip6::Address &aAddress, Lowpan::Context &aContext)
 {
-    ThreadError error = kThreadError_Error;
     PrefixTlv *prefix;
     ContextTlv *contextTlv;
 
-    if (aContextId == 0)
+    UpdateCompiled();
+
+    aContext.mPrefixLength = 0;
+
+    if (PrefixMatch(mNetif.GetMle().GetMeshLocalPrefix(), aAddress.mFields.m8, 64) >= 0)
     {
         aContext.mPrefix = mNetif.GetMle().GetMeshLocalPrefix();
         aContext.mPrefixLength = 64;
         aContext.mContextId = 0;
         aContext.mCompressFlag = true;
-        ExitNow(error = kThreadError_None);
     }
 
-    for (NetworkDataTlv *cur = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
-         cur = cur->GetNext())
+    for (uint8_t i = 0; i < mNumCompiledPrefixes; i++)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+        const CompiledPrefix &compiled = mCompiledPrefixes[mCompiledPrefixesByLength[i]];
 
-        prefix = static_cast<PrefixTlv *>(cur);
-        contextTlv = FindContext(*prefix);
+        prefix = &GetPrefixTlv(compiled);
 
-        if (contextTlv == NULL)
+        // all remaining prefixes are shorter than the current match
+        if (prefix->GetPrefixLength() <= aContext.mPrefixLength)
         {
-            continue;
+            break;
         }
 
-        if (contextTlv->GetContextId() != aContextId)
+        if (compiled.mContextOffset == 0 ||
+            PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
         {
             continue;
         }
 
+        contextTlv = &GetContextTlv(compiled);
         aContext.mPrefix = prefix->GetPrefix();
         aContext.mPrefixLength = prefix->GetPrefixLength();
         aContext.mContextId = contextTlv->GetContextId();
         aContext.mCompressFlag = contextTlv->IsCompress();
+        break;
+    }
+
+    return (aContext.mPrefixLength > 0) ? kThreadError_None : kThreadError_Error;
+}
+
+ThreadError LeaderBase::GetContext(uint8_t aContextId, Lowpan::Context &aContext)
+{
+    ThreadError error = kThreadError_Error;
+    PrefixTlv *prefix;
+    ContextTlv *contextTlv;
+
+    if (aContextId == 0)
+    {
+        aContext.mPrefix = mNetif.GetMle().GetMeshLocalPrefix();
+        aContext.mPrefixLength = 64;
+        aContext.mContextId = 0;
+        aContext.mCompressFlag = true;
         ExitNow(error = kThreadError_None);
     }
 
+    VerifyOrExit(aContextId < kNumContextIds, ;);
+
+    UpdateCompiled();
+
+    VerifyOrExit(mCompiledContexts[aContextId] != kInvalidCompiledPrefix, ;);
+
+    prefix = &GetPrefixTlv(mCompiledPrefixes[mCompiledContexts[aContextId]]);
+    contextTlv = &GetContextTlv(mCompiledPrefixes[mCompiledContexts[aContextId]]);
+
+    aContext.mPrefix = prefix->GetPrefix();
+    aContext.mPrefixLength = prefix->GetPrefixLength();
+    aContext.mContextId = contextTlv->GetContextId();
+    aContext.mCompressFlag = contextTlv->IsCompress();
+    error = kThreadError_None;
+
 exit:
     return error;
 }
@@ -214,28 +315,21 @@ bool LeaderBase::IsOnMesh(const Ip6::Address &aAddress)
         ExitNow(rval = true);
     }
 
-    for (NetworkDataTlv *cur = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
-         cur = cur->GetNext())
+    UpdateCompiled();
+
+    for (uint8_t i = 0; i < mNumCompiledPrefixes; i++)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
+        if (!mCompiledPrefixes[i].mHasBorderRouter)
         {
             continue;
         }
 
-        prefix = static_cast<PrefixTlv *>(cur);
+        prefix = &GetPrefixTlv(mCompiledPrefixes[i]);
 
-        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) < 0)
+        if (PrefixMatch(prefix->GetPrefix(), aAddress.mFields.m8, prefix->GetPrefixLength()) >= 0)
         {
-            continue;
-        }
-
-        if (FindBorderRouter(*prefix) == NULL)
-        {
-            continue;
+            ExitNow(rval = true);
         }
-
-        ExitNow(rval = true);
     }
 
 exit:
@@ -248,16 +342,11 @@ ThreadError LeaderBase::RouteLookup(const Ip6::Address &aSource, const Ip6::Addr
     ThreadError error = kThreadError_NoRoute;
     PrefixTlv *prefix;
 
-    for (NetworkDataTlv *cur = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
-         cur = cur->GetNext())
-    {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
-        {
-            continue;
-        }
+    UpdateCompiled();
 
-        prefix = static_cast<PrefixTlv *>(cur);
+    for (uint8_t i = 0; i < mNumCompiledPrefixes; i++)
+    {
+        prefix = &GetPrefixTlv(mCompiledPrefixes[i]);
 
         if (PrefixMatch(prefix->GetPrefix(), aSource.mFields.m8, prefix->GetPrefixLength()) >= 0)
         {
@@ -266,7 +355,7 @@ ThreadError LeaderBase::RouteLookup(const Ip6::Address &aSource, const Ip6::Addr
                 ExitNow(error = kThreadError_None);
             }
 
-            if (DefaultRouteLookup(*prefix, aRloc16) == kThreadError_None)
+            if (DefaultRouteLookup(mCompiledPrefixes[i], aRloc16) == kThreadError_None)
             {
                 if (aPrefixMatch)
                 {
@@ -287,24 +376,21 @@ ThreadError LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Addres
 {
     ThreadError error = kThreadError_NoRoute;
     PrefixTlv *prefix;
-    HasRouteTlv *hasRoute;
     HasRouteEntry *entry;
     HasRouteEntry *rvalRoute = NULL;
     uint8_t rval_plen = 0;
     int8_t plen;
-    NetworkDataTlv *cur;
-    NetworkDataTlv *subCur;
 
-    for (cur = reinterpret_cast<NetworkDataTlv *>(mTlvs);
-         cur < reinterpret_cast<NetworkDataTlv *>(mTlvs + mLength);
-         cur = cur->GetNext())
+    for (uint8_t i = 0; i < mNumCompiledPrefixes; i++)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypePrefix)
+        const CompiledPrefix &compiled = mCompiledPrefixes[i];
+
+        if (compiled.mNumRoutes == 0)
         {
             continue;
         }
 
-        prefix = static_cast<PrefixTlv *>(cur);
+        prefix = &GetPrefixTlv(compiled);
 
         if (prefix->GetDomainId() != aDomainId)
         {
@@ -316,30 +402,19 @@ ThreadError LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Addres
         if (plen > rval_plen)
         {
             // select border router
-            for (subCur = prefix->GetSubTlvs(); subCur < prefix->GetNext(); subCur = subCur->GetNext())
+            for (uint8_t j = compiled.mRoutesStart; j < compiled.mRoutesStart + compiled.mNumRoutes; j++)
             {
-                if (subCur->GetType() != NetworkDataTlv::kTypeHasRoute)
-                {
-                    continue;
-                }
+                entry = reinterpret_cast<HasRouteEntry *>(mTlvs + mCompiledRoutes[j]);
 
-                hasRoute = static_cast<HasRouteTlv *>(subCur);
-
-                for (uint8_t i = 0; i < hasRoute->GetNumEntries(); i++)
+                if (rvalRoute == NULL ||
+                    entry->GetPreference() > rvalRoute->GetPreference() ||
+                    (entry->GetPreference() == rvalRoute->GetPreference() &&
+                     mNetif.GetMle().GetRouteCost(entry->GetRloc()) <
+                     mNetif.GetMle().GetRouteCost(rvalRoute->GetRloc())))
                 {
-                    entry = hasRoute->GetEntry(i);
-
-                    if (rvalRoute == NULL ||
-                        entry->GetPreference() > rvalRoute->GetPreference() ||
-                        (entry->GetPreference() == rvalRoute->GetPreference() &&
-                         mNetif.GetMle().GetRouteCost(entry->GetRloc()) <
-                         mNetif.GetMle().GetRouteCost(rvalRoute->GetRloc())))
-                    {
-                        rvalRoute = entry;
-                        rval_plen = static_cast<uint8_t>(plen);
-                    }
+                    rvalRoute = entry;
+                    rval_plen = static_cast<uint8_t>(plen);
                 }
-
             }
         }
     }
@@ -362,38 +437,22 @@ ThreadError LeaderBase::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Addres
     return error;
 }
 
-ThreadError LeaderBase::DefaultRouteLookup(PrefixTlv &aPrefix, uint16_t *aRloc16)
+ThreadError LeaderBase::DefaultRouteLookup(const CompiledPrefix &aPrefix, uint16_t *aRloc16)
 {
     ThreadError error = kThreadError_NoRoute;
-    BorderRouterTlv *borderRouter;
     BorderRouterEntry *entry;
     BorderRouterEntry *route = NULL;
 
-    for (NetworkDataTlv *cur = aPrefix.GetSubTlvs(); cur < aPrefix.GetNext(); cur = cur->GetNext())
+    for (uint8_t i = aPrefix.mDefaultRoutesStart; i < aPrefix.mDefaultRoutesStart + aPrefix.mNumDefaultRoutes; i++)
     {
-        if (cur->GetType() != NetworkDataTlv::kTypeBorderRouter)
-        {
-            continue;
-        }
-
-        borderRouter = static_cast<BorderRouterTlv *>(cur);
+        entry = reinterpret_cast<BorderRouterEntry *>(mTlvs + mCompiledDefaultRoutes[i]);
 
-        for (uint8_t i = 0; i < borderRouter->GetNumEntries(); i++)
+        if (route == NULL ||
+            entry->GetPreference() > route->GetPreference() ||
+            (entry->GetPreference() == route->GetPreference() &&
+             mNetif.GetMle().GetRouteCost(entry->GetRloc()) < mNetif.GetMle().GetRouteCost(route->GetRloc())))
         {
-            entry = borderRouter->GetEntry(i);
-
-            if (entry->IsDefaultRoute() == false)
-            {
-                continue;
-            }
-
-            if (route == NULL ||
-                entry->GetPreference() > route->GetPreference() ||
-                (entry->GetPreference() == route->GetPreference() &&
-                 mNetif.GetMle().GetRouteCost(entry->GetRloc()) < mNetif.GetMle().GetRouteCost(route->GetRloc())))
-            {
-                route = entry;
-            }
+            route = entry;
         }
     }
 
@@ -417,6 +476,7 @@ void LeaderBase::SetNetworkData(uint8_t aVersion, uint8_t aStableVersion, bool a
     mStableVersion = aStableVersion;
     memcpy(mTlvs, aData, aDataLength);
     mLength = aDataLength;
+    mCompiledValid = false;
 
     if (aStable)
     {
@@ -218,11 +218,56 @@ protected:
     uint8_t         mVersion;
 
 private:
+    enum
+    {
+        kMaxCompiledPrefixes      = kMaxSize / sizeof(PrefixTlv),
+        kMaxCompiledRoutes        = kMaxSize / sizeof(HasRouteEntry),
+        kMaxCompiledDefaultRoutes = kMaxSize / sizeof(BorderRouterEntry),
+        kNumContextIds            = 16,
+        kInvalidCompiledPrefix    = 0xff,
+    };
+
+    /**
+     * This structure represents a Prefix TLV in the compiled view of the Network Data.
+     *
+     * All offsets are relative to `mTlvs`, so the view stays valid until the Network Data changes.
+     *
+     */
+    struct CompiledPrefix
+    {
+        uint8_t mPrefixOffset;         ///< Offset of the Prefix TLV.
+        uint8_t mContextOffset;        ///< Offset of the first Context TLV, or 0 if none.
+        bool    mHasBorderRouter;      ///< Whether the prefix contains a Border Router TLV.
+        uint8_t mRoutesStart;          ///< Index of the first Has Route entry in `mCompiledRoutes`.
+        uint8_t mNumRoutes;            ///< Number of Has Route entries.
+        uint8_t mDefaultRoutesStart;   ///< Index of the first default route entry in `mCompiledDefaultRoutes`.
+        uint8_t mNumDefaultRoutes;     ///< Number of Border Router entries with the default route flag set.
+    };
+
     ThreadError RemoveCommissioningData(void);
 
+    void UpdateCompiled(void);
+    void Compile(void);
+    PrefixTlv &GetPrefixTlv(const CompiledPrefix &aPrefix) {
+        return *reinterpret_cast<PrefixTlv *>(mTlvs + aPrefix.mPrefixOffset);
+    }
+    ContextTlv &GetContextTlv(const CompiledPrefix &aPrefix) {
+        return *reinterpret_cast<ContextTlv *>(mTlvs + aPrefix.mContextOffset);
+    }
+
     ThreadError ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &destination,
                                     uint8_t *aPrefixMatch, uint16_t *aRloc16);
-    ThreadError DefaultRouteLookup(PrefixTlv &aPrefix, uint16_t *aRloc16);
+    ThreadError DefaultRouteLookup(const CompiledPrefix &aPrefix, uint16_t *aRloc16);
+
+    bool           mCompiledValid;
+    uint8_t        mCompiledVersion;
+    uint8_t        mCompiledLength;
+    uint8_t        mNumCompiledPrefixes;
+    CompiledPrefix mCompiledPrefixes[kMaxCompiledPrefixes];               ///< In Network Data order.
+    uint8_t        mCompiledPrefixesByLength[kMaxCompiledPrefixes];       ///< Indices, longest prefix first.
+    uint8_t        mCompiledContexts[kNumContextIds];                     ///< Index of the prefix per Context ID.
+    uint8_t        mCompiledRoutes[kMaxCompiledRoutes];                   ///< Offsets of Has Route entries.
+    uint8_t        mCompiledDefaultRoutes[kMaxCompiledDefaultRoutes];     ///< Offsets of default route entries.
 };
 
 /**
@@ -61,6 +61,8 @@ public:
      */
     class BufferWriteIterator
     {
+        friend class Encoder;
+
     public:
 
         /**
@@ -138,6 +140,21 @@ public:
      */
     ThreadError Encode(const uint8_t *aInBuf, uint16_t aInLength, BufferWriteIterator &aIterator);
 
+    /**
+     * This method encodes as many bytes from the input buffer as fit into a buffer at @p aIterator.
+     *
+     * Runs of bytes that need no escaping are copied in bulk. Unlike `Encode()`, this method keeps the bytes that fit
+     * when there is no space to encode the entire input, so encoding can resume from the returned count.
+     *
+     * @param[in]    aInBuf         A pointer to the input buffer.
+     * @param[in]    aInLength      The number of bytes in @p aInBuf to encode.
+     * @param[inout] aIterator      A reference to a write buffer iterator. On exit, the iterator is updated.
+     *
+     * @returns The number of bytes from @p aInBuf that were encoded.
+     *
+     */
+    uint16_t EncodePartial(const uint8_t *aInBuf, uint16_t aInLength, BufferWriteIterator &aIterator);
+
     /**
      * This method finalizes an HDLC frame.
      *
@@ -73,11 +73,16 @@ protected:
     /**
      * This method is called to start a new outbound frame.
      *
+     * Control and status frames use the high priority lane of the tx buffer, so they are sent ahead of bulk data
+     * frames (IPv6 datagrams and raw frames) which use the low priority lane.
+     *
+     * @param[in]  aPriority          The priority lane of the frame.
+     *
      * @retval kThreadError_None      Successfully started a new frame.
      * @retval kThreadError_NoBufs    Insufficient buffer space available to start a new frame.
      *
      */
-    ThreadError OutboundFrameBegin(void);
+    ThreadError OutboundFrameBegin(NcpFrameBuffer::Priority aPriority = NcpFrameBuffer::kPriorityHigh);
 
     /**
      * This method adds data to the current outbound frame being written.
@@ -125,6 +130,39 @@ protected:
      */
     void IncrementFrameErrorCounter(void);
 
+    /**
+     * This method is called by the subclass to indicate that its transport supports frame coalescing.
+     *
+     * The capability and the frame coalescing properties are only exposed to the host after this call.
+     *
+     */
+    void SetFrameCoalescingSupported(void);
+
+    /**
+     * This method indicates whether the host has enabled frame coalescing.
+     *
+     * @retval TRUE   If the transport may carry several spinel frames in one transport frame.
+     * @retval FALSE  If each transport frame must carry a single spinel frame.
+     *
+     */
+    bool IsFrameCoalescingEnabled(void) const;
+
+    /**
+     * This method returns the longest time to hold a frame on an idle link while waiting for frames to coalesce with.
+     *
+     * @returns The frame coalescing deadline in milliseconds.
+     *
+     */
+    uint16_t GetFrameCoalescingDeadline(void) const;
+
+    /**
+     * This method is called by the subclass whenever it has sent a transport frame.
+     *
+     * @param[in]  aSpinelFrameCount  The number of spinel frames carried in the transport frame.
+     *
+     */
+    void HandleTransportFrameSent(uint16_t aSpinelFrameCount);
+
 protected:
 
     /**
@@ -262,31 +300,31 @@ private:
 
     struct CommandHandlerEntry
     {
-        spinel_cid_t mCommand;
+        spinel_cid_t mKey;
         CommandHandlerType mHandler;
     };
 
     struct GetPropertyHandlerEntry
     {
-        spinel_prop_key_t mPropKey;
+        spinel_prop_key_t mKey;
         GetPropertyHandlerType mHandler;
     };
 
     struct SetPropertyHandlerEntry
     {
-        spinel_prop_key_t mPropKey;
+        spinel_prop_key_t mKey;
         SetPropertyHandlerType mHandler;
     };
 
     struct InsertPropertyHandlerEntry
     {
-        spinel_prop_key_t mPropKey;
+        spinel_prop_key_t mKey;
         SetPropertyHandlerType mHandler;
     };
 
     struct RemovePropertyHandlerEntry
     {
-        spinel_prop_key_t mPropKey;
+        spinel_prop_key_t mKey;
         SetPropertyHandlerType mHandler;
     };
 
@@ -356,6 +394,8 @@ private:
     ThreadError GetPropertyHandler_THREAD_RLOC16_DEBUG_PASSTHRU(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_THREAD_LOCAL_ROUTES(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_STREAM_NET(uint8_t header, spinel_prop_key_t key);
+    ThreadError GetPropertyHandler_UART_FRAME_COALESCING(uint8_t header, spinel_prop_key_t key);
+    ThreadError GetPropertyHandler_UART_FRAME_COALESCING_DEADLINE(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_MAC_SCAN_MASK(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_MAC_SCAN_PERIOD(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_THREAD_LEADER_ADDR(uint8_t header, spinel_prop_key_t key);
@@ -378,6 +418,7 @@ private:
     ThreadError GetPropertyHandler_MAC_CNTR(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_NCP_CNTR(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_MSG_BUFFER_COUNTERS(uint8_t header, spinel_prop_key_t key);
+    ThreadError GetPropertyHandler_TX_LANE_COUNTERS(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_MAC_WHITELIST(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_MAC_WHITELIST_ENABLED(uint8_t header, spinel_prop_key_t key);
     ThreadError GetPropertyHandler_THREAD_MODE(uint8_t header, spinel_prop_key_t key);
@@ -455,6 +496,10 @@ private:
                                                   uint16_t value_len);
     ThreadError SetPropertyHandler_IPV6_ICMP_PING_OFFLOAD(uint8_t header, spinel_prop_key_t key,
                                                           const uint8_t *value_ptr, uint16_t value_len);
+    ThreadError SetPropertyHandler_UART_FRAME_COALESCING(uint8_t header, spinel_prop_key_t key,
+                                                         const uint8_t *value_ptr, uint16_t value_len);
+    ThreadError SetPropertyHandler_UART_FRAME_COALESCING_DEADLINE(uint8_t header, spinel_prop_key_t key,
+                                                                  const uint8_t *value_ptr, uint16_t value_len);
     ThreadError SetPropertyHandler_THREAD_RLOC16_DEBUG_PASSTHRU(uint8_t header, spinel_prop_key_t key,
                                                                 const uint8_t *value_ptr, uint16_t value_len);
 
@@ -617,6 +662,10 @@ private:
     bool mIsRawStreamEnabled;
     bool mDisableStreamWrite;
 
+    bool mFrameCoalescingSupported;
+    bool mFrameCoalescingEnabled;
+    uint16_t mFrameCoalescingDeadline;
+
 #if OPENTHREAD_ENABLE_RAW_LINK_API
     uint8_t mCurTransmitTID;
     uint8_t mCurReceiveChannel;
@@ -627,6 +676,8 @@ private:
     uint32_t mRxSpinelFrameCounter;            // Number of received (inbound) spinel frames.
     uint32_t mRxSpinelOutOfOrderTidCounter;    // Number of out of order received spinel frames (tid increase > 1).
     uint32_t mTxSpinelFrameCounter;            // Number of sent (outbound) spinel frames.
+    uint32_t mTxTransportFrameCounter;         // Number of sent (outbound) transport frames.
+    uint32_t mTxCoalescedSpinelFrameCounter;   // Number of spinel frames sent in coalesced transport frames.
     uint32_t mInboundSecureIpFrameCounter;     // Number of secure inbound data/IP frames.
     uint32_t mInboundInsecureIpFrameCounter;   // Number of insecure inbound data/IP frames.
     uint32_t mOutboundSecureIpFrameCounter;    // Number of secure outbound data/IP frames.
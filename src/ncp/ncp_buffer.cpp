@@ -34,6 +34,8 @@
 #include <common/code_utils.hpp>
 #include <ncp/ncp_buffer.hpp>
 
+#include "openthread/platform/alarm.h"
+
 namespace Thread {
 
 NcpFrameBuffer::NcpFrameBuffer(uint8_t *aBuffer, uint16_t aBufferLen) :
@@ -41,7 +43,13 @@ NcpFrameBuffer::NcpFrameBuffer(uint8_t *aBuffer, uint16_t aBufferLen) :
     mBufferEnd(aBuffer + aBufferLen),
     mBufferLength(aBufferLen)
 {
-    otMessageQueueInit(&mMessageQueue);
+    for (uint8_t priority = 0; priority < kNumPriorities; priority++)
+    {
+        otMessageQueueInit(&mMessageQueue[priority]);
+        mWatermark[priority] = aBufferLen;
+    }
+
+    memset(mCounters, 0, sizeof(mCounters));
     otMessageQueueInit(&mWriteFrameMessageQueue);
     SetCallbacks(NULL, NULL, NULL);
     Clear();
@@ -59,22 +67,26 @@ void NcpFrameBuffer::Clear(void)
     bool wasEmpty = IsEmpty();
 
     // Write (InFrame) related variables
-    mWriteFrameStart = mBuffer;
+    mWritePriority = kPriorityLow;
+    mWriteFrameStart[kPriorityLow] = mBuffer;
+    mWriteFrameStart[kPriorityHigh] = Advance(mBuffer, 1, kPriorityHigh);
     mWriteSegmentHead = mBuffer;
     mWriteSegmentTail = mBuffer;
 
     // Read (OutFrame) related variables
-    mReadState = kReadStateDone;
+    mReadState = kReadStateNotActive;
+    mReadPriority = kPriorityLow;
     mReadFrameLength = kUnknownFrameLength;
 
-    mReadFrameStart = mBuffer;
+    mReadFrameStart[kPriorityLow] = mWriteFrameStart[kPriorityLow];
+    mReadFrameStart[kPriorityHigh] = mWriteFrameStart[kPriorityHigh];
     mReadSegmentHead = mBuffer;
     mReadSegmentTail = mBuffer;
     mReadPointer = mBuffer;
 
     mReadMessage = NULL;
-    mReadMessageOffset = 0;
-    mReadMessageTail = mMessageBuffer;
+    mReadMessagePointer = NULL;
+    mReadMessageTail = NULL;
 
     // Free all messages in the queues.
 
@@ -84,12 +96,17 @@ void NcpFrameBuffer::Clear(void)
         otMessageFree(message);
     }
 
-    while ((message = otMessageQueueGetHead(&mMessageQueue)) != NULL)
+    for (uint8_t priority = 0; priority < kNumPriorities; priority++)
     {
-        otMessageQueueDequeue(&mMessageQueue, message);
-        otMessageFree(message);
+        while ((message = otMessageQueueGetHead(&mMessageQueue[priority])) != NULL)
+        {
+            otMessageQueueDequeue(&mMessageQueue[priority], message);
+            otMessageFree(message);
+        }
     }
 
+    memset(mCounters, 0, sizeof(mCounters));
+
     if (!wasEmpty)
     {
         if (mEmptyBufferCallback != NULL)
@@ -107,31 +124,53 @@ void NcpFrameBuffer::SetCallbacks(BufferCallback aEmptyBufferCallback, BufferCal
     mCallbackContext = aContext;
 }
 
-// Returns the next buffer pointer addressing the wrap-around at the end of buffer.
-uint8_t *NcpFrameBuffer::Next(uint8_t *aBufPtr) const
+void NcpFrameBuffer::SetWatermark(Priority aPriority, uint16_t aWatermark)
 {
-    aBufPtr++;
-    return (aBufPtr == mBufferEnd) ? mBuffer : aBufPtr;
+    mWatermark[aPriority] = aWatermark;
 }
 
-// Returns an advanced (moved forward) version of the given buffer pointer by the given offset.
-uint8_t *NcpFrameBuffer::Advance(uint8_t *aBufPtr, uint8_t aOffset) const
+// Returns the given buffer pointer moved by the given offset in the writing direction of the given lane (forward for
+// low priority, backward for high priority), addressing the wrap-around at either end of buffer.
+uint8_t *NcpFrameBuffer::Advance(uint8_t *aBufPtr, uint16_t aOffset, Priority aPriority) const
 {
-    aBufPtr += aOffset;
+    size_t index = static_cast<size_t>(aBufPtr - mBuffer);
 
-    while (aBufPtr >= mBufferEnd)
+    if (aPriority == kPriorityLow)
     {
-        aBufPtr -= mBufferLength;
+        index += aOffset;
+
+        while (index >= mBufferLength)
+        {
+            index -= mBufferLength;
+        }
+    }
+    else
+    {
+        while (index < aOffset)
+        {
+            index += mBufferLength;
+        }
+
+        index -= aOffset;
     }
 
-    return aBufPtr;
+    return mBuffer + index;
 }
 
-// Get the distance between two buffer pointers (adjusts for the wrap-around).
-uint16_t NcpFrameBuffer::GetDistance(uint8_t *aStartPtr, uint8_t *aEndPtr) const
+// Get the distance between two buffer pointers in the writing direction of the given lane (adjusts for the
+// wrap-around).
+uint16_t NcpFrameBuffer::GetDistance(const uint8_t *aStartPtr, const uint8_t *aEndPtr, Priority aPriority) const
 {
     size_t distance;
 
+    if (aPriority == kPriorityHigh)
+    {
+        const uint8_t *ptr = aStartPtr;
+
+        aStartPtr = aEndPtr;
+        aEndPtr = ptr;
+    }
+
     if (aEndPtr >= aStartPtr)
     {
         distance = static_cast<size_t>(aEndPtr - aStartPtr);
@@ -145,38 +184,106 @@ uint16_t NcpFrameBuffer::GetDistance(uint8_t *aStartPtr, uint8_t *aEndPtr) const
     return static_cast<uint16_t>(distance);
 }
 
-// Write a uint16 value at the given buffer pointer (big-endian style).
-void NcpFrameBuffer::WriteUint16At(uint8_t *aBufPtr, uint16_t aValue)
+// Write a uint16 value at the given buffer pointer (big-endian style, in the writing direction of the lane).
+void NcpFrameBuffer::WriteUint16At(uint8_t *aBufPtr, uint16_t aValue, Priority aPriority)
 {
     *aBufPtr = (aValue >> 8);
-    *Next(aBufPtr) = (aValue & 0xff);
+    *Advance(aBufPtr, 1, aPriority) = (aValue & 0xff);
 }
 
-// Read a uint16 value at the given buffer pointer (big-endian style).
-uint16_t NcpFrameBuffer::ReadUint16At(uint8_t *aBufPtr)
+// Read a uint16 value at the given buffer pointer (big-endian style, in the writing direction of the lane).
+uint16_t NcpFrameBuffer::ReadUint16At(uint8_t *aBufPtr, Priority aPriority) const
 {
     uint16_t value;
 
     value = static_cast<uint16_t>((*aBufPtr) << 8);
-    value += *Next(aBufPtr);
+    value += *Advance(aBufPtr, 1, aPriority);
+
+    return value;
+}
+
+// Write a uint32 value at the given buffer pointer (big-endian style, in the writing direction of the lane).
+void NcpFrameBuffer::WriteUint32At(uint8_t *aBufPtr, uint32_t aValue, Priority aPriority)
+{
+    WriteUint16At(aBufPtr, static_cast<uint16_t>(aValue >> 16), aPriority);
+    WriteUint16At(Advance(aBufPtr, sizeof(uint16_t), aPriority), static_cast<uint16_t>(aValue & 0xffff), aPriority);
+}
+
+// Read a uint32 value at the given buffer pointer (big-endian style, in the writing direction of the lane).
+uint32_t NcpFrameBuffer::ReadUint32At(uint8_t *aBufPtr, Priority aPriority) const
+{
+    uint32_t value;
+
+    value = static_cast<uint32_t>(ReadUint16At(aBufPtr, aPriority)) << 16;
+    value += ReadUint16At(Advance(aBufPtr, sizeof(uint16_t), aPriority), aPriority);
 
     return value;
 }
 
-// Writes a bytes at the write tail, discards the frame if buffer gets full.
+// Returns the number of bytes before the data of a segment with the given header (the first segment of a frame also
+// carries the frame timestamp).
+uint16_t NcpFrameBuffer::GetSegmentHeaderSize(uint16_t aHeader)
+{
+    return (aHeader & kSegmentHeaderNewFrameFlag) ? kSegmentHeaderSize + kFrameTimestampSize : kSegmentHeaderSize;
+}
+
+// Indicates whether there is at least one full frame in the given lane.
+bool NcpFrameBuffer::HasFrame(Priority aPriority) const
+{
+    return (mReadFrameStart[aPriority] != mWriteFrameStart[aPriority]);
+}
+
+// Returns the other priority lane.
+NcpFrameBuffer::Priority NcpFrameBuffer::GetOtherPriority(Priority aPriority)
+{
+    return (aPriority == kPriorityLow) ? kPriorityHigh : kPriorityLow;
+}
+
+// Moves the start of the given lane, if it is empty, right next to the start of the other lane, so that the space freed
+// by removed frames (which is between the two lanes) joins the free space again. A lane is left alone while a frame is
+// written into it.
+void NcpFrameBuffer::UpdateLaneStart(Priority aPriority)
+{
+    VerifyOrExit(!HasFrame(aPriority), ;);
+    VerifyOrExit(aPriority != mWritePriority || mWriteSegmentTail == mWriteFrameStart[aPriority], ;);
+
+    mReadFrameStart[aPriority] = Advance(mReadFrameStart[GetOtherPriority(aPriority)], 1, aPriority);
+    mWriteFrameStart[aPriority] = mReadFrameStart[aPriority];
+
+    if (aPriority == mWritePriority)
+    {
+        mWriteSegmentHead = mWriteSegmentTail = mWriteFrameStart[aPriority];
+    }
+
+exit:
+    return;
+}
+
+void NcpFrameBuffer::UpdateLaneStarts(void)
+{
+    UpdateLaneStart(kPriorityHigh);
+    UpdateLaneStart(kPriorityLow);
+}
+
+// Writes a bytes at the write tail, discards the frame if buffer (or the lane) gets full.
 ThreadError NcpFrameBuffer::InFrameFeedByte(uint8_t aByte)
 {
     ThreadError error = kThreadError_None;
-    uint8_t *newTail = Next(mWriteSegmentTail);
 
-    VerifyOrExit(newTail != mReadFrameStart, error = kThreadError_NoBufs);
+    // The lanes grow towards each other, the tail must not reach the start of the other lane's next frame.
+    VerifyOrExit(mWriteSegmentTail != mWriteFrameStart[GetOtherPriority(mWritePriority)],
+                 error = kThreadError_NoBufs);
+
+    VerifyOrExit(GetDistance(mReadFrameStart[mWritePriority], mWriteSegmentTail, mWritePriority) <
+                 mWatermark[mWritePriority], error = kThreadError_NoBufs);
 
     *mWriteSegmentTail = aByte;
-    mWriteSegmentTail = newTail;
+    mWriteSegmentTail = Advance(mWriteSegmentTail, 1, mWritePriority);
 
 exit:
     if (error != kThreadError_None)
     {
+        mCounters[mWritePriority].mDroppedFrameCount++;
         InFrameDiscard();
     }
 
@@ -193,19 +300,19 @@ ThreadError NcpFrameBuffer::InFrameBeginSegment(void)
     VerifyOrExit(mWriteSegmentHead == mWriteSegmentTail, ;);
 
     // If this is the start of a new frame (i.e., frame start is same as segment head)
-    if (mWriteFrameStart == mWriteSegmentHead)
+    if (mWriteFrameStart[mWritePriority] == mWriteSegmentHead)
     {
         headerFlags |= kSegmentHeaderNewFrameFlag;
     }
 
-    // Reserve space for the segment header.
-    for (uint16_t i = kSegmentHeaderSize; i; i--)
+    // Reserve space for the segment header (and the frame timestamp).
+    for (uint16_t i = GetSegmentHeaderSize(headerFlags); i; i--)
     {
         SuccessOrExit(error = InFrameFeedByte(0));
     }
 
     // Write the flags at the segment head
-    WriteUint16At(mWriteSegmentHead, headerFlags);
+    WriteUint16At(mWriteSegmentHead, headerFlags, mWritePriority);
 
 exit:
     return error;
@@ -215,20 +322,25 @@ exit:
 void NcpFrameBuffer::InFrameEndSegment(uint16_t aHeaderFlags)
 {
     uint16_t segmentLength;
+    uint16_t headerSize;
     uint16_t header;
 
-    segmentLength = GetDistance(mWriteSegmentHead, mWriteSegmentTail);
+    segmentLength = GetDistance(mWriteSegmentHead, mWriteSegmentTail, mWritePriority);
+
+    // The first segment of a frame also includes the frame timestamp.
+    headerSize = GetSegmentHeaderSize((mWriteSegmentHead == mWriteFrameStart[mWritePriority]) ?
+                                      kSegmentHeaderNewFrameFlag : kSegmentHeaderNoFlag);
 
-    if (segmentLength >= kSegmentHeaderSize)
+    if (segmentLength >= headerSize)
     {
         // Reduce the header size.
-        segmentLength -= kSegmentHeaderSize;
+        segmentLength -= headerSize;
 
         // Update the length and the flags in segment header (at segment head pointer).
-        header = ReadUint16At(mWriteSegmentHead);
+        header = ReadUint16At(mWriteSegmentHead, mWritePriority);
         header |= (segmentLength & kSegmentHeaderLengthMask);
         header |= aHeaderFlags;
-        WriteUint16At(mWriteSegmentHead, header);
+        WriteUint16At(mWriteSegmentHead, header, mWritePriority);
 
         // Move the segment head to current tail (to be ready for a possible next segment).
         mWriteSegmentHead = mWriteSegmentTail;
@@ -246,7 +358,7 @@ void NcpFrameBuffer::InFrameDiscard(void)
     otMessage *message;
 
     // Move the write segment head and tail pointers back to frame start.
-    mWriteSegmentHead = mWriteSegmentTail = mWriteFrameStart;
+    mWriteSegmentHead = mWriteSegmentTail = mWriteFrameStart[mWritePriority];
 
     // Free any messages associated with current frame.
     while ((message = otMessageQueueGetHead(&mWriteFrameMessageQueue)) != NULL)
@@ -254,13 +366,18 @@ void NcpFrameBuffer::InFrameDiscard(void)
         otMessageQueueDequeue(&mWriteFrameMessageQueue, message);
         otMessageFree(message);
     }
+
+    UpdateLaneStarts();
 }
 
-ThreadError NcpFrameBuffer::InFrameBegin(void)
+ThreadError NcpFrameBuffer::InFrameBegin(Priority aPriority)
 {
     // Discard any previous frame.
     InFrameDiscard();
 
+    mWritePriority = aPriority;
+    mWriteSegmentHead = mWriteSegmentTail = mWriteFrameStart[aPriority];
+
     return kThreadError_None;
 }
 
@@ -302,22 +419,45 @@ ThreadError NcpFrameBuffer::InFrameEnd(void)
 {
     otMessage *message;
     bool wasEmpty = IsEmpty();
+    LaneCounters &counters = mCounters[mWritePriority];
 
     // End/Close the current segment (if any).
     InFrameEndSegment(kSegmentHeaderNoFlag);
 
+    if (mWriteSegmentHead != mWriteFrameStart[mWritePriority])
+    {
+        // Stamp the frame with the current time, to track how long it waits in the lane.
+        WriteUint32At(Advance(mWriteFrameStart[mWritePriority], kSegmentHeaderSize, mWritePriority),
+                      otPlatAlarmGetNow(), mWritePriority);
+
+        counters.mFrameCount++;
+
+        if (counters.mFrameCount > counters.mPeakFrameCount)
+        {
+            counters.mPeakFrameCount = counters.mFrameCount;
+        }
+
+        // If no frame is being read, the new frame may be the front frame now.
+        if (mReadState == kReadStateNotActive)
+        {
+            mReadFrameLength = kUnknownFrameLength;
+        }
+    }
+
     // Update the frame start pointer to current segment head to be ready for next frame.
-    mWriteFrameStart = mWriteSegmentHead;
+    mWriteFrameStart[mWritePriority] = mWriteSegmentHead;
 
-    // Move all the messages from the frame queue to the main queue.
+    // Move all the messages from the frame queue to the lane queue.
     while ((message = otMessageQueueGetHead(&mWriteFrameMessageQueue)) != NULL)
     {
         otMessageQueueDequeue(&mWriteFrameMessageQueue, message);
-        otMessageQueueEnqueue(&mMessageQueue, message);
+        otMessageQueueEnqueue(&mMessageQueue[mWritePriority], message);
     }
 
+    UpdateLaneStarts();
+
     // If buffer was empty before, invoke the callback to signal that buffer is now non-empty.
-    if (wasEmpty)
+    if (wasEmpty && !IsEmpty())
     {
         if (mNonEmptyBufferCallback != NULL)
         {
@@ -330,7 +470,17 @@ ThreadError NcpFrameBuffer::InFrameEnd(void)
 
 bool NcpFrameBuffer::IsEmpty(void) const
 {
-    return (mReadFrameStart == mWriteFrameStart);
+    return !HasFrame(kPriorityHigh) && !HasFrame(kPriorityLow);
+}
+
+// Selects the lane to read from, unless a frame is already being read: high priority lane if it has a frame, otherwise
+// the low priority one.
+void NcpFrameBuffer::OutFrameSelectPriority(void)
+{
+    if (mReadState == kReadStateNotActive)
+    {
+        mReadPriority = HasFrame(kPriorityHigh) ? kPriorityHigh : kPriorityLow;
+    }
 }
 
 // Start/Prepare a new segment for reading.
@@ -345,24 +495,24 @@ ThreadError NcpFrameBuffer::OutFramePrepareSegment(void)
         mReadSegmentHead = mReadSegmentTail;
 
         // Ensure there is something to read (i.e. segment head is not at start of frame being written).
-        VerifyOrExit(mReadSegmentHead != mWriteFrameStart, error = kThreadError_NotFound);
+        VerifyOrExit(mReadSegmentHead != mWriteFrameStart[mReadPriority], error = kThreadError_NotFound);
 
         // Read the segment header.
-        header = ReadUint16At(mReadSegmentHead);
+        header = ReadUint16At(mReadSegmentHead, mReadPriority);
 
         // Check if this segment is the start of a frame.
         if (header & kSegmentHeaderNewFrameFlag)
         {
             // Ensure that this segment is start of current frame, otherwise the current frame is finished.
-            VerifyOrExit(mReadSegmentHead == mReadFrameStart, error = kThreadError_NotFound);
+            VerifyOrExit(mReadSegmentHead == mReadFrameStart[mReadPriority], error = kThreadError_NotFound);
         }
 
         // Find tail/end of current segment.
-        mReadSegmentTail = Advance(mReadSegmentHead,
-				   kSegmentHeaderSize + static_cast<uint8_t>(header & kSegmentHeaderLengthMask));
+        mReadSegmentTail = Advance(mReadSegmentHead, GetSegmentHeaderSize(header) + (header & kSegmentHeaderLengthMask),
+                                   mReadPriority);
 
         // Update the current read pointer to skip the segment header.
-        mReadPointer = Advance(mReadSegmentHead, kSegmentHeaderSize);
+        mReadPointer = Advance(mReadSegmentHead, GetSegmentHeaderSize(header), mReadPriority);
 
         // Check if there are data bytes to be read in this segment (i.e. read pointer not at the tail).
         if (mReadPointer != mReadSegmentTail)
@@ -391,7 +541,7 @@ exit:
     return error;
 }
 
-// This method prepares an associated message in current segment and fills the message buffer. It returns
+// This method prepares an associated message in current segment and its first message buffer segment. It returns
 // ThreadError_NotFound if there is no message or if the message has no content.
 ThreadError NcpFrameBuffer::OutFramePrepareMessage(void)
 {
@@ -399,23 +549,23 @@ ThreadError NcpFrameBuffer::OutFramePrepareMessage(void)
     uint16_t header;
 
     // Read the segment header
-    header = ReadUint16At(mReadSegmentHead);
+    header = ReadUint16At(mReadSegmentHead, mReadPriority);
 
     // Ensure that the segment header indicates that there is an associated message or return `NotFound` error.
     VerifyOrExit((header & kSegmentHeaderMessageIndicatorFlag) != 0, error = kThreadError_NotFound);
 
     // Update the current message from the queue.
     mReadMessage = (mReadMessage == NULL) ?
-        otMessageQueueGetHead(&mMessageQueue) :
-        otMessageQueueGetNext(&mMessageQueue, mReadMessage);
+        otMessageQueueGetHead(&mMessageQueue[mReadPriority]) :
+        otMessageQueueGetNext(&mMessageQueue[mReadPriority], mReadMessage);
 
     VerifyOrExit(mReadMessage != NULL, error = kThreadError_NotFound);
 
-    // Reset the offset for reading the message.
-    mReadMessageOffset = 0;
+    // Reset the cursor for reading the message.
+    otMessageCursorInit(&mReadMessageCursor, mReadMessage, 0);
 
-    // Fill the content from current message into the message buffer.
-    SuccessOrExit(error = OutFrameFillMessageBuffer());
+    // Point to the first contiguous part of the message.
+    SuccessOrExit(error = OutFrameNextMessageSegment());
 
     // If all successful, set the state to `InMessage`.
     mReadState = kReadStateInMessage;
@@ -424,29 +574,22 @@ exit:
     return error;
 }
 
-// This method fills content from current message into the message buffer. It returns kThreadError_NotFound if no more
-// content in the current message.
-ThreadError NcpFrameBuffer::OutFrameFillMessageBuffer(void)
+// This method points the message read pointer to the next contiguous part of the current message, in place within its
+// message buffer. It returns kThreadError_NotFound if no more content in the current message.
+ThreadError NcpFrameBuffer::OutFrameNextMessageSegment(void)
 {
     ThreadError error = kThreadError_None;
-    int readLength;
+    const uint8_t *data;
+    uint16_t length;
 
     VerifyOrExit(mReadMessage != NULL, error = kThreadError_NotFound);
 
-    VerifyOrExit(mReadMessageOffset < otMessageGetLength(mReadMessage), error = kThreadError_NotFound);
-
-    // Read portion of current message from the offset into message buffer.
-    readLength = otMessageRead(mReadMessage, mReadMessageOffset, mMessageBuffer, sizeof(mMessageBuffer));
-
-    VerifyOrExit(readLength > 0, error = kThreadError_NotFound);
-
-    // Update the message offset, set up the message tail, and set read pointer to start of message buffer.
+    length = otMessageGetNextSegment(&mReadMessageCursor, kUnknownFrameLength, &data);
 
-    mReadMessageOffset += readLength;
+    VerifyOrExit(length > 0, error = kThreadError_NotFound);
 
-    mReadMessageTail = mMessageBuffer + readLength;
-
-    mReadPointer = mMessageBuffer;
+    mReadMessagePointer = data;
+    mReadMessageTail = data + length;
 
 exit:
     return error;
@@ -456,49 +599,89 @@ ThreadError NcpFrameBuffer::OutFrameBegin(void)
 {
     ThreadError error = kThreadError_None;
 
+    OutFrameSelectPriority();
+
     mReadMessage = NULL;
 
     // Move the segment head and tail to start of frame.
-    mReadSegmentHead = mReadSegmentTail = mReadFrameStart;
+    mReadSegmentHead = mReadSegmentTail = mReadFrameStart[mReadPriority];
 
     // Prepare the current segment for reading.
     error = OutFramePrepareSegment();
 
+    // With no frame to read, the next frame is selected from the lanes again.
+    if (!HasFrame(mReadPriority))
+    {
+        mReadState = kReadStateNotActive;
+    }
+
     return error;
 }
 
 bool NcpFrameBuffer::OutFrameHasEnded(void)
 {
-    return (mReadState == kReadStateDone);
+    return (mReadState == kReadStateDone) || (mReadState == kReadStateNotActive);
 }
 
-uint8_t NcpFrameBuffer::OutFrameReadByte(void)
+uint16_t NcpFrameBuffer::OutFramePeek(const uint8_t *&aData)
 {
-    ThreadError error;
-    uint8_t retval = kReadByteAfterFrameHasEnded;
+    uint16_t length = 0;
 
     switch (mReadState)
     {
     case kReadStateDone:
+    case kReadStateNotActive:
 
-        retval = kReadByteAfterFrameHasEnded;
+        break;
+
+    case kReadStateInSegment:
+
+        aData = mReadPointer;
+
+        if (mReadPriority == kPriorityHigh)
+        {
+            // High priority segments are stored in reverse order, so only one byte is contiguous.
+            length = 1;
+        }
+        else
+        {
+            // The segment may wrap around the end of the buffer, in which case only the part up to the end is
+            // returned.
+            length = static_cast<uint16_t>((mReadSegmentTail > mReadPointer) ? (mReadSegmentTail - mReadPointer) :
+                                           (mBufferEnd - mReadPointer));
+        }
+
+        break;
+
+    case kReadStateInMessage:
+
+        aData = mReadMessagePointer;
+        length = static_cast<uint16_t>(mReadMessageTail - mReadMessagePointer);
+
+        break;
+    }
+
+    return length;
+}
+
+void NcpFrameBuffer::OutFrameSkip(uint16_t aLength)
+{
+    switch (mReadState)
+    {
+    case kReadStateDone:
+    case kReadStateNotActive:
 
         break;
 
     case kReadStateInSegment:
 
-        // Read a byte from current read pointer and move the read pointer forward.
-        retval = *mReadPointer;
-        mReadPointer = Next(mReadPointer);
+        mReadPointer = Advance(mReadPointer, aLength, mReadPriority);
 
         // Check if at end of current segment.
         if (mReadPointer == mReadSegmentTail)
         {
-            // Prepare any message associated with this segment.
-            error = OutFramePrepareMessage();
-
-            // If there is no message, move to next segment (if any).
-            if (error != kThreadError_None)
+            // Prepare any message associated with this segment, or if there is none, move to next segment (if any).
+            if (OutFramePrepareMessage() != kThreadError_None)
             {
                 OutFramePrepareSegment();
             }
@@ -508,18 +691,13 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
     case kReadStateInMessage:
 
-        // Read a byte from current read pointer and move the read pointer forward.
-        retval = *mReadPointer;
-        mReadPointer++;
+        mReadMessagePointer += aLength;
 
-        // Check if at the end of content in message buffer.
-        if (mReadPointer == mReadMessageTail)
+        // Check if at the end of the current part of message.
+        if (mReadMessagePointer == mReadMessageTail)
         {
-            // Fill more bytes from current message into message buffer.
-            error = OutFrameFillMessageBuffer();
-
-            // If no more bytes in the message, move to next segment (if any).
-            if (error != kThreadError_None)
+            // Move to the next part of message, or if no more bytes in the message, move to next segment (if any).
+            if (OutFrameNextMessageSegment() != kThreadError_None)
             {
                 OutFramePrepareSegment();
             }
@@ -527,6 +705,18 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 
         break;
     }
+}
+
+uint8_t NcpFrameBuffer::OutFrameReadByte(void)
+{
+    const uint8_t *data;
+    uint8_t retval = kReadByteAfterFrameHasEnded;
+
+    if (OutFramePeek(data) > 0)
+    {
+        retval = *data;
+        OutFrameSkip(1);
+    }
 
     return retval;
 }
@@ -534,10 +724,19 @@ uint8_t NcpFrameBuffer::OutFrameReadByte(void)
 uint16_t NcpFrameBuffer::OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer)
 {
     uint16_t bytesRead = 0;
+    uint16_t length;
+    const uint8_t *data;
 
-    for (bytesRead = 0; (bytesRead < aReadLength) && !OutFrameHasEnded(); bytesRead++)
+    while ((bytesRead < aReadLength) && ((length = OutFramePeek(data)) > 0))
     {
-        *aDataBuffer++ = OutFrameReadByte();
+        if (length > aReadLength - bytesRead)
+        {
+            length = aReadLength - bytesRead;
+        }
+
+        memcpy(aDataBuffer + bytesRead, data, length);
+        OutFrameSkip(length);
+        bytesRead += length;
     }
 
     return bytesRead;
@@ -549,23 +748,28 @@ ThreadError NcpFrameBuffer::OutFrameRemove(void)
     uint8_t *bufPtr;
     otMessage *message;
     uint16_t header;
+    uint32_t waitTime;
 
-    VerifyOrExit(!IsEmpty(), error = kThreadError_NotFound);
+    OutFrameSelectPriority();
+
+    VerifyOrExit(HasFrame(mReadPriority), error = kThreadError_NotFound);
 
     // Begin at the start of current frame and move through all segments.
 
-    bufPtr = mReadFrameStart;
+    bufPtr = mReadFrameStart[mReadPriority];
+
+    waitTime = otPlatAlarmGetNow() - ReadUint32At(Advance(bufPtr, kSegmentHeaderSize, mReadPriority), mReadPriority);
 
-    while (bufPtr != mWriteFrameStart)
+    while (bufPtr != mWriteFrameStart[mReadPriority])
     {
         // Read the segment header
-        header = ReadUint16At(bufPtr);
+        header = ReadUint16At(bufPtr, mReadPriority);
 
         // If the current segment defines a new frame, and it is not the start of current frame, then we have reached
         // end of current frame.
         if (header & kSegmentHeaderNewFrameFlag)
         {
-            if (bufPtr != mReadFrameStart)
+            if (bufPtr != mReadFrameStart[mReadPriority])
             {
                 break;
             }
@@ -574,22 +778,33 @@ ThreadError NcpFrameBuffer::OutFrameRemove(void)
         // If current segment has an appended message, remove it from message queue and free it.
         if (header & kSegmentHeaderMessageIndicatorFlag)
         {
-            if ((message = otMessageQueueGetHead(&mMessageQueue)) != NULL)
+            if ((message = otMessageQueueGetHead(&mMessageQueue[mReadPriority])) != NULL)
             {
-                otMessageQueueDequeue(&mMessageQueue, message);
+                otMessageQueueDequeue(&mMessageQueue[mReadPriority], message);
                 otMessageFree(message);
             }
         }
 
         // Move the pointer to next segment.
-        bufPtr = Advance(bufPtr, kSegmentHeaderSize + static_cast<uint8_t>(header & kSegmentHeaderLengthMask));
+        bufPtr = Advance(bufPtr, GetSegmentHeaderSize(header) + (header & kSegmentHeaderLengthMask), mReadPriority);
     }
 
-    mReadFrameStart = bufPtr;
+    mReadFrameStart[mReadPriority] = bufPtr;
+
+    mCounters[mReadPriority].mFrameCount--;
+    mCounters[mReadPriority].mRemovedFrameCount++;
+    mCounters[mReadPriority].mTotalWaitTime += waitTime;
+
+    if (waitTime > mCounters[mReadPriority].mMaxWaitTime)
+    {
+        mCounters[mReadPriority].mMaxWaitTime = waitTime;
+    }
 
-    mReadState = kReadStateDone;
+    mReadState = kReadStateNotActive;
     mReadFrameLength = kUnknownFrameLength;
 
+    UpdateLaneStarts();
+
     // If the remove causes the buffer to become empty, invoke the callback to signal this.
     if (IsEmpty())
     {
@@ -611,25 +826,27 @@ uint16_t NcpFrameBuffer::OutFrameGetLength(void)
     uint8_t *bufPtr;
     otMessage *message = NULL;
 
+    OutFrameSelectPriority();
+
     // If the frame length was calculated before, return the previously calculated length.
     VerifyOrExit(mReadFrameLength == kUnknownFrameLength, frameLength = mReadFrameLength);
 
-    VerifyOrExit(!IsEmpty(), frameLength = 0);
+    VerifyOrExit(HasFrame(mReadPriority), frameLength = 0);
 
     // Calculate frame length by adding length of all segments and messages within the current frame.
 
-    bufPtr = mReadFrameStart;
+    bufPtr = mReadFrameStart[mReadPriority];
 
-    while (bufPtr != mWriteFrameStart)
+    while (bufPtr != mWriteFrameStart[mReadPriority])
     {
         // Read the segment header
-        header = ReadUint16At(bufPtr);
+        header = ReadUint16At(bufPtr, mReadPriority);
 
         // If the current segment defines a new frame, and it is not the start of current frame, then we have reached
         // end of current frame.
         if (header & kSegmentHeaderNewFrameFlag)
         {
-            if (bufPtr != mReadFrameStart)
+            if (bufPtr != mReadFrameStart[mReadPriority])
             {
                 break;
             }
@@ -639,8 +856,8 @@ uint16_t NcpFrameBuffer::OutFrameGetLength(void)
         if (header & kSegmentHeaderMessageIndicatorFlag)
         {
             message = (message == NULL) ?
-                otMessageQueueGetHead(&mMessageQueue) :
-                otMessageQueueGetNext(&mMessageQueue, message);
+                otMessageQueueGetHead(&mMessageQueue[mReadPriority]) :
+                otMessageQueueGetNext(&mMessageQueue[mReadPriority], message);
 
             if (message != NULL)
             {
@@ -652,7 +869,7 @@ uint16_t NcpFrameBuffer::OutFrameGetLength(void)
         frameLength += (header & kSegmentHeaderLengthMask);
 
         // Move the pointer to next segment.
-        bufPtr = Advance(bufPtr, kSegmentHeaderSize + static_cast<uint8_t>(header & kSegmentHeaderLengthMask));
+        bufPtr = Advance(bufPtr, GetSegmentHeaderSize(header) + (header & kSegmentHeaderLengthMask), mReadPriority);
     }
 
     // Remember the calculated frame length for current frame.
@@ -662,4 +879,11 @@ exit:
     return frameLength;
 }
 
+bool NcpFrameBuffer::OutFrameHasNext(void)
+{
+    OutFrameSelectPriority();
+
+    return (mCounters[mReadPriority].mFrameCount > 1) || (mCounters[GetOtherPriority(mReadPriority)].mFrameCount > 0);
+}
+
 }  // namespace Thread
@@ -51,6 +51,38 @@ public:
      */
     typedef void (*BufferCallback)(void *aContext, NcpFrameBuffer *aNcpFrameBuffer);
 
+    /**
+     * This enumeration defines the priority lanes of the NCP frame buffer.
+     *
+     * Frames in the high priority lane are read before any frame in the low priority lane. Within a lane, frames are
+     * read in FIFO order.
+     *
+     */
+    enum Priority
+    {
+        kPriorityLow  = 0,  ///< Low priority lane, used for bulk data frames.
+        kPriorityHigh = 1,  ///< High priority lane, used for control and status frames.
+    };
+
+    enum
+    {
+        kNumPriorities = 2,  ///< Number of priority lanes.
+    };
+
+    /**
+     * This structure contains the counters of a priority lane.
+     *
+     */
+    struct LaneCounters
+    {
+        uint16_t mFrameCount;          ///< The number of frames currently in the lane.
+        uint16_t mPeakFrameCount;      ///< The largest number of frames that were in the lane at once.
+        uint32_t mRemovedFrameCount;   ///< The number of frames removed from the lane.
+        uint32_t mDroppedFrameCount;   ///< The number of frames discarded because the lane had no space.
+        uint32_t mTotalWaitTime;       ///< The total time removed frames spent in the lane (in milliseconds).
+        uint32_t mMaxWaitTime;         ///< The longest time a removed frame spent in the lane (in milliseconds).
+    };
+
     /**
      * This constructor creates an NCP frame buffer.
      *
@@ -67,7 +99,7 @@ public:
     ~NcpFrameBuffer();
 
     /**
-     * This method clears the NCP frame buffer. All the frames are cleared/removed.
+     * This method clears the NCP frame buffer. All the frames are cleared/removed and the lane counters are reset.
      *
      * @returns Nothing (void).
      */
@@ -86,17 +118,41 @@ public:
      */
     void SetCallbacks(BufferCallback aEmptyBufferCallback, BufferCallback aNonEmptyBufferCallback, void *aContext);
 
+    /**
+     * This method sets the watermark of a priority lane, i.e., the maximum number of bytes the frames in the lane may
+     * occupy in the buffer. By default the watermark of both lanes is the buffer size.
+     *
+     * Setting the low priority watermark below the buffer size reserves the remaining space for high priority frames.
+     *
+     * @param[in]  aPriority   The priority lane.
+     * @param[in]  aWatermark  The maximum number of bytes used by the lane.
+     *
+     */
+    void SetWatermark(Priority aPriority, uint16_t aWatermark);
+
+    /**
+     * This method returns the counters of a priority lane.
+     *
+     * @param[in]  aPriority   The priority lane.
+     *
+     * @returns A reference to the counters of the lane.
+     *
+     */
+    const LaneCounters &GetCounters(Priority aPriority) const { return mCounters[aPriority]; }
+
     /**
      * This method begins a new input frame to be added/written to the frame buffer.
 
      * If there is a previous frame being written (`InFrameEnd()` has not yet been called on the frame), this method
      * will discard and clear the previous unfinished frame.
      *
+     * @param[in]  aPriority          The priority lane of the new frame.
+     *
      * @retval kThreadError_None      Successfully started a new frame.
      * @retval kThreadError_NoBufs    Insufficient buffer space available to start a new frame.
      *
      */
-    ThreadError InFrameBegin(void);
+    ThreadError InFrameBegin(Priority aPriority);
 
     /**
      * This method adds data to the current input frame being written to the buffer.
@@ -151,7 +207,9 @@ public:
      * This method begins/prepares a new output frame to be read from the frame buffer.
      *
      * The NCP buffer maintains a read offset for the current frame being read. Before reading any bytes from the frame
-     * this method should be called to prepare the  frame and set the read offset.
+     * this method should be called to prepare the  frame and set the read offset. The current frame is the front frame
+     * of the high priority lane or, if that lane is empty, of the low priority lane. It stays the current frame until
+     * it is removed, even if a high priority frame is added in the meantime.
      *
      * If part of current frame has already been read, a sub-sequent call to this method will reset the read offset
      * back to beginning of current output frame.
@@ -203,12 +261,35 @@ public:
      */
     uint16_t OutFrameRead(uint16_t aReadLength, uint8_t *aDataBuffer);
 
+    /**
+     * This method returns the contiguous bytes at the read offset of the current output frame, without copying them.
+     *
+     * The returned bytes are either part of a data segment in the frame buffer or part of a message buffer of a message
+     * added with `InFrameFeedMessage()`. The read offset is not moved; use `OutFrameSkip()` to move past the bytes
+     * once they have been consumed. The data segments of high priority frames are returned one byte at a time.
+     *
+     * @param[out] aData              A reference to a pointer that is set to the bytes at the read offset.
+     *
+     * @returns    The number of contiguous bytes at @p aData, or zero if frame has ended.
+     *
+     */
+    uint16_t OutFramePeek(const uint8_t *&aData);
+
+    /**
+     * This method moves the read offset of the current output frame forward.
+     *
+     * @param[in]  aLength            Number of bytes to skip, no more than the length returned by `OutFramePeek()`.
+     *
+     */
+    void OutFrameSkip(uint16_t aLength);
+
     /**
      * This method removes the current/front output frame from the buffer.
      *
-     * The NCP buffer stores the frames in FIFO order. This method removes the front frame (which may be the current
-     * output frame being read) from the buffer. There is no need to prepare/begin reading the current frame before
-     * removing it, so the front frame can be removed without a previous call to `OutFrameBegin()`.
+     * The NCP buffer stores the frames of each lane in FIFO order. This method removes the current output frame, or if
+     * no frame is being read, the front frame of the highest priority non-empty lane from the buffer. There is no need
+     * to prepare/begin reading the current frame before removing it, so the front frame can be removed without a
+     * previous call to `OutFrameBegin()`.
      *
      * When a frame is removed all its associated messages will be freed.
      *
@@ -223,9 +304,10 @@ public:
     /**
      * This method returns the number of bytes (length) of current/front frame in the NCP frame buffer.
      *
-     * The NCP buffer stores the frames in FIFO order. This method returns the length of the front frame (which may
-     * be the current output frame being read) from the buffer. There is no need to prepare/begin reading the current
-     * frame before calling this method so this method can be used without a previous call to `OutFrameBegin()`.
+     * The NCP buffer stores the frames of each lane in FIFO order. This method returns the length of the current
+     * output frame, or if no frame is being read, of the front frame of the highest priority non-empty lane. There is
+     * no need to prepare/begin reading the current frame before calling this method so this method can be used
+     * without a previous call to `OutFrameBegin()`.
      *
      * If there is no frame in buffer, this method returns zero.
      *
@@ -234,6 +316,17 @@ public:
      */
     uint16_t OutFrameGetLength(void);
 
+    /**
+     * This method indicates whether there is another frame in the NCP frame buffer after the current/front frame.
+     *
+     * Like `OutFrameGetLength()`, this method can be used without a previous call to `OutFrameBegin()`.
+     *
+     * @retval TRUE   If at least one more frame follows the current/front frame.
+     * @retval FALSE  If the current/front frame is the last frame, or the buffer is empty.
+     *
+     */
+    bool OutFrameHasNext(void);
+
 private:
 
     /*
@@ -244,7 +337,14 @@ private:
      * the main buffer `mBuffer`. mBuffer is utilized as a circular buffer.
 
      * Messages (which are added using `InFrameFeedMessaged()`) are not copied in the `mBuffer` but instead are
-     * enqueued in a message queue `mMessageQueue`.
+     * enqueued in the message queue of the frame's priority lane `mMessageQueue[]`.
+     *
+     * The two priority lanes share `mBuffer` and grow towards each other: low priority frames are written forward
+     * (towards the end of the buffer) and high priority frames are written backward, starting right before the start
+     * of the low priority lane. Either lane may therefore use all the free space, limited only by its watermark. The
+     * bytes of a high priority frame are stored in reverse order, all offsets and multi-byte values below are in the
+     * writing direction of the lane. When a lane becomes empty, its start is moved next to the start of the other lane
+     * so that the space freed by removed frames becomes available again.
      *
      * The data segments include a header before the data portion. The header is 2 bytes long is formated as follows
      *
@@ -258,6 +358,9 @@ private:
      *    +--------------+--------------+--------------------------------------------------------+
      *
      * The header is encoded in big-endian (msb first) style.
+     *
+     * The header of the first segment of a frame is followed by a 4-byte big-endian timestamp, which is the time (in
+     * milliseconds) the frame was added to the buffer. The timestamp is not included in the segment length.
 
      * Consider the following calls to create a frame:
      *
@@ -271,24 +374,25 @@ private:
      * This frame is stored as two segments:
      *
      *    - Segment #1 contains "HelloThere" with a header of `0xC00A` which shows that this segment contains 10 data
-     *      bytes, and it starts a new frame, and also must include a message from the message queue.
+     *      bytes, and it starts a new frame (so it is followed by the timestamp `ts`), and also must include a message
+     *      from the message queue.
      *
      *    - Segment #2 contains "Bye" with a header value of `0x0003` showing length of 3 and no appended message.
      *
-     *    +-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+
-     *    | C0  | 0A  | `H` | 'e' | 'l' | 'l' | 'o' | 'T' | 'h' | 'e' | 'r' | 'e' | 00  | 03  | 'B' | 'y' | 'e' |
-     *    +-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+-----+
-     *     \         /                                                             \         /
-     *   Segment #1 Header                                                      Segment #2 Header
+     *    +----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+
+     *    | C0 | 0A | ts | ts | ts | ts | 'H'| 'e'| 'l'| 'l'| 'o'| 'T'| 'h'| 'e'| 'r'| 'e'| 00 | 03 | 'B'| 'y'| 'e'|
+     *    +----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+----+
+     *     \       /                                                                     \       /
+     *   Segment #1 Header                                                            Segment #2 Header
      *
      */
 
     enum
     {
         kReadByteAfterFrameHasEnded        = 0,          // Value returned by ReadByte() when frame has ended.
-        kMessageReadBufferSize             = 16,         // Size of message buffer array.
         kUnknownFrameLength                = 0xffff,     // Value used when frame length is unknown.
         kSegmentHeaderSize                 = 2,          // Length of the segment header.
+        kFrameTimestampSize                = 4,          // Length of the timestamp in the first segment of a frame.
         kSegmentHeaderLengthMask           = 0x3fff,     // Bit mask to get the length from the segment header
 
         kSegmentHeaderNoFlag               = 0,          // No flags are set.
@@ -301,57 +405,69 @@ private:
         kReadStateInSegment,        // In middle of a data segment while reading current (out) frame.
         kReadStateInMessage,        // In middle of a message while reading current (out) frame.
         kReadStateDone,             // Current (out) frame is read fully.
+        kReadStateNotActive,        // No current (out) frame, the next one is selected from the lanes.
     };
 
     // Private methods
 
-    uint8_t *       Next(uint8_t *aBufferPtr) const;
-    uint8_t *       Advance(uint8_t *aBufPtr, uint8_t aOffset) const;
-    uint16_t        GetDistance(uint8_t *aStartPtr, uint8_t *aEndPtr) const;
+    uint8_t *       Advance(uint8_t *aBufPtr, uint16_t aOffset, Priority aPriority) const;
+    uint16_t        GetDistance(const uint8_t *aStartPtr, const uint8_t *aEndPtr, Priority aPriority) const;
+
+    uint16_t        ReadUint16At(uint8_t *aBufPtr, Priority aPriority) const;
+    void            WriteUint16At(uint8_t *aBufPtr, uint16_t aValue, Priority aPriority);
+    uint32_t        ReadUint32At(uint8_t *aBufPtr, Priority aPriority) const;
+    void            WriteUint32At(uint8_t *aBufPtr, uint32_t aValue, Priority aPriority);
 
-    uint16_t        ReadUint16At(uint8_t *aBufPtr);
-    void            WriteUint16At(uint8_t *aBufPtr, uint16_t aValue);
+    static uint16_t GetSegmentHeaderSize(uint16_t aHeader);
+    static Priority GetOtherPriority(Priority aPriority);
+    bool            HasFrame(Priority aPriority) const;
+    void            UpdateLaneStart(Priority aPriority);
+    void            UpdateLaneStarts(void);
 
     ThreadError     InFrameFeedByte(uint8_t aByte);
     ThreadError     InFrameBeginSegment(void);
     void            InFrameEndSegment(uint16_t aSegmentHeaderFlags);
     void            InFrameDiscard(void);
 
+    void            OutFrameSelectPriority(void);
     ThreadError     OutFramePrepareSegment(void);
     void            OutFrameMoveToNextSegment(void);
     ThreadError     OutFramePrepareMessage(void);
-    ThreadError     OutFrameFillMessageBuffer(void);
+    ThreadError     OutFrameNextMessageSegment(void);
 
     // Instance variables
 
-    uint8_t * const mBuffer;                    // Pointer to the buffer used to store the data.
-    uint8_t * const mBufferEnd;                 // Points to after the end of buffer.
-    const uint16_t  mBufferLength;              // Length of the the buffer.
-
-    BufferCallback  mEmptyBufferCallback;       // Callback to signal when buffer becomes empty.
-    BufferCallback  mNonEmptyBufferCallback;    // Callback to signal when buffer becomes non-empty.
-    void *          mCallbackContext;           // Context passed to callbacks.
-
-    otMessageQueue  mMessageQueue;              // Main message queue.
-
-    otMessageQueue  mWriteFrameMessageQueue;    // Message queue for the current frame being written.
-    uint8_t *       mWriteFrameStart;           // Pointer to start of current frame being written.
-    uint8_t *       mWriteSegmentHead;          // Pointer to start of current segment in the frame being written.
-    uint8_t *       mWriteSegmentTail;          // Pointer to end of current segment in the frame being written.
-
-    ReadState       mReadState;                 // Read state.
-    uint16_t        mReadFrameLength;           // Length of current frame being read.
-
-    uint8_t *       mReadFrameStart;            // Pointer to start of current frame being read.
-    uint8_t *       mReadSegmentHead;           // Pointer to start of current segment in the frame being read.
-    uint8_t *       mReadSegmentTail;           // Pointer to end of current segment in the frame being read.
-    uint8_t *       mReadPointer;               // Pointer to next byte to read (either in segment or in msg buffer).
-
-    otMessage *     mReadMessage;               // Current Message in the frame being read.
-    uint16_t        mReadMessageOffset;         // Offset within current message being read.
-
-    uint8_t         mMessageBuffer[kMessageReadBufferSize];   // Buffer to hold part of current message being read.
-    uint8_t *       mReadMessageTail;           // Pointer to end of current part in mMessageBuffer.
+    uint8_t * const mBuffer;                            // Pointer to the buffer used to store the data.
+    uint8_t * const mBufferEnd;                         // Points to after the end of buffer.
+    const uint16_t  mBufferLength;                      // Length of the the buffer.
+
+    BufferCallback  mEmptyBufferCallback;               // Callback to signal when buffer becomes empty.
+    BufferCallback  mNonEmptyBufferCallback;            // Callback to signal when buffer becomes non-empty.
+    void *          mCallbackContext;                   // Context passed to callbacks.
+
+    otMessageQueue  mMessageQueue[kNumPriorities];      // Message queue of each lane.
+    uint16_t        mWatermark[kNumPriorities];         // Maximum number of bytes used by each lane.
+    LaneCounters    mCounters[kNumPriorities];          // Counters of each lane.
+
+    otMessageQueue  mWriteFrameMessageQueue;            // Message queue for the current frame being written.
+    Priority        mWritePriority;                     // Lane of the current frame being written.
+    uint8_t *       mWriteFrameStart[kNumPriorities];   // Pointer to start of frame being (or to be) written per lane.
+    uint8_t *       mWriteSegmentHead;                  // Pointer to start of current segment in frame being written.
+    uint8_t *       mWriteSegmentTail;                  // Pointer to end of current segment in the frame being written.
+
+    ReadState       mReadState;                         // Read state.
+    Priority        mReadPriority;                      // Lane of current frame being read.
+    uint16_t        mReadFrameLength;                   // Length of current frame being read.
+
+    uint8_t *       mReadFrameStart[kNumPriorities];    // Pointer to start of front frame of each lane.
+    uint8_t *       mReadSegmentHead;                   // Pointer to start of current segment in the frame being read.
+    uint8_t *       mReadSegmentTail;                   // Pointer to end of current segment in the frame being read.
+    uint8_t *       mReadPointer;                       // Pointer to next byte to read in segment.
+
+    otMessage *     mReadMessage;                       // Current Message in the frame being read.
+    otMessageCursor mReadMessageCursor;                 // Cursor within current message being read.
+    const uint8_t * mReadMessagePointer;                // Pointer to next byte to read in current message buffer.
+    const uint8_t * mReadMessageTail;                   // Pointer to end of current part of the message buffer.
 };
 
 }  // namespace Thread
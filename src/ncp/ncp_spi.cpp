@@ -297,6 +297,7 @@ ThreadError NcpSpi::PrepareNextSpiSendFrame(void)
     // class that space is now available for a new frame.
     mTxFrameBuffer.OutFrameRemove();
     super_t::HandleSpaceAvailableInTxBuffer();
+    super_t::HandleTransportFrameSent(1);
 
 exit:
     return errorCode;
@@ -90,11 +90,16 @@ NcpUart::NcpUart(otInstance *aInstance):
     mFrameDecoder(mRxBuffer, sizeof(mRxBuffer), &NcpUart::HandleFrame, &NcpUart::HandleError, this),
     mUartBuffer(),
     mState(kStartingFrame),
-    mByte(0),
-    mUartSendTask(aInstance->mIp6.mTaskletScheduler, EncodeAndSendToUart, this)
+    mIsCoalescing(false),
+    mCoalescedLength(0),
+    mSpinelFrameCount(0),
+    mUartSendTask(aInstance->mIp6.mTaskletScheduler, EncodeAndSendToUart, this),
+    mCoalescingTimer(aInstance->mIp6.mTimerScheduler, &NcpUart::HandleCoalescingTimer, this)
 {
     mTxFrameBuffer.SetCallbacks(NULL, TxFrameBufferHasData, this);
 
+    super_t::SetFrameCoalescingSupported();
+
     otPlatUartEnable();
 }
 
@@ -110,10 +115,27 @@ void NcpUart::TxFrameBufferHasData(void)
 {
     if (mUartBuffer.IsEmpty())
     {
-        mUartSendTask.Post();
+        if (super_t::IsFrameCoalescingEnabled() && super_t::GetFrameCoalescingDeadline() > 0)
+        {
+            // Hold the first frame on an idle link for a while, so that frames queued shortly after it can be sent
+            // in the same HDLC frame. Frames queued while the uart is busy are coalesced without a delay.
+            if (!mCoalescingTimer.IsRunning())
+            {
+                mCoalescingTimer.Start(super_t::GetFrameCoalescingDeadline());
+            }
+        }
+        else
+        {
+            mUartSendTask.Post();
+        }
     }
 }
 
+void NcpUart::HandleCoalescingTimer(void *aContext)
+{
+    static_cast<NcpUart *>(aContext)->mUartSendTask.Post();
+}
+
 void NcpUart::EncodeAndSendToUart(void *aContext)
 {
     NcpUart *obj = static_cast<NcpUart *>(aContext);
@@ -124,11 +146,17 @@ void NcpUart::EncodeAndSendToUart(void *aContext)
 // This method encodes a frame from the tx frame buffer (mTxFrameBuffer) into the uart buffer and sends it over uart.
 // If the uart buffer gets full, it sends the current encoded portion. This method remembers current state, so on
 // sub-sequent calls, it restarts encoding the bytes from where it left of in the frame .
+//
+// When the host has enabled frame coalescing and more than one frame is queued, the queued frames are encoded into
+// one HDLC frame, as a marker byte followed by each spinel frame prefixed with its little-endian 16-bit length.
 void NcpUart::EncodeAndSendToUart(void)
 {
     uint16_t len;
+    const uint8_t *data;
+    uint16_t encoded;
+    uint8_t lengthPrefix[kCoalescedLengthSize];
 
-    while (!mTxFrameBuffer.IsEmpty())
+    while (mState != kStartingFrame || !mTxFrameBuffer.IsEmpty())
     {
         switch (mState)
         {
@@ -138,15 +166,52 @@ void NcpUart::EncodeAndSendToUart(void)
 
             mTxFrameBuffer.OutFrameBegin();
 
+            mSpinelFrameCount = 0;
+            mCoalescedLength = kCoalescedMarkerSize + kCoalescedLengthSize + mTxFrameBuffer.OutFrameGetLength();
+            mIsCoalescing = super_t::IsFrameCoalescingEnabled() && mTxFrameBuffer.OutFrameHasNext() &&
+                            (mCoalescedLength < kCoalescedFrameMaxSize);
+
+            if (!mIsCoalescing)
+            {
+                mState = kEncodingFrame;
+                break;
+            }
+
+            mState = kStartingCoalescedFrame;
+
+            // fall through
+
+        case kStartingCoalescedFrame:
+
+            SuccessOrExit(mFrameEncoder.Encode(SPINEL_FRAME_COALESCED_MARKER, mUartBuffer));
+
+            mState = kEncodingFrameLength;
+
+            // fall through
+
+        case kEncodingFrameLength:
+
+            len = mTxFrameBuffer.OutFrameGetLength();
+            lengthPrefix[0] = static_cast<uint8_t>(len & 0xff);
+            lengthPrefix[1] = static_cast<uint8_t>(len >> 8);
+
+            SuccessOrExit(mFrameEncoder.Encode(lengthPrefix, sizeof(lengthPrefix), mUartBuffer));
+
             mState = kEncodingFrame;
 
+            // fall through
+
+        case kEncodingFrame:
+
+            // Encode the frame directly from the frame buffer and message buffers, one contiguous part at a time.
+            // Only the bytes that fit in the uart buffer are consumed, so encoding resumes from there next time.
             while (!mTxFrameBuffer.OutFrameHasEnded())
             {
-                mByte = mTxFrameBuffer.OutFrameReadByte();
-
-            case kEncodingFrame:
+                len = mTxFrameBuffer.OutFramePeek(data);
+                encoded = mFrameEncoder.EncodePartial(data, len, mUartBuffer);
+                mTxFrameBuffer.OutFrameSkip(encoded);
 
-                SuccessOrExit(mFrameEncoder.Encode(mByte, mUartBuffer));
+                VerifyOrExit(encoded == len, ;);
             }
 
             mTxFrameBuffer.OutFrameRemove();
@@ -154,6 +219,22 @@ void NcpUart::EncodeAndSendToUart(void)
             // Notify the super/base class that there is space available in tx frame buffer for a new frame.
             super_t::HandleSpaceAvailableInTxBuffer();
 
+            mSpinelFrameCount++;
+
+            // Append the next queued frame to a coalesced frame, as long as the host can receive the result.
+            if (mIsCoalescing && !mTxFrameBuffer.IsEmpty())
+            {
+                len = kCoalescedLengthSize + mTxFrameBuffer.OutFrameGetLength();
+
+                if (mCoalescedLength + len <= kCoalescedFrameMaxSize)
+                {
+                    mTxFrameBuffer.OutFrameBegin();
+                    mCoalescedLength += len;
+                    mState = kEncodingFrameLength;
+                    break;
+                }
+            }
+
             mState = kFinalizingFrame;
 
             // fall through
@@ -162,6 +243,8 @@ void NcpUart::EncodeAndSendToUart(void)
 
             SuccessOrExit(mFrameEncoder.Finalize(mUartBuffer));
 
+            super_t::HandleTransportFrameSent(mSpinelFrameCount);
+
             mState = kStartingFrame;
         }
     }
@@ -205,7 +288,31 @@ void NcpUart::HandleFrame(void *context, uint8_t *aBuf, uint16_t aBufLength)
 
 void NcpUart::HandleFrame(uint8_t *aBuf, uint16_t aBufLength)
 {
-    super_t::HandleReceive(aBuf, aBufLength);
+    uint16_t offset;
+    uint16_t len;
+
+    if ((aBufLength == 0) || (aBuf[0] != SPINEL_FRAME_COALESCED_MARKER))
+    {
+        super_t::HandleReceive(aBuf, aBufLength);
+        ExitNow();
+    }
+
+    // Split a coalesced frame into its length-prefixed spinel frames. A zero length, or a length prefix or spinel frame
+    // cut short by the end of the frame, is a framing error and drops the rest of the frame.
+    for (offset = kCoalescedMarkerSize; offset < aBufLength; offset += len)
+    {
+        VerifyOrExit(aBufLength - offset >= kCoalescedLengthSize, super_t::IncrementFrameErrorCounter());
+
+        len = static_cast<uint16_t>(aBuf[offset] | (aBuf[offset + 1] << 8));
+        offset += kCoalescedLengthSize;
+
+        VerifyOrExit((len > 0) && (len <= aBufLength - offset), super_t::IncrementFrameErrorCounter());
+
+        super_t::HandleReceive(aBuf + offset, len);
+    }
+
+exit:
+    return;
 }
 
 void NcpUart::HandleError(void *context, ThreadError aError, uint8_t *aBuf, uint16_t aBufLength)
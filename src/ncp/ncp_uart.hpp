@@ -39,6 +39,7 @@
 #include <openthread-config.h>
 #endif
 
+#include <common/timer.hpp>
 #include <ncp/ncp_base.hpp>
 #include <ncp/hdlc.hpp>
 
@@ -78,9 +79,18 @@ private:
                                                                        // one whole (decoded) received frame).
     };
 
+    enum
+    {
+        kCoalescedMarkerSize   = 1,                      // Size of the marker starting a coalesced frame.
+        kCoalescedLengthSize   = 2,                      // Size of the length prefix of each coalesced spinel frame.
+        kCoalescedFrameMaxSize = SPINEL_FRAME_MAX_SIZE,  // Max decoded size of a coalesced frame.
+    };
+
     enum UartTxState
     {
         kStartingFrame,          // Starting a new frame.
+        kStartingCoalescedFrame, // Writing the marker of a coalesced frame.
+        kEncodingFrameLength,    // Writing the length prefix of a spinel frame in a coalesced frame.
         kEncodingFrame,          // In middle of encoding a frame.
         kFinalizingFrame,        // Finalizing a frame.
     };
@@ -105,6 +115,7 @@ private:
     void            TxFrameBufferHasData(void);
 
     static void     EncodeAndSendToUart(void *aContext);
+    static void     HandleCoalescingTimer(void *aContext);
     static void     HandleFrame(void *context, uint8_t *aBuf, uint16_t aBufLength);
     static void     HandleError(void *context, ThreadError aError, uint8_t *aBuf, uint16_t aBufLength);
     static void     TxFrameBufferHasData(void *aContext, NcpFrameBuffer *aNcpFrameBuffer);
@@ -113,9 +124,12 @@ private:
     Hdlc::Decoder   mFrameDecoder;
     UartTxBuffer    mUartBuffer;
     UartTxState     mState;
-    uint8_t         mByte;
+    bool            mIsCoalescing;
+    uint16_t        mCoalescedLength;
+    uint16_t        mSpinelFrameCount;
     uint8_t         mRxBuffer[kRxBufferSize];
     Tasklet         mUartSendTask;
+    Timer           mCoalescingTimer;
 };
 
 }  // namespace Thread
@@ -73,6 +73,10 @@
 
 #define SPINEL_FRAME_MAX_SIZE                   1300
 
+/// First byte of a transport frame carrying several length-prefixed spinel frames
+/// (see SPINEL_PROP_UART_FRAME_COALESCING). It is not a valid spinel header.
+#define SPINEL_FRAME_COALESCED_MARKER           0x7f
+
 /// Macro for generating bit masks using bit index from the spec
 #define SPINEL_BIT_MASK(bit_index,field_bit_count) \
     ( (1 << ((field_bit_count) - 1)) >> (bit_index))
@@ -344,6 +348,7 @@ enum
     SPINEL_CAP_OPENTHREAD__BEGIN     = 512,
     SPINEL_CAP_MAC_WHITELIST         = (SPINEL_CAP_OPENTHREAD__BEGIN + 0),
     SPINEL_CAP_MAC_RAW               = (SPINEL_CAP_OPENTHREAD__BEGIN + 1),
+    SPINEL_CAP_FRAME_COALESCING      = (SPINEL_CAP_OPENTHREAD__BEGIN + 2),
     SPINEL_CAP_OPENTHREAD__END       = 640,
 
     SPINEL_CAP_NEST__BEGIN           = 15296,
@@ -865,6 +870,37 @@ typedef enum
      */
     SPINEL_PROP_UART_XON_XOFF   = 0x101,
 
+    /// UART Frame Coalescing
+    /** Format: `b`
+     *
+     *  When enabled, the NCP may carry several spinel frames in one
+     *  HDLC frame. Such a frame starts with the byte
+     *  `SPINEL_FRAME_COALESCED_MARKER`, followed by one or more spinel
+     *  frames, each prefixed with its non-zero length as a little-endian
+     *  `uint16_t`. Any other frame carries a single spinel frame as
+     *  before, so the host can enable this at any time. The NCP also
+     *  accepts coalesced frames from the host.
+     *
+     *  Only supported if SPINEL_CAP_FRAME_COALESCING is set. Disabled
+     *  by default.
+     */
+    SPINEL_PROP_UART_FRAME_COALESCING
+                                = 0x102,
+
+    /// UART Frame Coalescing Deadline
+    /** Format: `S` (units: milliseconds)
+     *
+     *  The longest time the NCP holds a spinel frame on an idle link
+     *  while waiting for more frames to coalesce with it. Frames that
+     *  queue up while a previous HDLC frame is being sent are
+     *  coalesced without any additional delay. Zero disables the
+     *  wait.
+     *
+     *  Only supported if SPINEL_CAP_FRAME_COALESCING is set.
+     */
+    SPINEL_PROP_UART_FRAME_COALESCING_DEADLINE
+                                = 0x103,
+
     SPINEL_PROP_15_4_PIB__BEGIN     = 1024,
     // For direct access to the 802.15.4 PID.
     // Individual registers are fetched using
@@ -1052,8 +1088,22 @@ typedef enum
     SPINEL_PROP_CNTR_RX_SPINEL_OUT_OF_ORDER_TID
                                        = SPINEL_PROP_CNTR__BEGIN + 303,
 
+    /// The number of transmitted transport (e.g. HDLC) frames.
+    /** Format: `L` (Read-only)
+     *
+     *  The average number of spinel frames per transport frame is
+     *  SPINEL_PROP_CNTR_TX_SPINEL_TOTAL divided by this counter.
+     */
+    SPINEL_PROP_CNTR_TX_TRANSPORT_TOTAL
+                                       = SPINEL_PROP_CNTR__BEGIN + 304,
+
+    /// The number of spinel frames transmitted in coalesced transport frames.
+    /** Format: `L` (Read-only) */
+    SPINEL_PROP_CNTR_TX_SPINEL_COALESCED
+                                       = SPINEL_PROP_CNTR__BEGIN + 305,
+
     /// The message buffer counter info
-    /** Format: `SSSSSSSSSSSSSSSS` (Read-only)
+    /** Format: `SSSSSSSSSSSSSSSSSS` (Read-only)
      *      `S`, (TotalBuffers)           The number of buffers in the pool.
      *      `S`, (FreeBuffers)            The number of free message buffers.
      *      `S`, (6loSendMessages)        The number of messages in the 6lo send queue.
@@ -1070,9 +1120,24 @@ typedef enum
      *      `S`, (ArpBuffers)             The number of buffers in the ARP send queue.
      *      `S`, (CoapClientMessages)     The number of messages in the CoAP client send queue.
      *      `S`, (CoapClientBuffers)      The number of buffers in the CoAP client send queue.
+     *      `S`, (6loRelayMessages)       The number of messages in the 6LoWPAN mesh relay queue.
+     *      `S`, (6loRelayBuffers)        The number of buffers in the 6LoWPAN mesh relay queue.
      */
     SPINEL_PROP_MSG_BUFFER_COUNTERS    = SPINEL_PROP_CNTR__BEGIN + 400,
 
+    /// The NCP transmit buffer lane counters
+    /** Format: `SSLLLLSSLLLL` (Read-only)
+     *
+     * Control (high priority) lane counters followed by bulk data (low priority) lane counters:
+     *      `S`, (Frames)                 The number of frames currently queued in the lane.
+     *      `S`, (PeakFrames)             The largest number of frames queued in the lane at once.
+     *      `L`, (SentFrames)             The number of frames sent from the lane.
+     *      `L`, (DroppedFrames)          The number of frames dropped because the lane was full.
+     *      `L`, (TotalWaitTime)          The total time sent frames were queued in the lane, in milliseconds.
+     *      `L`, (MaxWaitTime)            The longest time a sent frame was queued in the lane, in milliseconds.
+     */
+    SPINEL_PROP_TX_LANE_COUNTERS       = SPINEL_PROP_CNTR__BEGIN + 401,
+
     SPINEL_PROP_CNTR__END       = 2048,
 
     SPINEL_PROP_NEST__BEGIN         = 15296,
@@ -27,7 +27,6 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
 import config
@@ -43,9 +42,11 @@ SNIFFER = 3
 class Cert_5_1_01_RouterAttach(unittest.TestCase):
 
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1, 3):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
@@ -68,15 +69,16 @@ class Cert_5_1_01_RouterAttach(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
         self.nodes[LEADER].set_state('leader')
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
-        time.sleep(4)
+        self.simulator.go(4)
 
         self.nodes[ROUTER].start()
-        time.sleep(7)
+        self.simulator.go(7)
         self.assertEqual(self.nodes[ROUTER].get_state(), 'router')
 
         leader_messages = self.sniffer.get_messages_sent_by(LEADER)
@@ -27,7 +27,6 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
 import config
@@ -43,9 +42,11 @@ SNIFFER = 3
 class Cert_5_1_05_RouterAddressTimeout(unittest.TestCase):
 
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1, 3):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
@@ -68,32 +69,33 @@ class Cert_5_1_05_RouterAddressTimeout(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
         self.nodes[LEADER].set_state('leader')
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
-        time.sleep(4)
+        self.simulator.go(4)
 
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
 
         rloc16 = self.nodes[ROUTER1].get_addr16()
 
         self.nodes[ROUTER1].stop()
-        time.sleep(200)
+        self.simulator.go(200)
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
         self.assertNotEqual(self.nodes[ROUTER1].get_addr16(), rloc16)
 
         rloc16 = self.nodes[ROUTER1].get_addr16()
 
         self.nodes[ROUTER1].stop()
-        time.sleep(300)
+        self.simulator.go(300)
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
         self.assertEqual(self.nodes[ROUTER1].get_addr16(), rloc16)
 
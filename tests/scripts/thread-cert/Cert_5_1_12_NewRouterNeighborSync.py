@@ -27,7 +27,6 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
 import config
@@ -43,9 +42,11 @@ SNIFFER = 4
 class Cert_5_1_12_NewRouterSync(unittest.TestCase):
 
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1, 4):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
@@ -75,6 +76,7 @@ class Cert_5_1_12_NewRouterSync(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def verify_step_4(self, router1_messages, router2_messages, req_receiver, accept_receiver):
         if router2_messages.contains_mle_message(mle.CommandType.LINK_REQUEST) and \
@@ -115,17 +117,17 @@ class Cert_5_1_12_NewRouterSync(unittest.TestCase):
         self.nodes[LEADER].start()
         self.nodes[LEADER].set_state('leader')
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
-        time.sleep(4)
+        self.simulator.go(4)
 
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
-        time.sleep(10)
+        self.simulator.go(10)
 
         leader_messages = self.sniffer.get_messages_sent_by(LEADER)
         router1_messages = self.sniffer.get_messages_sent_by(ROUTER1)
@@ -142,7 +144,7 @@ class Cert_5_1_12_NewRouterSync(unittest.TestCase):
         self.nodes[ROUTER1].add_whitelist(self.nodes[ROUTER2].get_addr64())
         self.nodes[ROUTER2].add_whitelist(self.nodes[ROUTER1].get_addr64())
 
-        time.sleep(35)
+        self.simulator.go(35)
 
         leader_messages = self.sniffer.get_messages_sent_by(LEADER)
         router1_messages = self.sniffer.get_messages_sent_by(ROUTER1)
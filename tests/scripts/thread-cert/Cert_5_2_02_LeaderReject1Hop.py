@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 LEADER = 1
@@ -37,9 +37,11 @@ DUT = 33
 
 class Cert_5_2_2_LeaderReject1Hop(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
 
-        self.nodes[LEADER] = node.Node(LEADER)
+        self.nodes[LEADER] = node.Node(LEADER, simulator=self.simulator)
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
         self.nodes[LEADER].enable_whitelist()
@@ -47,7 +49,7 @@ class Cert_5_2_2_LeaderReject1Hop(unittest.TestCase):
         self.nodes[LEADER].set_router_downgrade_threshold(33)
 
         for i in range(2,34):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
             self.nodes[i].set_panid(0xface)
             self.nodes[i].set_mode('rsdn')
             self.nodes[i].add_whitelist(self.nodes[LEADER].get_addr64())
@@ -61,6 +63,7 @@ class Cert_5_2_2_LeaderReject1Hop(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -69,11 +72,11 @@ class Cert_5_2_2_LeaderReject1Hop(unittest.TestCase):
 
         for i in range(2, 33):
             self.nodes[i].start()
-            time.sleep(5)
+            self.simulator.go(5)
             self.assertEqual(self.nodes[i].get_state(), 'router')
 
         self.nodes[DUT].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[DUT].get_state(), 'child')
 
 if __name__ == '__main__':
@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 ED1 = 1
@@ -42,9 +42,11 @@ ED3 = 7
 
 class Cert_5_2_5_AddressQuery(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,8):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
@@ -95,6 +97,7 @@ class Cert_5_2_5_AddressQuery(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -102,7 +105,7 @@ class Cert_5_2_5_AddressQuery(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
 
         self.nodes[BR1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[BR1].get_state(), 'router')
 
         self.nodes[BR1].add_prefix('2001:2:0:3::/64', 'paros')
@@ -110,30 +113,30 @@ class Cert_5_2_5_AddressQuery(unittest.TestCase):
         self.nodes[BR1].register_netdata()
 
         self.nodes[ED1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED1].get_state(), 'child')
 
         self.nodes[REED].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[REED].get_state(), 'child')
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[ED2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED2].get_state(), 'child')
 
         self.nodes[ED3].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED3].get_state(), 'child')
 
         addrs = self.nodes[REED].get_addrs()
         for addr in addrs:
             if addr[0:4] != 'fe80':
                 self.assertTrue(self.nodes[ED2].ping(addr))
-                time.sleep(1)
+                self.simulator.go(1)
 
 if __name__ == '__main__':
     unittest.main()
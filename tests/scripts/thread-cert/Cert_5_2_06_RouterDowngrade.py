@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 LEADER = 1
@@ -37,9 +37,11 @@ ROUTER1 = 2
 
 class Cert_5_2_06_RouterDowngrade(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1, 26):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
             self.nodes[i].set_panid(0xface)
             self.nodes[i].set_mode('rsdn')
             self.nodes[i].set_router_selection_jitter(1)
@@ -51,6 +53,7 @@ class Cert_5_2_06_RouterDowngrade(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -59,14 +62,14 @@ class Cert_5_2_06_RouterDowngrade(unittest.TestCase):
 
         for i in range(2, 25):
             self.nodes[i].start()
-            time.sleep(5)
+            self.simulator.go(5)
             self.assertEqual(self.nodes[i].get_state(), 'router')
 
         self.nodes[25].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[25].get_state(), 'router')
 
-        time.sleep(10)
+        self.simulator.go(10)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'child')
 
 if __name__ == '__main__':
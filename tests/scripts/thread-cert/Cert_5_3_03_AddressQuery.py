@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 BR = 1
@@ -40,9 +40,11 @@ ED2 = 5
 
 class Cert_5_3_3_AddressQuery(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,6):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
@@ -82,6 +84,7 @@ class Cert_5_3_3_AddressQuery(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -89,7 +92,7 @@ class Cert_5_3_3_AddressQuery(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
 
         self.nodes[BR].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[BR].get_state(), 'router')
 
         self.nodes[BR].add_prefix('2001:2:0:3::/64', 'paros')
@@ -97,44 +100,44 @@ class Cert_5_3_3_AddressQuery(unittest.TestCase):
         self.nodes[BR].register_netdata()
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[ROUTER3].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER3].get_state(), 'router')
 
         self.nodes[ED2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED2].get_state(), 'child')
 
         addrs = self.nodes[ROUTER3].get_addrs()
         for addr in addrs:
             if addr[0:4] != 'fe80':
                 self.assertTrue(self.nodes[ED2].ping(addr))
-                time.sleep(1)
+                self.simulator.go(1)
 
         addrs = self.nodes[ED2].get_addrs()
         for addr in addrs:
             if addr[0:4] != 'fe80':
                 self.assertTrue(self.nodes[LEADER].ping(addr))
-                time.sleep(1)
+                self.simulator.go(1)
 
         addrs = self.nodes[BR].get_addrs()
         for addr in addrs:
             if addr[0:4] != 'fe80':
                 self.assertTrue(self.nodes[ED2].ping(addr))
-                time.sleep(1)
+                self.simulator.go(1)
 
         addrs = self.nodes[ROUTER3].get_addrs()
         for addr in addrs:
             if addr[0:4] != 'fe80':
                 self.assertTrue(self.nodes[ED2].ping(addr))
-                time.sleep(1)
+                self.simulator.go(1)
 
         addrs = self.nodes[ROUTER3].get_addrs()
         self.nodes[ROUTER3].stop()
-        time.sleep(140)
+        self.simulator.go(140)
 
         for addr in addrs:
             if addr[0:4] != 'fe80':
@@ -142,7 +145,7 @@ class Cert_5_3_3_AddressQuery(unittest.TestCase):
 
         addrs = self.nodes[ED2].get_addrs()
         self.nodes[ED2].stop()
-        time.sleep(10)
+        self.simulator.go(10)
         for addr in addrs:
             if addr[0:4] != 'fe80':
                 self.assertFalse(self.nodes[BR].ping(addr))
@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 LEADER = 1
@@ -41,9 +41,11 @@ ED3 = 6
 
 class Cert_5_3_7_DuplicateAddress(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,7):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
@@ -85,6 +87,7 @@ class Cert_5_3_7_DuplicateAddress(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -92,23 +95,23 @@ class Cert_5_3_7_DuplicateAddress(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
 
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[ED1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED1].get_state(), 'child')
 
         self.nodes[ED2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED2].get_state(), 'child')
 
         self.nodes[ED3].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED3].get_state(), 'child')
 
         self.nodes[ROUTER2].add_prefix('2001:2:0:1::/64', 'paros')
@@ -116,7 +119,7 @@ class Cert_5_3_7_DuplicateAddress(unittest.TestCase):
 
         self.nodes[ED1].add_ipaddr('2001:2:0:1::1')
         self.nodes[ED2].add_ipaddr('2001:2:0:1::1')
-        time.sleep(5)
+        self.simulator.go(5)
 
         self.assertTrue(self.nodes[ED3].ping('2001:2:0:1::1'))
 
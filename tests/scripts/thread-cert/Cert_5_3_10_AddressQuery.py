@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 LEADER = 1
@@ -40,9 +40,11 @@ SED2 = 5
 
 class Cert_5_3_10_AddressQuery(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,6):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER].set_panid(0xface)
         self.nodes[LEADER].set_mode('rsdn')
@@ -81,6 +83,7 @@ class Cert_5_3_10_AddressQuery(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -88,7 +91,7 @@ class Cert_5_3_10_AddressQuery(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
 
         self.nodes[BR].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[BR].get_state(), 'router')
 
         self.nodes[BR].add_prefix('2001:2:0:3::/64', 'paros')
@@ -96,15 +99,15 @@ class Cert_5_3_10_AddressQuery(unittest.TestCase):
         self.nodes[BR].register_netdata()
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[ROUTER3].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER3].get_state(), 'router')
 
         self.nodes[SED2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[SED2].get_state(), 'child')
 
         addrs = self.nodes[ROUTER3].get_addrs()
@@ -123,7 +126,7 @@ class Cert_5_3_10_AddressQuery(unittest.TestCase):
                 self.assertTrue(self.nodes[SED2].ping(addr))
 
         self.nodes[ROUTER3].stop()
-        time.sleep(300)
+        self.simulator.go(300)
         
         addrs = self.nodes[ROUTER3].get_addrs()
         for addr in addrs:
@@ -131,7 +134,7 @@ class Cert_5_3_10_AddressQuery(unittest.TestCase):
                 self.assertFalse(self.nodes[SED2].ping(addr))
 
         self.nodes[SED2].stop()
-        time.sleep(10)
+        self.simulator.go(10)
 
         addrs = self.nodes[SED2].get_addrs()
         for addr in addrs:
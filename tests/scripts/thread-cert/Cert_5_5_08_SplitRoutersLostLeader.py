@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 LEADER1 = 1
@@ -40,9 +40,11 @@ ED1 = 5
 
 class Cert_5_5_8_SplitRoutersLostLeader(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,6):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[LEADER1].set_panid(0xface)
         self.nodes[LEADER1].set_mode('rsdn')
@@ -81,6 +83,7 @@ class Cert_5_5_8_SplitRoutersLostLeader(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER1].start()
@@ -88,19 +91,19 @@ class Cert_5_5_8_SplitRoutersLostLeader(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER1].get_state(), 'leader')
 
         self.nodes[ROUTER3].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER3].get_state(), 'router')
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
 
         self.nodes[ED1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ED1].get_state(), 'child')
 
         addrs = self.nodes[ED1].get_addrs()
@@ -109,10 +112,10 @@ class Cert_5_5_8_SplitRoutersLostLeader(unittest.TestCase):
                 self.assertTrue(self.nodes[LEADER1].ping(addr))
 
         self.nodes[ROUTER3].stop()
-        time.sleep(140)
+        self.simulator.go(140)
 
         self.nodes[ROUTER3].start()        
-        time.sleep(60)
+        self.simulator.go(60)
 
         addrs = self.nodes[ED1].get_addrs()
         for addr in addrs:
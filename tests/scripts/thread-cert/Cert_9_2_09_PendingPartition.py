@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 CHANNEL_INIT = 19
@@ -45,9 +45,11 @@ ROUTER2 = 4
 
 class Cert_9_2_09_PendingPartition(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,5):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[COMMISSIONER].set_active_dataset(10, channel=CHANNEL_INIT, panid=PANID_INIT)
         self.nodes[COMMISSIONER].set_mode('rsdn')
@@ -81,6 +83,7 @@ class Cert_9_2_09_PendingPartition(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -88,15 +91,15 @@ class Cert_9_2_09_PendingPartition(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
 
         self.nodes[COMMISSIONER].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[COMMISSIONER].get_state(), 'router')
 
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[COMMISSIONER].send_mgmt_pending_set(pending_timestamp=30,
@@ -104,11 +107,11 @@ class Cert_9_2_09_PendingPartition(unittest.TestCase):
                                                        delay_timer=500000,
                                                        channel=20,
                                                        panid=0xafce)
-        time.sleep(5)
+        self.simulator.go(5)
 
         self.nodes[LEADER].remove_whitelist(self.nodes[ROUTER1].get_addr64())
         self.nodes[ROUTER1].remove_whitelist(self.nodes[LEADER].get_addr64())
-        time.sleep(140)
+        self.simulator.go(140)
 
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'leader')
@@ -118,11 +121,11 @@ class Cert_9_2_09_PendingPartition(unittest.TestCase):
                                                   delay_timer=200000,
                                                   channel=CHANNEL_FINAL,
                                                   panid=PANID_FINAL)
-        time.sleep(5)
+        self.simulator.go(5)
 
         self.nodes[LEADER].add_whitelist(self.nodes[ROUTER1].get_addr64())
         self.nodes[ROUTER1].add_whitelist(self.nodes[LEADER].get_addr64())
-        time.sleep(200)
+        self.simulator.go(200)
 
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
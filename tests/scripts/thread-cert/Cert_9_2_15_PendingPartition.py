@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 CHANNEL_INIT = 19
@@ -44,9 +44,11 @@ ROUTER2 = 4
 
 class Cert_9_2_15_PendingPartition(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,5):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[COMMISSIONER].set_active_dataset(15, channel=CHANNEL_INIT, panid=PANID_INIT)
         self.nodes[COMMISSIONER].set_mode('rsdn')
@@ -79,6 +81,7 @@ class Cert_9_2_15_PendingPartition(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -86,21 +89,21 @@ class Cert_9_2_15_PendingPartition(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
 
         self.nodes[COMMISSIONER].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[COMMISSIONER].get_state(), 'router')
 
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
 
         self.nodes[COMMISSIONER].send_mgmt_pending_set(pending_timestamp=10,
                                                        active_timestamp=70,
                                                        delay_timer=600000,
                                                        mesh_local='fd00:0db9::')
-        time.sleep(5)
+        self.simulator.go(5)
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[ROUTER2].stop()
@@ -110,12 +113,12 @@ class Cert_9_2_15_PendingPartition(unittest.TestCase):
                                                        delay_timer=200000,
                                                        mesh_local='fd00:0db7::',
                                                        panid=PANID_FINAL)
-        time.sleep(100)
+        self.simulator.go(100)
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
-        time.sleep(100)
+        self.simulator.go(100)
 
         self.assertEqual(self.nodes[COMMISSIONER].get_panid(), PANID_FINAL)
         self.assertEqual(self.nodes[LEADER].get_panid(), PANID_FINAL)
@@ -27,9 +27,9 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
-import time
 import unittest
 
+import config
 import node
 
 CHANNEL_INIT = 19
@@ -45,9 +45,11 @@ ROUTER2 = 4
 
 class Cert_9_2_16_ActivePendingPartition(unittest.TestCase):
     def setUp(self):
+        self.simulator = config.create_default_simulator()
+
         self.nodes = {}
         for i in range(1,5):
-            self.nodes[i] = node.Node(i)
+            self.nodes[i] = node.Node(i, simulator=self.simulator)
 
         self.nodes[COMMISSIONER].set_active_dataset(1, channel=CHANNEL_INIT, panid=PANID_INIT)
         self.nodes[COMMISSIONER].set_mode('rsdn')
@@ -80,6 +82,7 @@ class Cert_9_2_16_ActivePendingPartition(unittest.TestCase):
         for node in list(self.nodes.values()):
             node.stop()
         del self.nodes
+        del self.simulator
 
     def test(self):
         self.nodes[LEADER].start()
@@ -87,21 +90,21 @@ class Cert_9_2_16_ActivePendingPartition(unittest.TestCase):
         self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
 
         self.nodes[COMMISSIONER].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[COMMISSIONER].get_state(), 'router')
 
         self.nodes[ROUTER1].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER1].get_state(), 'router')
 
         self.nodes[COMMISSIONER].send_mgmt_pending_set(pending_timestamp=10,
                                                        active_timestamp=10,
                                                        delay_timer=600000,
                                                        mesh_local='fd00:0db9::')
-        time.sleep(5)
+        self.simulator.go(5)
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.nodes[ROUTER2].stop()
@@ -111,14 +114,14 @@ class Cert_9_2_16_ActivePendingPartition(unittest.TestCase):
                                                        delay_timer=200000,
                                                        mesh_local='fd00:0db7::',
                                                        panid=PANID_FINAL)
-        time.sleep(5)
+        self.simulator.go(5)
 
         self.nodes[COMMISSIONER].send_mgmt_active_set(active_timestamp=15,
                                                       network_name='threadCert')
-        time.sleep(100)
+        self.simulator.go(100)
 
         self.nodes[ROUTER2].start()
-        time.sleep(5)
+        self.simulator.go(5)
         self.assertEqual(self.nodes[ROUTER2].get_state(), 'router')
 
         self.assertEqual(self.nodes[COMMISSIONER].get_network_name(), NETWORK_NAME_FINAL)
@@ -126,7 +129,7 @@ class Cert_9_2_16_ActivePendingPartition(unittest.TestCase):
         self.assertEqual(self.nodes[ROUTER1].get_network_name(), NETWORK_NAME_FINAL)
         self.assertEqual(self.nodes[ROUTER2].get_network_name(), NETWORK_NAME_FINAL)
 
-        time.sleep(100)
+        self.simulator.go(100)
 
         self.assertEqual(self.nodes[COMMISSIONER].get_panid(), PANID_FINAL)
         self.assertEqual(self.nodes[LEADER].get_panid(), PANID_FINAL)
@@ -27,6 +27,8 @@
 #  POSSIBILITY OF SUCH DAMAGE.
 #
 
+import os
+
 import coap
 import ipv6
 import lowpan
@@ -35,6 +37,7 @@ import mle
 import net_crypto
 import network_data
 import network_layer
+import simulator
 import sniffer
 
 DEFAULT_MASTER_KEY = bytearray([0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
@@ -285,3 +288,10 @@ def create_default_thread_message_factory(master_key=DEFAULT_MASTER_KEY):
 
 def create_default_thread_sniffer(nodeid):
     return sniffer.Sniffer(nodeid, create_default_thread_message_factory())
+
+
+def create_default_simulator():
+    if os.getenv('VIRTUAL_TIME') == '1':
+        return simulator.VirtualTime()
+
+    return simulator.RealTime()
@@ -0,0 +1,242 @@
+#!/usr/bin/python
+#
+#  Copyright (c) 2016, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+import errno
+import heapq
+import os
+import select
+import socket
+import struct
+import time
+
+
+class RealTime(object):
+    """ Lets nodes run against the wall clock. """
+
+    def set_awake(self, nodeid):
+        pass
+
+    def go(self, duration):
+        time.sleep(duration)
+
+    def stop(self):
+        pass
+
+
+class VirtualTime(object):
+    """ Discrete-event scheduler for posix nodes built with OPENTHREAD_POSIX_VIRTUAL_TIME.
+
+    Each node reports when it goes idle together with the time until its next alarm, and every radio frame it sends.
+    Virtual time only advances while all nodes are idle: the earliest pending event is delivered to its node, which
+    then runs until it is idle again. Events with the same timestamp are delivered in the order they were scheduled,
+    so a run replays identically as long as nodes are only driven through their CLI between calls to go().
+    """
+
+    OT_SIM_EVENT_ALARM_FIRED = 0
+    OT_SIM_EVENT_RADIO_RECEIVED = 1
+
+    EVENT_HEADER = struct.Struct('=QBH')
+
+    BASE_PORT = 9000
+
+    WELLKNOWN_NODE_ID = int(os.getenv('MAX_NODES', "34"))
+
+    PORT_OFFSET = int(os.getenv('PORT_OFFSET', "0"))
+
+    # 250 kbps O-QPSK: 32 us per octet, plus preamble, SFD and PHR.
+    BYTE_DURATION = 32
+    PHY_HEADER_LENGTH = 6
+
+    # Real time to wait for a woken node to become idle again, in seconds.
+    RESPONSE_TIMEOUT = 10
+
+    def __init__(self):
+        self._port = self.BASE_PORT + (self.PORT_OFFSET * self.WELLKNOWN_NODE_ID)
+
+        self._socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self._socket.bind(('127.0.0.1', self._port))
+
+        # Virtual time in microseconds.
+        self._now = 0
+
+        self._events = []
+        self._event_count = 0
+
+        # nodeid -> {'time': virtual time of the last event sent, 'alarm': sequence number of the scheduled alarm,
+        #            'awake': whether the node has yet to report it is idle, 'tx_end': end of its last transmission}
+        self._nodes = {}
+
+    def __del__(self):
+        self.stop()
+
+    def stop(self):
+        if self._socket is not None:
+            self._socket.close()
+            self._socket = None
+
+    @property
+    def now(self):
+        """ Current virtual time in seconds. """
+        return self._now / 1000000.0
+
+    def _node(self, nodeid):
+        if nodeid not in self._nodes:
+            self._nodes[nodeid] = {'time': self._now, 'alarm': None, 'awake': False, 'tx_end': 0}
+
+        return self._nodes[nodeid]
+
+    def _push_event(self, when, nodeid, event, data):
+        """ Schedule an event and return its sequence number. """
+        heapq.heappush(self._events, (when, self._event_count, nodeid, event, data))
+        self._event_count += 1
+
+        return self._event_count - 1
+
+    def _receive_event(self, timeout):
+        """ Handle one event from a node. Returns False if none arrived within timeout seconds. """
+        readable, _, _ = select.select([self._socket], [], [], timeout)
+
+        if not readable:
+            return False
+
+        try:
+            msg, address = self._socket.recvfrom(self.EVENT_HEADER.size + 1024)
+        except socket.error as e:
+            # Reported for a node that has already exited.
+            if e.errno != errno.ECONNREFUSED:
+                raise
+
+            return True
+
+        nodeid = address[1] - self._port
+
+        # Ignore anything that did not come from a simulated node.
+        if not (0 < nodeid < self.WELLKNOWN_NODE_ID) or len(msg) < self.EVENT_HEADER.size:
+            return True
+
+        delay, event, length = self.EVENT_HEADER.unpack(msg[:self.EVENT_HEADER.size])
+        data = msg[self.EVENT_HEADER.size:self.EVENT_HEADER.size + length]
+        node = self._node(nodeid)
+
+        if event == self.OT_SIM_EVENT_ALARM_FIRED:
+            # The node is idle; its alarm is relative to the last time it was told about.
+            node['awake'] = False
+            node['alarm'] = self._push_event(max(node['time'] + delay, self._now), nodeid, event, b'')
+
+        elif event == self.OT_SIM_EVENT_RADIO_RECEIVED:
+            # A radio sends one frame at a time; frames queued back to back must not overtake each other.
+            when = max(self._now, node['tx_end']) + (self.PHY_HEADER_LENGTH + len(data) - 1) * self.BYTE_DURATION
+            node['tx_end'] = when
+
+            for other in sorted(self._nodes):
+                if other != nodeid:
+                    self._push_event(when, other, event, data)
+
+            self._forward_to_sniffer(nodeid, data)
+
+        return True
+
+    def _forward_to_sniffer(self, nodeid, data):
+        """ Copy a frame, tagged with its sender, to every port a sniffer may listen on. """
+        frame = struct.pack('=H', nodeid) + data
+
+        for port in range(self._port + 1, self._port + self.WELLKNOWN_NODE_ID + 1):
+            if port - self._port in self._nodes:
+                continue
+
+            try:
+                self._socket.sendto(frame, ('127.0.0.1', port))
+            except socket.error:
+                pass
+
+    def _drain(self):
+        """ Handle every event already queued on the socket. """
+        while self._receive_event(0):
+            pass
+
+    def wait_idle(self):
+        """ Block until every node that was woken up reported it is idle again. """
+        deadline = time.time() + self.RESPONSE_TIMEOUT
+
+        while any(node['awake'] for node in self._nodes.values()):
+            remaining = deadline - time.time()
+
+            if remaining <= 0:
+                awake = [nodeid for nodeid, node in self._nodes.items() if node['awake']]
+                raise RuntimeError('Nodes %s did not become idle' % awake)
+
+            self._receive_event(remaining)
+
+        self._drain()
+
+    def _send_event(self, nodeid, event, data):
+        node = self._node(nodeid)
+        header = self.EVENT_HEADER.pack(self._now - node['time'], event, len(data))
+
+        node['time'] = self._now
+        node['awake'] = True
+
+        try:
+            self._socket.sendto(header + data, ('127.0.0.1', self._port + nodeid))
+        except socket.error:
+            node['awake'] = False
+
+    def set_awake(self, nodeid):
+        """ Note that a node is about to be driven through its CLI and will report when it is idle again. """
+        if self._socket is None:
+            return
+
+        self._drain()
+        self._node(nodeid)['awake'] = True
+
+    def go(self, duration):
+        """ Advance virtual time by duration seconds. """
+        end = self._now + int(duration * 1000000)
+
+        self.wait_idle()
+
+        while self._events and self._events[0][0] <= end:
+            when, sequence, nodeid, event, data = heapq.heappop(self._events)
+
+            # Drop alarms that a newer report from the node superseded.
+            if event == self.OT_SIM_EVENT_ALARM_FIRED and sequence != self._nodes[nodeid]['alarm']:
+                continue
+
+            self._now = when
+            self._send_event(nodeid, event, data)
+            self.wait_idle()
+
+        self._now = end
+
+        # Bring every node up to date so CLI commands issued next see the current time.
+        for nodeid in sorted(self._nodes):
+            if self._nodes[nodeid]['time'] < self._now:
+                self._send_event(nodeid, self.OT_SIM_EVENT_ALARM_FIRED, b'')
+
+        self.wait_idle()
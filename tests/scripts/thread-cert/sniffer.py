@@ -49,6 +49,8 @@ class Sniffer:
 
     RECV_BUFFER_SIZE = 4096
 
+    SYNC_TIMEOUT = 10
+
     def __init__(self, nodeid, message_factory):
         """
         Args:
@@ -67,6 +69,8 @@ class Sniffer:
         self._thread_alive = threading.Event()
         self._thread_alive.clear()
 
+        self._synced = threading.Event()
+
         self._buckets = collections.defaultdict(Queue.Queue)
 
     def __del__(self):
@@ -80,6 +84,10 @@ class Sniffer:
         while self._thread_alive.is_set():
             data, nodeid = self._transport.recv(self.RECV_BUFFER_SIZE)
 
+            if not data:
+                self._synced.set()
+                continue
+
             # Ignore any exceptions
             try:
                 msg = self._message_factory.create(io.BytesIO(data))
@@ -111,11 +119,23 @@ class Sniffer:
 
         self._thread_alive.clear()
 
+        # Nothing reaches the sniffer while virtual time stands still, so wake up the thread before closing.
+        self._sync()
+
         self._transport.close()
         
         self._thread.join()
         self._thread = None
 
+    def _sync(self):
+        """ Wait until every frame forwarded by the virtual time simulator so far has been processed. """
+        if self._thread is None or not isinstance(self._transport, sniffer_transport.SnifferVirtualTimeTransport):
+            return
+
+        self._synced.clear()
+        self._transport.wake()
+        self._synced.wait(self.SYNC_TIMEOUT)
+
     def get_messages_sent_by(self, nodeid):
         """ Get sniffed messages.
 
@@ -127,6 +147,8 @@ class Sniffer:
         Returns:
             MessagesSet: a set with received messages.
         """
+        self._sync()
+
         bucket = self._buckets[nodeid]
         messages = []
 
@@ -30,6 +30,7 @@
 import ctypes
 import os
 import socket
+import struct
 import sys
 
 class SnifferTransport(object):
@@ -92,7 +93,7 @@ class SnifferSocketTransport(SnifferTransport):
 
     BASE_PORT = 9000
 
-    WELLKNOWN_NODE_ID = 34
+    WELLKNOWN_NODE_ID = int(os.getenv('MAX_NODES', "34"))
 
     PORT_OFFSET = int(os.getenv('PORT_OFFSET', "0"))
 
@@ -148,6 +149,57 @@ class SnifferSocketTransport(SnifferTransport):
         return bytearray(data), nodeid
 
 
+class SnifferMulticastTransport(SnifferSocketTransport):
+    """ Socket based sniffer transport for nodes that share the multicast radio medium.
+
+    Nodes send every frame once to a multicast group on the loopback interface, from their own node port.
+    """
+
+    RADIO_GROUP = '224.0.0.116'
+
+    def open(self):
+        if self.is_opened:
+            raise RuntimeError("Transport is already opened.")
+
+        self._socket = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+
+        if not self.is_opened:
+            raise RuntimeError("Transport opening failed.")
+
+        self._socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+
+        if hasattr(socket, 'SO_REUSEPORT'):
+            self._socket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+
+        self._socket.bind(self._nodeid_to_address(0, self.RADIO_GROUP))
+
+        mreq = socket.inet_aton(self.RADIO_GROUP) + socket.inet_aton('127.0.0.1')
+        self._socket.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+
+
+class SnifferVirtualTimeTransport(SnifferSocketTransport):
+    """ Socket based sniffer transport fed by the virtual time simulator.
+
+    The simulator forwards every frame from its own socket, prefixed with the sender's node id.
+    """
+
+    NODEID_HEADER = struct.Struct('=H')
+
+    def wake(self):
+        """ Queue an empty datagram, returned by recv() as (bytearray(), None) once everything before it was read. """
+        self._socket.sendto(b'', ('127.0.0.1', self._socket.getsockname()[1]))
+
+    def recv(self, bufsize):
+        data, _ = self._socket.recvfrom(bufsize + self.NODEID_HEADER.size)
+
+        if len(data) < self.NODEID_HEADER.size:
+            return bytearray(), None
+
+        nodeid, = self.NODEID_HEADER.unpack(data[:self.NODEID_HEADER.size])
+
+        return bytearray(data[self.NODEID_HEADER.size:]), nodeid
+
+
 class MacFrame(ctypes.Structure):
     _fields_ = [("buffer", ctypes.c_ubyte * 128),
                 ("length", ctypes.c_ubyte),
@@ -212,6 +264,12 @@ class SnifferTransportFactory(object):
 
     def create_transport(self, nodeid):
         if sys.platform != "win32":
+            if os.getenv('VIRTUAL_TIME') == '1':
+                return SnifferVirtualTimeTransport(nodeid)
+
+            if os.getenv('RADIO_MEDIUM', 'multicast') == 'multicast':
+                return SnifferMulticastTransport(nodeid)
+
             return SnifferSocketTransport(nodeid)
 
         else:
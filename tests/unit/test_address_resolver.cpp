@@ -0,0 +1,355 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_util.h"
+#include "openthread/openthread.h"
+#include <coap/coap_header.hpp>
+#include <common/encoding.hpp>
+#include <net/ip6.hpp>
+#include <net/udp6.hpp>
+#include <thread/address_resolver.hpp>
+#include <thread/thread_netif.hpp>
+#include <thread/thread_tlvs.hpp>
+#include <thread/thread_uris.hpp>
+
+#include <string.h>
+
+using Thread::Encoding::BigEndian::HostSwap16;
+
+namespace Thread {
+
+static Ip6::Ip6 sIp6;
+static ThreadNetif sThreadNetif(sIp6);
+
+enum
+{
+    kNoEntry       = 0xff,
+    kRouterId      = 5,
+    kOtherRouterId = 9,
+};
+
+static void MakeEid(uint16_t aIndex, Ip6::Address &aEid)
+{
+    memset(&aEid, 0, sizeof(aEid));
+    aEid.mFields.m16[0] = HostSwap16(0xfd00);
+    aEid.mFields.m16[1] = HostSwap16(0x1234);
+    aEid.mFields.m16[6] = HostSwap16(0xeeee);
+    aEid.mFields.m16[7] = HostSwap16(aIndex);
+}
+
+static uint16_t GetRloc16(uint8_t aRouterId, uint16_t aIndex)
+{
+    return static_cast<uint16_t>((aRouterId << 10) | (aIndex & 0x1ff));
+}
+
+// Returns the number of cache entries, probing GetEntry() until it rejects the index.
+static uint8_t GetCacheSize(AddressResolver &aResolver)
+{
+    otEidCacheEntry entry;
+    uint8_t size = 0;
+
+    while (aResolver.GetEntry(size, entry) == kThreadError_None)
+    {
+        size++;
+    }
+
+    return size;
+}
+
+// Returns the index of the entry whose target is @p aEid, or kNoEntry.
+static uint8_t FindEntry(AddressResolver &aResolver, const Ip6::Address &aEid, bool &aValid)
+{
+    otEidCacheEntry entry;
+
+    for (uint8_t i = 0; aResolver.GetEntry(i, entry) == kThreadError_None; i++)
+    {
+        if (memcmp(&entry.mTarget, &aEid, sizeof(aEid)) == 0)
+        {
+            aValid = entry.mValid;
+            return i;
+        }
+    }
+
+    return kNoEntry;
+}
+
+static bool IsCached(AddressResolver &aResolver, const Ip6::Address &aEid)
+{
+    bool valid = false;
+
+    return FindEntry(aResolver, aEid, valid) != kNoEntry && valid;
+}
+
+// Delivers an Address Notification for @p aEid through the UDP and CoAP layers.
+static void SendAddressNotification(const Ip6::Address &aEid, uint16_t aRloc16)
+{
+    Message *message;
+    Ip6::MessageInfo messageInfo;
+    Ip6::UdpHeader udpHeader;
+    Coap::Header header;
+    ThreadTargetTlv targetTlv;
+    ThreadMeshLocalEidTlv mlIidTlv;
+    ThreadRloc16Tlv rloc16Tlv;
+    Ip6::Address peer;
+    uint16_t checksum;
+
+    header.Init(kCoapTypeConfirmable, kCoapRequestPost);
+    header.SetMessageId(aRloc16);
+    header.SetToken(Coap::Header::kDefaultTokenLength);
+    header.AppendUriPathOptions(OPENTHREAD_URI_ADDRESS_NOTIFY);
+    header.SetPayloadMarker();
+
+    targetTlv.Init();
+    targetTlv.SetTarget(aEid);
+    mlIidTlv.Init();
+    mlIidTlv.SetIid(aEid.mFields.m8 + Ip6::Address::kInterfaceIdentifierSize);
+    rloc16Tlv.Init();
+    rloc16Tlv.SetRloc16(aRloc16);
+
+    peer = sThreadNetif.GetMle().GetMeshLocal16();
+    peer.mFields.m16[7] = HostSwap16(aRloc16);
+
+    messageInfo.SetPeerAddr(peer);
+    messageInfo.SetSockAddr(sThreadNetif.GetMle().GetMeshLocal16());
+    messageInfo.SetInterfaceId(sThreadNetif.GetInterfaceId());
+
+    udpHeader.SetSourcePort(kCoapUdpPort);
+    udpHeader.SetDestinationPort(kCoapUdpPort);
+    udpHeader.SetLength(static_cast<uint16_t>(sizeof(udpHeader) + header.GetLength() + sizeof(targetTlv) +
+                                              sizeof(mlIidTlv) + sizeof(rloc16Tlv)));
+    udpHeader.SetChecksum(0);
+
+    VerifyOrQuit((message = sIp6.mMessagePool.New(Message::kTypeIp6, 0)) != NULL,
+                 "SendAddressNotification: out of messages\n");
+    SuccessOrQuit(message->Append(&udpHeader, sizeof(udpHeader)), "SendAddressNotification: append failed\n");
+    SuccessOrQuit(message->Append(header.GetBytes(), header.GetLength()), "SendAddressNotification: append failed\n");
+    SuccessOrQuit(message->Append(&targetTlv, sizeof(targetTlv)), "SendAddressNotification: append failed\n");
+    SuccessOrQuit(message->Append(&mlIidTlv, sizeof(mlIidTlv)), "SendAddressNotification: append failed\n");
+    SuccessOrQuit(message->Append(&rloc16Tlv, sizeof(rloc16Tlv)), "SendAddressNotification: append failed\n");
+
+    checksum = Ip6::Ip6::ComputePseudoheaderChecksum(messageInfo.GetPeerAddr(), messageInfo.GetSockAddr(),
+                                                     message->GetLength(), Ip6::kProtoUdp);
+    SuccessOrQuit(sIp6.mUdp.UpdateChecksum(*message, checksum), "SendAddressNotification: checksum failed\n");
+
+    SuccessOrQuit(sIp6.mUdp.HandleMessage(*message, messageInfo), "SendAddressNotification: UDP rejected\n");
+    message->Free();
+}
+
+// Frees the Address Queries and acknowledgments queued for transmission so the message pool does not run dry.
+static void FlushMessages(void)
+{
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+    sThreadNetif.GetMeshForwarder().Stop();
+    sThreadNetif.GetMeshForwarder().Start();
+}
+
+// Resolves @p aEid and, when it was not cached, answers the query so that it is cached afterwards.
+static void AddEntry(AddressResolver &aResolver, const Ip6::Address &aEid, uint16_t aRloc16)
+{
+    Mac::ShortAddress rloc16;
+
+    VerifyOrQuit(aResolver.Resolve(aEid, rloc16) == kThreadError_AddressQuery,
+                 "AddEntry: Resolve() did not start an Address Query\n");
+    SendAddressNotification(aEid, aRloc16);
+    VerifyOrQuit(IsCached(aResolver, aEid), "AddEntry: Address Notification was not cached\n");
+    FlushMessages();
+}
+
+static void ResetResolver(AddressResolver &aResolver)
+{
+    otEidCacheCounters counters;
+
+    sThreadNetif.Up();
+    aResolver.Clear();
+    SuccessOrQuit(aResolver.GetCounters(counters), "GetCounters() failed\n");
+    VerifyOrQuit(counters.mHits == 0 && counters.mMisses == 0 && counters.mEvictions == 0,
+                 "Clear() did not reset the counters\n");
+}
+
+void TestAddressResolverHitMiss(void)
+{
+    AddressResolver &resolver = sThreadNetif.GetAddressResolver();
+    otEidCacheCounters counters;
+    Ip6::Address eid;
+    Mac::ShortAddress rloc16;
+    bool valid = true;
+
+    ResetResolver(resolver);
+    MakeEid(1, eid);
+
+    // A miss starts a query, repeated lookups while the query is pending are misses too.
+    VerifyOrQuit(resolver.Resolve(eid, rloc16) == kThreadError_AddressQuery,
+                 "TestAddressResolverHitMiss: Resolve() did not start an Address Query\n");
+    VerifyOrQuit(FindEntry(resolver, eid, valid) != kNoEntry && !valid,
+                 "TestAddressResolverHitMiss: query entry missing or valid\n");
+    VerifyOrQuit(resolver.Resolve(eid, rloc16) == kThreadError_AddressQuery,
+                 "TestAddressResolverHitMiss: pending query was not reported\n");
+
+    SendAddressNotification(eid, GetRloc16(kRouterId, 1));
+    VerifyOrQuit(IsCached(resolver, eid), "TestAddressResolverHitMiss: notification was not cached\n");
+
+    rloc16 = Mac::kShortAddrInvalid;
+    SuccessOrQuit(resolver.Resolve(eid, rloc16), "TestAddressResolverHitMiss: Resolve() missed a cached EID\n");
+    VerifyOrQuit(rloc16 == GetRloc16(kRouterId, 1), "TestAddressResolverHitMiss: wrong RLOC16\n");
+
+    SuccessOrQuit(resolver.GetCounters(counters), "TestAddressResolverHitMiss: GetCounters() failed\n");
+    VerifyOrQuit(counters.mHits == 1, "TestAddressResolverHitMiss: wrong hit count\n");
+    VerifyOrQuit(counters.mMisses == 2, "TestAddressResolverHitMiss: wrong miss count\n");
+    VerifyOrQuit(counters.mEvictions == 0, "TestAddressResolverHitMiss: wrong eviction count\n");
+
+    // Notifications for EIDs that were never queried are ignored.
+    MakeEid(2, eid);
+    SendAddressNotification(eid, GetRloc16(kRouterId, 2));
+    VerifyOrQuit(!IsCached(resolver, eid), "TestAddressResolverHitMiss: unsolicited notification was cached\n");
+}
+
+void TestAddressResolverEviction(void)
+{
+    AddressResolver &resolver = sThreadNetif.GetAddressResolver();
+    uint8_t size = GetCacheSize(resolver);
+    otEidCacheCounters counters;
+    Ip6::Address eid;
+    Mac::ShortAddress rloc16;
+
+    ResetResolver(resolver);
+    VerifyOrQuit(size >= 3, "TestAddressResolverEviction: cache too small\n");
+
+    // Fill the cache, entry 0 is the least recently used afterwards.
+    for (uint16_t i = 0; i < size; i++)
+    {
+        MakeEid(i, eid);
+        AddEntry(resolver, eid, GetRloc16(kRouterId, i));
+    }
+
+    // Touching entry 0 makes entry 1 the least recently used.
+    MakeEid(0, eid);
+    SuccessOrQuit(resolver.Resolve(eid, rloc16), "TestAddressResolverEviction: Resolve() missed entry 0\n");
+
+    MakeEid(size, eid);
+    AddEntry(resolver, eid, GetRloc16(kRouterId, size));
+
+    MakeEid(1, eid);
+    VerifyOrQuit(!IsCached(resolver, eid), "TestAddressResolverEviction: LRU entry 1 was not evicted\n");
+    MakeEid(0, eid);
+    VerifyOrQuit(IsCached(resolver, eid), "TestAddressResolverEviction: touched entry 0 was evicted\n");
+
+    SuccessOrQuit(resolver.GetCounters(counters), "TestAddressResolverEviction: GetCounters() failed\n");
+    VerifyOrQuit(counters.mEvictions == 1, "TestAddressResolverEviction: wrong eviction count\n");
+
+    // The next victims follow insertion order.
+    MakeEid(size + 1, eid);
+    AddEntry(resolver, eid, GetRloc16(kRouterId, size + 1));
+    MakeEid(2, eid);
+    VerifyOrQuit(!IsCached(resolver, eid), "TestAddressResolverEviction: LRU entry 2 was not evicted\n");
+
+    // Every remaining entry is still reachable through its hash chain.
+    for (uint16_t i = 0; i < size + 2; i++)
+    {
+        MakeEid(i, eid);
+
+        if (i == 1 || i == 2)
+        {
+            continue;
+        }
+
+        SuccessOrQuit(resolver.Resolve(eid, rloc16), "TestAddressResolverEviction: Resolve() missed an entry\n");
+        VerifyOrQuit(rloc16 == GetRloc16(kRouterId, i), "TestAddressResolverEviction: wrong RLOC16\n");
+    }
+
+    SuccessOrQuit(resolver.GetCounters(counters), "TestAddressResolverEviction: GetCounters() failed\n");
+    VerifyOrQuit(counters.mEvictions == 2, "TestAddressResolverEviction: wrong eviction count\n");
+}
+
+void TestAddressResolverInvalidation(void)
+{
+    AddressResolver &resolver = sThreadNetif.GetAddressResolver();
+    uint8_t size = GetCacheSize(resolver);
+    otEidCacheCounters counters;
+    Ip6::Address eid;
+    Mac::ShortAddress rloc16;
+
+    ResetResolver(resolver);
+
+    // Odd entries go through kOtherRouterId.
+    for (uint16_t i = 0; i < size; i++)
+    {
+        MakeEid(i, eid);
+        AddEntry(resolver, eid, GetRloc16((i & 1) ? kOtherRouterId : kRouterId, i));
+    }
+
+    resolver.Remove(kOtherRouterId);
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        MakeEid(i, eid);
+        VerifyOrQuit(IsCached(resolver, eid) == ((i & 1) == 0),
+                     "TestAddressResolverInvalidation: Remove() invalidated the wrong entries\n");
+    }
+
+    // Invalidated entries are reused before any valid entry is evicted.
+    for (uint16_t i = 0; i < size / 2; i++)
+    {
+        MakeEid(size + i, eid);
+        AddEntry(resolver, eid, GetRloc16(kRouterId, size + i));
+    }
+
+    SuccessOrQuit(resolver.GetCounters(counters), "TestAddressResolverInvalidation: GetCounters() failed\n");
+    VerifyOrQuit(counters.mEvictions == 0, "TestAddressResolverInvalidation: valid entry evicted\n");
+
+    for (uint16_t i = 0; i < size; i += 2)
+    {
+        MakeEid(i, eid);
+        SuccessOrQuit(resolver.Resolve(eid, rloc16), "TestAddressResolverInvalidation: lost a valid entry\n");
+    }
+
+    // An invalidated EID misses and queries again.
+    MakeEid(1, eid);
+    VerifyOrQuit(resolver.Resolve(eid, rloc16) != kThreadError_None,
+                 "TestAddressResolverInvalidation: invalidated EID still resolves\n");
+
+    resolver.Clear();
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        MakeEid(i, eid);
+        VerifyOrQuit(!IsCached(resolver, eid), "TestAddressResolverInvalidation: Clear() kept an entry\n");
+    }
+}
+
+}  // namespace Thread
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    Thread::TestAddressResolverHitMiss();
+    Thread::TestAddressResolverEviction();
+    Thread::TestAddressResolverInvalidation();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
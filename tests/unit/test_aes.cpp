@@ -28,10 +28,14 @@
 
 #include "test_util.h"
 #include "openthread/openthread.h"
+#include <openthread-instance.h>
 #include <common/debug.hpp>
+#include <common/message.hpp>
 #include <crypto/aes_ccm.hpp>
+#include <crypto/hmac_sha256.hpp>
 #include <crypto/mbedtls.hpp>
 #include <string.h>
+#include <time.h>
 
 #ifndef OPENTHREAD_MULTIPLE_INSTANCE
 static Thread::Crypto::MbedTls mbedtls;
@@ -231,12 +235,319 @@ void TestMacCommandFrame()
                  "TestMacCommandFrame decrypt failed\n");
 }
 
+/**
+ * Secure one MAC data frame, either with a freshly expanded key or with a cached key schedule.
+ */
+static void SecureFrame(Thread::Crypto::AesCcm &aAesCcm, uint8_t *aFrame, const uint8_t *aNonce)
+{
+    const uint32_t kHeaderLength = 23;
+    const uint32_t kPayloadLength = 80;
+    uint8_t tagLength = 4;
+
+    aAesCcm.Init(kHeaderLength, kPayloadLength, tagLength, aNonce, 13);
+    aAesCcm.Header(aFrame, kHeaderLength);
+    aAesCcm.Payload(aFrame + kHeaderLength, aFrame + kHeaderLength, kPayloadLength, true);
+    aAesCcm.Finalize(aFrame + kHeaderLength + kPayloadLength, &tagLength);
+}
+
+/**
+ * Verifies that a cached key schedule produces the same output as a per-frame key expansion, and reports the
+ * per-frame cost of both along with the cost of deriving a key sequence's keys for every frame.
+ */
+void TestAesCcmKeyContextPerformance(void)
+{
+    const uint32_t kNumFrames = 20000;
+    const uint8_t kThreadString[] = {'T', 'h', 'r', 'e', 'a', 'd'};
+    uint8_t masterKey[16];
+    uint8_t keySequence[4] = {0, 0, 0, 1};
+    uint8_t derivedKey[Thread::Crypto::HmacSha256::kHashSize];
+    uint8_t nonce[13];
+    uint8_t frame1[127];
+    uint8_t frame2[127];
+    Thread::Crypto::AesEcb keyContext;
+    clock_t start;
+    double derive;
+    double expand;
+    double cached;
+
+    for (unsigned i = 0; i < sizeof(masterKey); i++)
+    {
+        masterKey[i] = static_cast<uint8_t>(i);
+    }
+
+    memset(nonce, 0x5a, sizeof(nonce));
+    memset(frame1, 0xa5, sizeof(frame1));
+    memset(frame2, 0xa5, sizeof(frame2));
+    keyContext.SetKey(masterKey, 128);
+
+    {
+        Thread::Crypto::AesCcm aesCcm;
+        aesCcm.SetKey(masterKey, sizeof(masterKey));
+        SecureFrame(aesCcm, frame1, nonce);
+    }
+
+    {
+        Thread::Crypto::AesCcm aesCcm;
+        aesCcm.SetKey(keyContext);
+        SecureFrame(aesCcm, frame2, nonce);
+    }
+
+    VerifyOrQuit(memcmp(frame1, frame2, sizeof(frame1)) == 0, "TestAesCcmKeyContextPerformance failed\n");
+
+    // Key derivation and expansion for every frame, as for frames using a previous or next key sequence.
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        Thread::Crypto::HmacSha256 hmac;
+        Thread::Crypto::AesCcm aesCcm;
+
+        hmac.Start(masterKey, sizeof(masterKey));
+        hmac.Update(keySequence, sizeof(keySequence));
+        hmac.Update(kThreadString, sizeof(kThreadString));
+        hmac.Finish(derivedKey);
+
+        aesCcm.SetKey(derivedKey + 16, 16);
+        SecureFrame(aesCcm, frame1, nonce);
+    }
+
+    derive = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    // Key expansion for every frame, as for frames using the current key sequence.
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        Thread::Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(masterKey, sizeof(masterKey));
+        SecureFrame(aesCcm, frame1, nonce);
+    }
+
+    expand = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    // Cached key schedule.
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        Thread::Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(keyContext);
+        SecureFrame(aesCcm, frame2, nonce);
+    }
+
+    cached = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("TestAesCcmKeyContextPerformance: derive+expand %.0f ns/frame, expand %.0f ns/frame, "
+           "cached %.0f ns/frame\n", derive * 1e9 / kNumFrames, expand * 1e9 / kNumFrames,
+           cached * 1e9 / kNumFrames);
+}
+
+/**
+ * Verifies that feeding the payload in arbitrary pieces gives the same output as feeding it at once.
+ */
+void TestAesCcmStreaming(void)
+{
+    const uint8_t kChunks[] = {1, 15, 16, 17, 32, 5, 48, 3};
+    uint8_t key[16];
+    uint8_t nonce[13];
+    uint8_t header[53];
+    uint8_t plaintext[200];
+    uint8_t whole[sizeof(plaintext)];
+    uint8_t chunked[sizeof(plaintext)];
+    uint8_t wholeTag[16];
+    uint8_t chunkedTag[16];
+    uint8_t tagLength;
+
+    for (unsigned i = 0; i < sizeof(key); i++)
+    {
+        key[i] = static_cast<uint8_t>(0xc0 + i);
+    }
+
+    for (unsigned i = 0; i < sizeof(plaintext); i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    memset(nonce, 0x42, sizeof(nonce));
+
+    for (unsigned i = 0; i < sizeof(header); i++)
+    {
+        header[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+
+    for (uint32_t length = 0; length <= sizeof(plaintext); length++)
+    {
+        Thread::Crypto::AesCcm aesCcm;
+        uint32_t offset = 0;
+
+        aesCcm.SetKey(key, sizeof(key));
+
+        memcpy(whole, plaintext, length);
+        tagLength = sizeof(wholeTag);
+        aesCcm.Init(sizeof(header), length, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, sizeof(header));
+        aesCcm.Payload(whole, whole, length, true);
+        aesCcm.Finalize(wholeTag, &tagLength);
+
+        tagLength = sizeof(chunkedTag);
+        aesCcm.Init(sizeof(header), length, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, 3);
+        aesCcm.Header(header + 3, 30);
+        aesCcm.Header(header + 33, sizeof(header) - 33);
+
+        for (unsigned i = 0; offset < length; i++)
+        {
+            uint32_t chunk = kChunks[i % sizeof(kChunks)];
+
+            if (chunk > length - offset)
+            {
+                chunk = length - offset;
+            }
+
+            aesCcm.Payload(plaintext + offset, chunked + offset, chunk, true);
+            offset += chunk;
+        }
+
+        aesCcm.Finalize(chunkedTag, &tagLength);
+
+        VerifyOrQuit(memcmp(whole, chunked, length) == 0 && memcmp(wholeTag, chunkedTag, tagLength) == 0,
+                     "TestAesCcmStreaming encrypt failed\n");
+
+        tagLength = sizeof(chunkedTag);
+        aesCcm.Init(sizeof(header), length, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, sizeof(header));
+        aesCcm.Payload(chunked, whole, length, false);
+        aesCcm.Finalize(chunkedTag, &tagLength);
+
+        VerifyOrQuit(memcmp(chunked, plaintext, length) == 0 && memcmp(wholeTag, chunkedTag, tagLength) == 0,
+                     "TestAesCcmStreaming decrypt failed\n");
+    }
+}
+
+/**
+ * Verifies that processing a payload in place across message buffers matches processing a flat buffer.
+ */
+void TestAesCcmMessage(void)
+{
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    Thread::Crypto::AesCcm aesCcm;
+    uint8_t key[16];
+    uint8_t nonce[13];
+    uint8_t header[35];
+    uint8_t plaintext[700];
+    uint8_t flat[sizeof(plaintext)];
+    uint8_t inPlace[sizeof(plaintext)];
+    uint8_t flatTag[4];
+    uint8_t inPlaceTag[4];
+    uint8_t tagLength;
+
+    memset(key, 0x5a, sizeof(key));
+    memset(nonce, 0x24, sizeof(nonce));
+    memset(header, 0x17, sizeof(header));
+
+    for (unsigned i = 0; i < sizeof(plaintext); i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i * 11 + 5);
+    }
+
+    aesCcm.SetKey(key, sizeof(key));
+
+    for (uint16_t offset = 0; offset < 70; offset += 23)
+    {
+        uint16_t length = sizeof(plaintext) - offset;
+
+        VerifyOrQuit((message = messagePool.New(Thread::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+        SuccessOrQuit(message->SetLength(sizeof(plaintext)), "Message::SetLength failed\n");
+        message->Write(0, sizeof(plaintext), plaintext);
+
+        memcpy(flat, plaintext + offset, length);
+        tagLength = sizeof(flatTag);
+        aesCcm.Init(sizeof(header), length, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, sizeof(header));
+        aesCcm.Payload(flat, flat, length, true);
+        aesCcm.Finalize(flatTag, &tagLength);
+
+        tagLength = sizeof(inPlaceTag);
+        aesCcm.Init(sizeof(header), length, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, sizeof(header));
+        aesCcm.Payload(*message, offset, length, true);
+        aesCcm.Finalize(inPlaceTag, &tagLength);
+
+        message->Read(offset, length, inPlace);
+        VerifyOrQuit(memcmp(flat, inPlace, length) == 0 && memcmp(flatTag, inPlaceTag, tagLength) == 0,
+                     "TestAesCcmMessage encrypt failed\n");
+
+        tagLength = sizeof(inPlaceTag);
+        aesCcm.Init(sizeof(header), length, tagLength, nonce, sizeof(nonce));
+        aesCcm.Header(header, sizeof(header));
+        aesCcm.Payload(*message, offset, length, false);
+        aesCcm.Finalize(inPlaceTag, &tagLength);
+
+        message->Read(0, sizeof(plaintext), inPlace);
+        VerifyOrQuit(memcmp(plaintext, inPlace, sizeof(plaintext)) == 0 && memcmp(flatTag, inPlaceTag, tagLength) == 0,
+                     "TestAesCcmMessage decrypt failed\n");
+
+        SuccessOrQuit(message->Free(), "Message::Free failed\n");
+    }
+}
+
+/**
+ * Reports AES-CCM throughput for 802.15.4 frame sized and IPv6 MTU sized payloads.
+ */
+void TestAesCcmThroughput(void)
+{
+    const uint32_t kBytesPerRun = 4 * 1024 * 1024;
+    const uint16_t kLengths[] = {16, 100, 1280};
+    uint8_t key[16];
+    uint8_t nonce[13];
+    uint8_t header[23];
+    uint8_t buffer[1280];
+    uint8_t tag[4];
+    uint8_t tagLength;
+    Thread::Crypto::AesCcm aesCcm;
+
+    memset(key, 0x3c, sizeof(key));
+    memset(nonce, 0x42, sizeof(nonce));
+    memset(header, 0x17, sizeof(header));
+    memset(buffer, 0xa5, sizeof(buffer));
+    aesCcm.SetKey(key, sizeof(key));
+
+    for (unsigned i = 0; i < sizeof(kLengths) / sizeof(kLengths[0]); i++)
+    {
+        uint32_t count = kBytesPerRun / kLengths[i];
+        clock_t start = clock();
+        double elapsed;
+
+        for (uint32_t j = 0; j < count; j++)
+        {
+            tagLength = sizeof(tag);
+            aesCcm.Init(sizeof(header), kLengths[i], tagLength, nonce, sizeof(nonce));
+            aesCcm.Header(header, sizeof(header));
+            aesCcm.Payload(buffer, buffer, kLengths[i], (j & 1) == 0);
+            aesCcm.Finalize(tag, &tagLength);
+        }
+
+        elapsed = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+        printf("TestAesCcmThroughput: %4u byte payloads %.1f MB/s, %.0f ns/message\n", kLengths[i],
+               count * kLengths[i] / elapsed / 1e6, elapsed * 1e9 / count);
+    }
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacDataFrame();
     TestMacCommandFrame();
+    TestAesCcmKeyContextPerformance();
+    TestAesCcmStreaming();
+    TestAesCcmMessage();
+    TestAesCcmThroughput();
     printf("All tests passed\n");
     return 0;
 }
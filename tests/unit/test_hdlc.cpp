@@ -0,0 +1,305 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_util.h"
+#include <common/code_utils.hpp>
+#include <ncp/hdlc.hpp>
+
+namespace Thread {
+
+// This module implements unit-test for the HDLC-lite Encoder and Decoder classes.
+
+enum
+{
+    kTestFrameSize  = 1300,     // Largest frame used by the tests.
+    kTestBufferSize = 2 * kTestFrameSize + 8,
+};
+
+class TestBuffer : public Hdlc::Encoder::BufferWriteIterator
+{
+public:
+    TestBuffer(uint16_t aSize) { Clear(aSize); }
+
+    void Clear(uint16_t aSize) {
+        mWritePointer = mBuffer;
+        mRemainingLength = aSize;
+    }
+
+    void Extend(uint16_t aSize) { mRemainingLength += aSize; }
+
+    uint16_t GetLength(void) const { return static_cast<uint16_t>(mWritePointer - mBuffer); }
+    const uint8_t *GetBuffer(void) const { return mBuffer; }
+
+private:
+    uint8_t mBuffer[kTestBufferSize];
+};
+
+struct DecoderContext
+{
+    uint8_t  mFrame[kTestFrameSize];
+    uint16_t mFrameLength;
+    uint16_t mFrameCount;
+    uint16_t mErrorCount;
+};
+
+static void HandleFrame(void *aContext, uint8_t *aFrame, uint16_t aFrameLength)
+{
+    DecoderContext *context = static_cast<DecoderContext *>(aContext);
+
+    memcpy(context->mFrame, aFrame, aFrameLength);
+    context->mFrameLength = aFrameLength;
+    context->mFrameCount++;
+}
+
+static void HandleError(void *aContext, ThreadError aError, uint8_t *aFrame, uint16_t aFrameLength)
+{
+    (void)aError;
+    (void)aFrame;
+    (void)aFrameLength;
+
+    static_cast<DecoderContext *>(aContext)->mErrorCount++;
+}
+
+static void FillRandom(uint8_t *aBuf, uint16_t aLength)
+{
+    // Use a small alphabet often enough that runs of special bytes are exercised.
+    static const uint8_t kSpecialBytes[] = { 0x7e, 0x7d, 0x11, 0x13, 0xf8, 0x5e, 0x5d };
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aBuf[i] = ((random() & 7) == 0) ? kSpecialBytes[random() % sizeof(kSpecialBytes)] : static_cast<uint8_t>(random());
+    }
+}
+
+static void EncodeBytewise(const uint8_t *aFrame, uint16_t aLength, TestBuffer &aBuffer)
+{
+    Hdlc::Encoder encoder;
+
+    SuccessOrQuit(encoder.Init(aBuffer), "Encoder::Init() failed.");
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        SuccessOrQuit(encoder.Encode(aFrame[i], aBuffer), "Encoder::Encode() failed.");
+    }
+
+    SuccessOrQuit(encoder.Finalize(aBuffer), "Encoder::Finalize() failed.");
+}
+
+void TestHdlcFcs(void)
+{
+    static const uint8_t kCheckString[] = "123456789";
+    TestBuffer buffer(kTestBufferSize);
+    Hdlc::Encoder encoder;
+
+    // The FCS of the standard check string (CRC-16/X-25) is 0x906e, sent least significant byte first.
+    SuccessOrQuit(encoder.Init(buffer), "Encoder::Init() failed.");
+    SuccessOrQuit(encoder.Encode(kCheckString, sizeof(kCheckString) - 1, buffer), "Encoder::Encode() failed.");
+    SuccessOrQuit(encoder.Finalize(buffer), "Encoder::Finalize() failed.");
+
+    VerifyOrQuit(buffer.GetLength() == sizeof(kCheckString) - 1 + 4, "Encoded length is incorrect.");
+    VerifyOrQuit(memcmp(buffer.GetBuffer() + 1, kCheckString, sizeof(kCheckString) - 1) == 0, "Encoded data is incorrect.");
+    VerifyOrQuit(buffer.GetBuffer()[buffer.GetLength() - 3] == 0x6e, "FCS is incorrect.");
+    VerifyOrQuit(buffer.GetBuffer()[buffer.GetLength() - 2] == 0x90, "FCS is incorrect.");
+
+    printf("TestHdlcFcs -- PASS\n");
+}
+
+void TestHdlcEncoder(void)
+{
+    uint8_t frame[kTestFrameSize];
+    TestBuffer reference(kTestBufferSize);
+    TestBuffer buffer(kTestBufferSize);
+    Hdlc::Encoder encoder;
+    uint16_t length;
+    uint16_t encoded;
+
+    for (uint16_t iteration = 0; iteration < 500; iteration++)
+    {
+        length = static_cast<uint16_t>(random() % kTestFrameSize);
+        FillRandom(frame, length);
+
+        reference.Clear(kTestBufferSize);
+        EncodeBytewise(frame, length, reference);
+
+        // Encode the frame in bulk into a small window, growing it whenever the encoder runs out of space.
+        buffer.Clear(1);
+        SuccessOrQuit(encoder.Init(buffer), "Encoder::Init() failed.");
+
+        for (encoded = 0; encoded < length; buffer.Extend(static_cast<uint16_t>(1 + random() % 16)))
+        {
+            encoded += encoder.EncodePartial(frame + encoded, length - encoded, buffer);
+        }
+
+        buffer.Extend(8);
+        SuccessOrQuit(encoder.Finalize(buffer), "Encoder::Finalize() failed.");
+
+        VerifyOrQuit(buffer.GetLength() == reference.GetLength(), "EncodePartial() length differs from Encode().");
+        VerifyOrQuit(memcmp(buffer.GetBuffer(), reference.GetBuffer(), reference.GetLength()) == 0,
+                     "EncodePartial() output differs from Encode().");
+    }
+
+    // A buffer encode that does not fit must leave the output untouched.
+    memset(frame, 0x7e, sizeof(frame));
+    buffer.Clear(10);
+    SuccessOrQuit(encoder.Init(buffer), "Encoder::Init() failed.");
+    VerifyOrQuit(encoder.Encode(frame, 5, buffer) == kThreadError_NoBufs, "Encode() did not fail.");
+    VerifyOrQuit(buffer.GetLength() == 1, "Encode() wrote a partial buffer.");
+    SuccessOrQuit(encoder.Encode(frame, 4, buffer), "Encode() failed.");
+    VerifyOrQuit(buffer.GetLength() == 9, "Encode() length is incorrect.");
+
+    printf("TestHdlcEncoder -- PASS\n");
+}
+
+void TestHdlcDecoder(void)
+{
+    uint8_t frame[kTestFrameSize];
+    uint8_t decodeBuffer[kTestFrameSize + 2];
+    TestBuffer buffer(kTestBufferSize);
+    DecoderContext context;
+    uint16_t length;
+    uint16_t offset;
+    uint16_t chunk;
+
+    memset(&context, 0, sizeof(context));
+
+    Hdlc::Decoder decoder(decodeBuffer, sizeof(decodeBuffer), HandleFrame, HandleError, &context);
+
+    for (uint16_t iteration = 0; iteration < 500; iteration++)
+    {
+        length = static_cast<uint16_t>(random() % kTestFrameSize);
+        FillRandom(frame, length);
+
+        buffer.Clear(kTestBufferSize);
+        EncodeBytewise(frame, length, buffer);
+
+        // Feed the encoded frame to the decoder in chunks of random size, including single bytes.
+        for (offset = 0; offset < buffer.GetLength(); offset += chunk)
+        {
+            chunk = static_cast<uint16_t>(1 + random() % 64);
+
+            if (chunk > buffer.GetLength() - offset)
+            {
+                chunk = buffer.GetLength() - offset;
+            }
+
+            decoder.Decode(buffer.GetBuffer() + offset, chunk);
+        }
+
+        VerifyOrQuit(context.mErrorCount == 0, "Decoder reported an error.");
+        VerifyOrQuit(context.mFrameCount == iteration + 1, "Decoder did not report the frame.");
+        VerifyOrQuit(context.mFrameLength == length, "Decoded frame length is incorrect.");
+        VerifyOrQuit(memcmp(context.mFrame, frame, length) == 0, "Decoded frame is incorrect.");
+    }
+
+    // A corrupted frame must be reported as an error.
+    buffer.Clear(kTestBufferSize);
+    EncodeBytewise(frame, 100, buffer);
+    const_cast<uint8_t *>(buffer.GetBuffer())[50] ^= 0x01;
+    decoder.Decode(buffer.GetBuffer(), buffer.GetLength());
+    VerifyOrQuit(context.mErrorCount == 1, "Decoder did not report the corrupted frame.");
+
+    printf("TestHdlcDecoder -- PASS\n");
+}
+
+void TestHdlcPerformance(void)
+{
+    const uint32_t kIterations = 20000;
+    uint8_t frame[kTestFrameSize];
+    uint8_t decodeBuffer[kTestFrameSize + 2];
+    TestBuffer buffer(kTestBufferSize);
+    DecoderContext context;
+    Hdlc::Encoder encoder;
+    clock_t start;
+    double bytewise;
+    double bulk;
+    double decode;
+
+    memset(&context, 0, sizeof(context));
+
+    Hdlc::Decoder decoder(decodeBuffer, sizeof(decodeBuffer), HandleFrame, HandleError, &context);
+
+    // Typical frame payload: random data, so about one byte in fifty needs escaping.
+    for (uint16_t i = 0; i < sizeof(frame); i++)
+    {
+        frame[i] = static_cast<uint8_t>(random());
+    }
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        buffer.Clear(kTestBufferSize);
+        EncodeBytewise(frame, sizeof(frame), buffer);
+    }
+
+    bytewise = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        buffer.Clear(kTestBufferSize);
+        SuccessOrQuit(encoder.Init(buffer), "Encoder::Init() failed.");
+        SuccessOrQuit(encoder.Encode(frame, sizeof(frame), buffer), "Encoder::Encode() failed.");
+        SuccessOrQuit(encoder.Finalize(buffer), "Encoder::Finalize() failed.");
+    }
+
+    bulk = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        decoder.Decode(buffer.GetBuffer(), buffer.GetLength());
+    }
+
+    decode = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    VerifyOrQuit(context.mFrameCount == kIterations && context.mErrorCount == 0, "Decoder failed.");
+
+    printf("TestHdlcPerformance: %u-byte frame encode bytewise %.0f MB/s, bulk %.0f MB/s, decode %.0f MB/s\n",
+           static_cast<unsigned>(sizeof(frame)), sizeof(frame) * kIterations / bytewise / 1e6,
+           sizeof(frame) * kIterations / bulk / 1e6, sizeof(frame) * kIterations / decode / 1e6);
+}
+
+}  // namespace Thread
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    Thread::TestHdlcFcs();
+    Thread::TestHdlcEncoder();
+    Thread::TestHdlcDecoder();
+    Thread::TestHdlcPerformance();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
+#endif
@@ -31,6 +31,7 @@
 #include <common/debug.hpp>
 #include <mac/mac_frame.hpp>
 #include <string.h>
+#include <time.h>
 
 namespace Thread {
 
@@ -82,12 +83,155 @@ void TestMacHeader(void)
     }
 }
 
+/**
+ * Build a secured data frame and return its PSDU length.
+ */
+static uint8_t BuildSecuredDataFrame(Mac::Frame &aFrame)
+{
+    aFrame.InitMacHeader(Mac::Frame::kFcfFrameData | Mac::Frame::kFcfPanidCompression |
+                         Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrShort |
+                         Mac::Frame::kFcfSrcAddrExt | Mac::Frame::kFcfAckRequest |
+                         Mac::Frame::kFcfSecurityEnabled, Mac::Frame::kKeyIdMode1 | Mac::Frame::kSecEncMic32);
+    aFrame.SetSequence(0x5a);
+    aFrame.SetDstPanId(0xface);
+    aFrame.SetDstAddr(static_cast<Mac::ShortAddress>(0x1234));
+    aFrame.SetFrameCounter(0x01020304);
+    aFrame.SetKeyId(7);
+    aFrame.SetPayloadLength(60);
+
+    return aFrame.GetPsduLength();
+}
+
+/**
+ * Verify that the frame layout computed by ValidatePsdu() matches the one computed by InitMacHeader().
+ */
+void TestMacFrameLayout(void)
+{
+    uint8_t txPsdu[Mac::Frame::kMTU];
+    uint8_t rxPsdu[Mac::Frame::kMTU];
+    Mac::Frame txFrame;
+    Mac::Frame rxFrame;
+    Mac::ExtAddress extAddress;
+    Mac::Address address;
+    Mac::PanId panId;
+    uint32_t frameCounter;
+    uint8_t keyId;
+
+    for (unsigned i = 0; i < sizeof(extAddress.m8); i++)
+    {
+        extAddress.m8[i] = static_cast<uint8_t>(i + 1);
+    }
+
+    txFrame.mPsdu = txPsdu;
+    BuildSecuredDataFrame(txFrame);
+    txFrame.SetSrcAddr(extAddress);
+
+    memcpy(rxPsdu, txPsdu, txFrame.GetPsduLength());
+    memset(&rxFrame, 0, sizeof(rxFrame));
+    rxFrame.mPsdu = rxPsdu;
+    rxFrame.SetPsduLength(txFrame.GetPsduLength());
+
+    VerifyOrQuit(rxFrame.ValidatePsdu() == kThreadError_None, "MacFrameLayout ValidatePsdu failed\n");
+    VerifyOrQuit(rxFrame.GetHeaderLength() == txFrame.GetHeaderLength() &&
+                 rxFrame.GetFooterLength() == txFrame.GetFooterLength() &&
+                 rxFrame.GetPayloadLength() == 60,
+                 "MacFrameLayout length test failed\n");
+
+    VerifyOrQuit(rxFrame.GetDstPanId(panId) == kThreadError_None && panId == 0xface,
+                 "MacFrameLayout dst PAN ID test failed\n");
+    VerifyOrQuit(rxFrame.GetSrcPanId(panId) == kThreadError_None && panId == 0xface,
+                 "MacFrameLayout src PAN ID test failed\n");
+    VerifyOrQuit(rxFrame.GetDstAddr(address) == kThreadError_None &&
+                 address.mLength == sizeof(Mac::ShortAddress) && address.mShortAddress == 0x1234,
+                 "MacFrameLayout dst address test failed\n");
+    VerifyOrQuit(rxFrame.GetSrcAddr(address) == kThreadError_None &&
+                 address.mLength == sizeof(Mac::ExtAddress) &&
+                 memcmp(&address.mExtAddress, &extAddress, sizeof(extAddress)) == 0,
+                 "MacFrameLayout src address test failed\n");
+    VerifyOrQuit(rxFrame.GetFrameCounter(frameCounter) == kThreadError_None && frameCounter == 0x01020304,
+                 "MacFrameLayout frame counter test failed\n");
+    VerifyOrQuit(rxFrame.GetKeyId(keyId) == kThreadError_None && keyId == 7,
+                 "MacFrameLayout key id test failed\n");
+
+    // A PSDU shorter than its header and footer must be rejected.
+    rxFrame.SetPsduLength(txFrame.GetHeaderLength() + txFrame.GetFooterLength() - 1);
+    VerifyOrQuit(rxFrame.ValidatePsdu() == kThreadError_Parse, "MacFrameLayout short frame test failed\n");
+}
+
+/**
+ * Read the header fields that the MAC layer examines for each received frame.
+ */
+static uint32_t ReadReceivedFrameFields(Mac::Frame &aFrame)
+{
+    Mac::Address srcAddr;
+    Mac::Address dstAddr;
+    Mac::PanId panId;
+    uint32_t frameCounter;
+    uint8_t securityLevel;
+    uint8_t keyIdMode;
+    uint8_t keyId;
+
+    aFrame.GetSrcAddr(srcAddr);
+    aFrame.GetDstAddr(dstAddr);
+    aFrame.GetDstPanId(panId);
+    aFrame.GetSecurityLevel(securityLevel);
+    aFrame.GetKeyIdMode(keyIdMode);
+    aFrame.GetFrameCounter(frameCounter);
+    aFrame.GetKeyId(keyId);
+
+    return frameCounter + dstAddr.mShortAddress + panId + securityLevel + keyIdMode + keyId +
+           aFrame.GetHeaderLength() + aFrame.GetFooterLength() + aFrame.GetPayloadLength() +
+           aFrame.GetPayload()[0];
+}
+
+/**
+ * Report the per-frame cost of validating a received frame and reading its header fields.
+ */
+void TestMacFrameParsePerformance(void)
+{
+    const uint32_t kNumFrames = 200000;
+    uint8_t psdu[Mac::Frame::kMTU];
+    Mac::Frame frame;
+    volatile uint32_t sink = 0;
+    clock_t start;
+    double validate;
+    double accessors;
+
+    memset(psdu, 0, sizeof(psdu));
+    frame.mPsdu = psdu;
+    BuildSecuredDataFrame(frame);
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        VerifyOrQuit(frame.ValidatePsdu() == kThreadError_None, "MacFrameParsePerformance failed\n");
+    }
+
+    validate = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        sink += ReadReceivedFrameFields(frame);
+    }
+
+    accessors = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("TestMacFrameParsePerformance: ValidatePsdu %.1f ns/frame, header field reads %.1f ns/frame\n",
+           validate * 1e9 / kNumFrames, accessors * 1e9 / kNumFrames);
+
+    (void)sink;
+}
+
 }  // namespace Thread
 
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     Thread::TestMacHeader();
+    Thread::TestMacFrameLayout();
+    Thread::TestMacFrameParsePerformance();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,1041 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+#include <common/encoding.hpp>
+#include <common/settings.hpp>
+#include <crypto/aes_ccm.hpp>
+#include <mac/mac.hpp>
+#include <mac/mac_frame.hpp>
+#include <net/ip6.hpp>
+#include <thread/lowpan.hpp>
+#include <thread/mesh_forwarder.hpp>
+#include <thread/key_manager.hpp>
+#include <thread/mle_constants.hpp>
+#include <thread/thread_netif.hpp>
+
+#include <string.h>
+
+using Thread::Encoding::BigEndian::HostSwap16;
+
+namespace Thread {
+
+static RadioPacket sTxPacket;
+static uint8_t sTxPsdu[kMaxPHYPacketSize];
+static bool sTxPending;
+
+static RadioPacket *GetTransmitBuffer(otInstance *)
+{
+    return &sTxPacket;
+}
+
+static Ip6::Ip6 sIp6;
+static ThreadNetif sThreadNetif(sIp6);
+
+enum
+{
+    kPanId          = 0xface,
+    kIp6HeaderSize  = 40,
+    kMaxDatagrams   = 4,
+    kOtherUdpPort   = 0x1234,
+    kNonceSize      = 13,
+    kNeighborRss    = -40,
+    kMeshHopsLeft   = 4,
+    kLeaderId       = 1,
+    kSenderId       = 2,
+    kViaId          = 3,
+    kOtherViaId     = 4,
+    kDestId         = 5,
+    kChildId        = 1,
+    kOtherChildId   = 2,
+    kChildTimeout   = 240,
+};
+
+static uint32_t sNow;
+static Message *sDatagrams[kMaxDatagrams];
+static uint8_t sNumDatagrams;
+static otReassemblyCounters sBaseline;
+
+static uint32_t GetNow(void)
+{
+    return sNow;
+}
+
+static void HandleDatagram(otMessage *aMessage, void *)
+{
+    Message *message = static_cast<Message *>(aMessage);
+
+    if (sNumDatagrams < kMaxDatagrams)
+    {
+        sDatagrams[sNumDatagrams++] = message;
+    }
+    else
+    {
+        message->Free();
+    }
+}
+
+static void FreeDatagrams(void)
+{
+    for (uint8_t i = 0; i < sNumDatagrams; i++)
+    {
+        sDatagrams[i]->Free();
+    }
+
+    sNumDatagrams = 0;
+}
+
+static void SetExtAddress(Mac::ExtAddress &aAddress, uint8_t aValue)
+{
+    memset(&aAddress, aValue, sizeof(aAddress));
+}
+
+static uint16_t GetRloc16(uint8_t aRouterId)
+{
+    return static_cast<uint16_t>(aRouterId << 10);
+}
+
+// Fills @p aDatagram with the IPv6 payload of a datagram of @p aSize octets, the IPv6 header itself is elided.
+static void BuildDatagram(uint8_t *aDatagram, uint16_t aSize, uint8_t aSeed, uint16_t aDstPort)
+{
+    Ip6::UdpHeader udpHeader;
+
+    memset(aDatagram, 0, kIp6HeaderSize);
+
+    udpHeader.SetSourcePort(kOtherUdpPort);
+    udpHeader.SetDestinationPort(aDstPort);
+    udpHeader.SetLength(aSize - kIp6HeaderSize);
+    udpHeader.SetChecksum(0);
+    memcpy(aDatagram + kIp6HeaderSize, &udpHeader, sizeof(udpHeader));
+
+    for (uint16_t i = kIp6HeaderSize + sizeof(udpHeader); i < aSize; i++)
+    {
+        aDatagram[i] = static_cast<uint8_t>(aSeed + i);
+    }
+}
+
+// Writes the 6LoWPAN fragment carrying the octets [@p aOffset, @p aEnd) of a datagram and returns its length.
+static uint8_t BuildFragment(uint8_t *aFrame, uint16_t aTag, uint16_t aSize, uint16_t aOffset, uint16_t aEnd,
+                             uint8_t aSeed, uint16_t aDstPort)
+{
+    // IPHC: traffic class, flow label and hop limit elided, next header inline, addresses derived from the MAC.
+    static const uint8_t kIphc[] = { 0x7b, 0x33, Ip6::kProtoUdp };
+    uint8_t datagram[Ip6::Ip6::kMaxDatagramLength + 8];
+    Lowpan::FragmentHeader fragmentHeader;
+    uint8_t *cur = aFrame;
+
+    BuildDatagram(datagram, aSize, aSeed, aDstPort);
+
+    fragmentHeader.Init();
+    fragmentHeader.SetDatagramSize(aSize);
+    fragmentHeader.SetDatagramTag(aTag);
+    fragmentHeader.SetDatagramOffset(aOffset);
+
+    memcpy(cur, &fragmentHeader, fragmentHeader.GetHeaderLength());
+    cur += fragmentHeader.GetHeaderLength();
+
+    if (aOffset == 0)
+    {
+        memcpy(cur, kIphc, sizeof(kIphc));
+        cur += sizeof(kIphc);
+        aOffset = kIp6HeaderSize;
+    }
+
+    memcpy(cur, datagram + aOffset, aEnd - aOffset);
+    cur += aEnd - aOffset;
+
+    return static_cast<uint8_t>(cur - aFrame);
+}
+
+// Delivers the octets [@p aOffset, @p aEnd) of a datagram from @p aSource to the MAC layer as a 6LoWPAN fragment.
+static void ReceiveFragment(const Mac::ExtAddress &aSource, uint16_t aTag, uint16_t aSize, uint16_t aOffset,
+                            uint16_t aEnd, uint8_t aSeed, uint16_t aDstPort = Mle::kUdpPort)
+{
+    uint8_t fragment[Ip6::Ip6::kMaxDatagramLength];
+    uint8_t psdu[Mac::Frame::kMTU];
+    Mac::Frame frame;
+    uint8_t length;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu = psdu;
+    frame.InitMacHeader(Mac::Frame::kFcfFrameData | Mac::Frame::kFcfPanidCompression |
+                        Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrExt |
+                        Mac::Frame::kFcfSrcAddrExt, 0);
+    frame.SetDstPanId(kPanId);
+    frame.SetDstAddr(*sThreadNetif.GetMac().GetExtAddress());
+    frame.SetSrcAddr(aSource);
+
+    length = BuildFragment(fragment, aTag, aSize, aOffset, aEnd, aSeed, aDstPort);
+    VerifyOrQuit(length <= frame.GetMaxPayloadLength(), "ReceiveFragment: fragment does not fit in a frame\n");
+    memcpy(frame.GetPayload(), fragment, length);
+    frame.SetPayloadLength(length);
+
+    sThreadNetif.GetMac().ReceiveDoneTask(&frame, kThreadError_None);
+}
+
+// Checks that the next reassembled datagram carries the payload of a datagram built with @p aSize and @p aSeed.
+static bool VerifyDatagram(uint8_t aIndex, uint16_t aSize, uint8_t aSeed)
+{
+    uint8_t expected[Ip6::Ip6::kMaxDatagramLength];
+    uint8_t actual[Ip6::Ip6::kMaxDatagramLength];
+    Message *message;
+
+    VerifyOrQuit(aIndex < sNumDatagrams, "VerifyDatagram: datagram was not delivered\n");
+    message = sDatagrams[aIndex];
+
+    BuildDatagram(expected, aSize, aSeed, Mle::kUdpPort);
+
+    return message->GetLength() == aSize &&
+           message->Read(kIp6HeaderSize, aSize - kIp6HeaderSize, actual) == aSize - kIp6HeaderSize &&
+           memcmp(actual, expected + kIp6HeaderSize, aSize - kIp6HeaderSize) == 0;
+}
+
+static otReassemblyCounters GetCounters(void)
+{
+    const otReassemblyCounters &counters = sThreadNetif.GetMeshForwarder().GetReassemblyCounters();
+    otReassemblyCounters delta;
+
+    delta.mDatagrams = counters.mDatagrams - sBaseline.mDatagrams;
+    delta.mOutOfOrder = counters.mOutOfOrder - sBaseline.mOutOfOrder;
+    delta.mDuplicates = counters.mDuplicates - sBaseline.mDuplicates;
+    delta.mFailNoBufs = counters.mFailNoBufs - sBaseline.mFailNoBufs;
+    delta.mFailParse = counters.mFailParse - sBaseline.mFailParse;
+    delta.mFailSecurity = counters.mFailSecurity - sBaseline.mFailSecurity;
+    delta.mFailEvicted = counters.mFailEvicted - sBaseline.mFailEvicted;
+    delta.mFailTimeout = counters.mFailTimeout - sBaseline.mFailTimeout;
+
+    return delta;
+}
+
+static uint16_t GetReassemblyQueueLength(void)
+{
+    uint16_t messages;
+    uint16_t buffers;
+
+    sThreadNetif.GetMeshForwarder().GetReassemblyQueue().GetInfo(messages, buffers);
+
+    return messages;
+}
+
+// Brings the interface up with an empty reassembly state and records the counters to compare against.
+static void ResetReassembly(void)
+{
+    g_testPlatAlarmGetNow = GetNow;
+
+    sIp6.SetReceiveDatagramCallback(HandleDatagram, NULL);
+    sIp6.SetReceiveIp6FilterEnabled(false);
+    sThreadNetif.GetMac().SetPanId(kPanId);
+    sThreadNetif.Up();
+
+    sThreadNetif.GetMeshForwarder().Stop();
+    sThreadNetif.GetMeshForwarder().Start();
+    FreeDatagrams();
+
+    sBaseline = sThreadNetif.GetMeshForwarder().GetReassemblyCounters();
+}
+
+void TestReassemblyInOrder(void)
+{
+    Mac::ExtAddress source;
+
+    ResetReassembly();
+    SetExtAddress(source, 0x11);
+
+    ReceiveFragment(source, 1, 256, 0, 96, 0);
+    ReceiveFragment(source, 1, 256, 96, 160, 0);
+    ReceiveFragment(source, 1, 256, 160, 224, 0);
+    VerifyOrQuit(sNumDatagrams == 0, "TestReassemblyInOrder: datagram delivered early\n");
+    VerifyOrQuit(GetReassemblyQueueLength() == 1, "TestReassemblyInOrder: datagram not queued\n");
+    ReceiveFragment(source, 1, 256, 224, 256, 0);
+
+    VerifyOrQuit(sNumDatagrams == 1 && VerifyDatagram(0, 256, 0), "TestReassemblyInOrder: wrong datagram\n");
+    VerifyOrQuit(GetReassemblyQueueLength() == 0, "TestReassemblyInOrder: datagram still queued\n");
+    VerifyOrQuit(GetCounters().mDatagrams == 1 && GetCounters().mOutOfOrder == 0,
+                 "TestReassemblyInOrder: wrong counters\n");
+
+    FreeDatagrams();
+}
+
+void TestReassemblyOutOfOrder(void)
+{
+    Mac::ExtAddress source;
+
+    ResetReassembly();
+    SetExtAddress(source, 0x11);
+
+    // The first fragment arrives last, the fragments received ahead of it are carried over.
+    ReceiveFragment(source, 2, 256, 160, 224, 3);
+    ReceiveFragment(source, 2, 256, 96, 160, 3);
+    ReceiveFragment(source, 2, 256, 224, 256, 3);
+    VerifyOrQuit(sNumDatagrams == 0, "TestReassemblyOutOfOrder: datagram delivered early\n");
+    ReceiveFragment(source, 2, 256, 0, 96, 3);
+
+    VerifyOrQuit(sNumDatagrams == 1 && VerifyDatagram(0, 256, 3), "TestReassemblyOutOfOrder: wrong datagram\n");
+    VerifyOrQuit(GetReassemblyQueueLength() == 0, "TestReassemblyOutOfOrder: datagram still queued\n");
+    VerifyOrQuit(GetCounters().mDatagrams == 1, "TestReassemblyOutOfOrder: wrong datagram count\n");
+    VerifyOrQuit(GetCounters().mOutOfOrder == 2, "TestReassemblyOutOfOrder: wrong out of order count\n");
+
+    FreeDatagrams();
+}
+
+void TestReassemblyDuplicates(void)
+{
+    Mac::ExtAddress source;
+
+    ResetReassembly();
+    SetExtAddress(source, 0x11);
+
+    ReceiveFragment(source, 3, 256, 0, 96, 5);
+    ReceiveFragment(source, 3, 256, 0, 96, 5);
+    VerifyOrQuit(GetCounters().mDuplicates == 1, "TestReassemblyDuplicates: first fragment not detected\n");
+
+    ReceiveFragment(source, 3, 256, 96, 160, 5);
+    ReceiveFragment(source, 3, 256, 96, 160, 5);
+    VerifyOrQuit(GetCounters().mDuplicates == 2, "TestReassemblyDuplicates: exact duplicate not detected\n");
+
+    // A fragment that only covers octets already received is a duplicate too.
+    ReceiveFragment(source, 3, 256, 128, 152, 5);
+    VerifyOrQuit(GetCounters().mDuplicates == 3, "TestReassemblyDuplicates: overlap not detected\n");
+
+    // A fragment that partially overlaps the received octets still contributes the rest.
+    ReceiveFragment(source, 3, 256, 144, 224, 5);
+    VerifyOrQuit(GetCounters().mDuplicates == 3, "TestReassemblyDuplicates: partial overlap dropped\n");
+    VerifyOrQuit(sNumDatagrams == 0, "TestReassemblyDuplicates: datagram delivered early\n");
+
+    ReceiveFragment(source, 3, 256, 224, 256, 5);
+    VerifyOrQuit(sNumDatagrams == 1 && VerifyDatagram(0, 256, 5), "TestReassemblyDuplicates: wrong datagram\n");
+    VerifyOrQuit(GetCounters().mDatagrams == 1, "TestReassemblyDuplicates: wrong datagram count\n");
+
+    FreeDatagrams();
+}
+
+void TestReassemblyPartialBlock(void)
+{
+    Mac::ExtAddress source;
+
+    ResetReassembly();
+    SetExtAddress(source, 0x11);
+
+    // The final block [248, 250) is only partly covered, yet completes the datagram.
+    ReceiveFragment(source, 4, 250, 0, 96, 7);
+    ReceiveFragment(source, 4, 250, 96, 176, 7);
+    ReceiveFragment(source, 4, 250, 176, 248, 7);
+    VerifyOrQuit(sNumDatagrams == 0, "TestReassemblyPartialBlock: datagram delivered early\n");
+    ReceiveFragment(source, 4, 250, 248, 250, 7);
+    VerifyOrQuit(sNumDatagrams == 1 && VerifyDatagram(0, 250, 7), "TestReassemblyPartialBlock: wrong datagram\n");
+    FreeDatagrams();
+
+    // A non-final fragment that does not end on a block boundary is malformed, however short it is.
+    ReceiveFragment(source, 5, 250, 0, 100, 9);
+    ReceiveFragment(source, 5, 250, 0, 96, 9);
+    ReceiveFragment(source, 5, 250, 96, 150, 9);
+    ReceiveFragment(source, 5, 250, 96, 100, 9);
+    VerifyOrQuit(GetCounters().mFailParse == 3, "TestReassemblyPartialBlock: partial block not rejected\n");
+    ReceiveFragment(source, 5, 250, 152, 250, 9);
+    VerifyOrQuit(sNumDatagrams == 0, "TestReassemblyPartialBlock: rejected fragment was marked\n");
+    ReceiveFragment(source, 5, 250, 96, 152, 9);
+    VerifyOrQuit(sNumDatagrams == 1 && VerifyDatagram(0, 250, 9), "TestReassemblyPartialBlock: wrong datagram\n");
+
+    VerifyOrQuit(GetCounters().mDatagrams == 2 && GetCounters().mDuplicates == 0,
+                 "TestReassemblyPartialBlock: wrong counters\n");
+
+    FreeDatagrams();
+}
+
+void TestReassemblySourceCollision(void)
+{
+    Mac::ExtAddress source1;
+    Mac::ExtAddress source2;
+
+    ResetReassembly();
+    SetExtAddress(source1, 0x11);
+    SetExtAddress(source2, 0x22);
+
+    // Two sources that pick the same tag and size are reassembled separately.
+    ReceiveFragment(source1, 6, 256, 0, 96, 11);
+    ReceiveFragment(source2, 6, 256, 96, 160, 13);
+    ReceiveFragment(source2, 6, 256, 0, 96, 13);
+    ReceiveFragment(source1, 6, 256, 96, 160, 11);
+    ReceiveFragment(source1, 6, 256, 160, 256, 11);
+    VerifyOrQuit(GetReassemblyQueueLength() == 1, "TestReassemblySourceCollision: wrong queue length\n");
+    ReceiveFragment(source2, 6, 256, 160, 256, 13);
+
+    VerifyOrQuit(sNumDatagrams == 2, "TestReassemblySourceCollision: datagrams not delivered\n");
+    VerifyOrQuit(VerifyDatagram(0, 256, 11), "TestReassemblySourceCollision: wrong datagram from source 1\n");
+    VerifyOrQuit(VerifyDatagram(1, 256, 13), "TestReassemblySourceCollision: wrong datagram from source 2\n");
+    VerifyOrQuit(GetCounters().mDuplicates == 0, "TestReassemblySourceCollision: fragments mixed up\n");
+
+    FreeDatagrams();
+}
+
+void TestReassemblyTimeout(void)
+{
+    Mac::ExtAddress source;
+
+    ResetReassembly();
+    SetExtAddress(source, 0x11);
+
+    ReceiveFragment(source, 7, 256, 0, 96, 0);
+    VerifyOrQuit(GetReassemblyQueueLength() == 1, "TestReassemblyTimeout: datagram not queued\n");
+
+    for (int i = 0; i < OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT; i++)
+    {
+        sNow += 1000;
+        sIp6.mTimerScheduler.FireTimers();
+    }
+
+    VerifyOrQuit(GetReassemblyQueueLength() == 1, "TestReassemblyTimeout: datagram evicted early\n");
+
+    sNow += 1000;
+    sIp6.mTimerScheduler.FireTimers();
+
+    VerifyOrQuit(GetReassemblyQueueLength() == 0, "TestReassemblyTimeout: datagram not evicted\n");
+    VerifyOrQuit(GetCounters().mFailTimeout == 1, "TestReassemblyTimeout: wrong timeout count\n");
+
+    // Later fragments of the discarded datagram start over rather than complete it.
+    ReceiveFragment(source, 7, 256, 96, 160, 0);
+    VerifyOrQuit(sNumDatagrams == 0 && GetReassemblyQueueLength() == 1,
+                 "TestReassemblyTimeout: discarded datagram completed\n");
+}
+
+void TestReassemblyFailures(void)
+{
+    Mac::ExtAddress source;
+    Message *messages[OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS];
+    int numMessages = 0;
+
+    ResetReassembly();
+    SetExtAddress(source, 0x11);
+
+    // mFailEvicted: a new datagram evicts a partial one once every entry is in use.
+    for (uint16_t tag = 0; tag <= OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES; tag++)
+    {
+        ReceiveFragment(source, 100 + tag, 256, 0, 96, 0);
+    }
+
+    VerifyOrQuit(GetReassemblyQueueLength() == OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_ENTRIES,
+                 "TestReassemblyFailures: wrong queue length\n");
+    VerifyOrQuit(GetCounters().mFailEvicted == 1, "TestReassemblyFailures: wrong eviction count\n");
+
+    // mFailParse: datagrams above the IPv6 MTU and fragments beyond the datagram size.
+    ReceiveFragment(source, 8, Ip6::Ip6::kMaxDatagramLength + 8, 0, 96, 0);
+    VerifyOrQuit(GetCounters().mFailParse == 1, "TestReassemblyFailures: oversized datagram accepted\n");
+    ReceiveFragment(source, 100, 256, 224, 264, 0);
+    VerifyOrQuit(GetCounters().mFailParse == 2, "TestReassemblyFailures: overlong fragment accepted\n");
+
+    // mFailSecurity: without link security only MLE and the unsecure ports are let through.
+    ReceiveFragment(source, 9, 96, 0, 96, 0, kOtherUdpPort);
+    VerifyOrQuit(GetCounters().mFailSecurity == 1, "TestReassemblyFailures: unsecure datagram accepted\n");
+    VerifyOrQuit(sNumDatagrams == 0, "TestReassemblyFailures: unsecure datagram delivered\n");
+
+    // mFailNoBufs: no message can be allocated for a new datagram.
+    sThreadNetif.GetMeshForwarder().Stop();
+    sThreadNetif.GetMeshForwarder().Start();
+
+    while (numMessages < OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS &&
+           (messages[numMessages] = sIp6.mMessagePool.New(Message::kTypeIp6, 0)) != NULL)
+    {
+        numMessages++;
+    }
+
+    ReceiveFragment(source, 10, 256, 0, 96, 0);
+    ReceiveFragment(source, 10, 256, 96, 160, 0);
+    VerifyOrQuit(GetCounters().mFailNoBufs == 2, "TestReassemblyFailures: wrong no buffers count\n");
+
+    for (int i = 0; i < numMessages; i++)
+    {
+        messages[i]->Free();
+    }
+
+    VerifyOrQuit(GetReassemblyQueueLength() == 0, "TestReassemblyFailures: datagram queued without buffers\n");
+    VerifyOrQuit(GetCounters().mDatagrams == 0, "TestReassemblyFailures: datagram delivered\n");
+}
+
+// Makes this device the leader of a partition with three neighboring routers, the route to kDestId goes via kViaId.
+static void ResetRelay(void)
+{
+    Mle::MleRouter &mle = sThreadNetif.GetMle();
+    KeyManager &keyManager = sThreadNetif.GetKeyManager();
+    const uint8_t neighborIds[] = { kSenderId, kViaId, kOtherViaId };
+    Router *router;
+
+    ResetReassembly();
+
+    if (mle.GetDeviceState() != Mle::kDeviceStateLeader)
+    {
+        SuccessOrQuit(mle.Start(false, false), "ResetRelay: Start() failed\n");
+        SuccessOrQuit(mle.SetPreferredRouterId(kLeaderId), "ResetRelay: SetPreferredRouterId() failed\n");
+        SuccessOrQuit(mle.BecomeLeader(), "ResetRelay: BecomeLeader() failed\n");
+    }
+
+    // Let the leader finish sending, the queued messages are flushed below.
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+    sThreadNetif.GetMeshForwarder().Stop();
+    sThreadNetif.GetMeshForwarder().Start();
+
+    VerifyOrQuit(sThreadNetif.GetMac().GetShortAddress() == GetRloc16(kLeaderId), "ResetRelay: wrong RLOC16\n");
+
+    for (uint8_t i = 0; i < sizeof(neighborIds); i++)
+    {
+        router = mle.GetRouter(neighborIds[i]);
+        memset(router, 0, sizeof(*router));
+        SetExtAddress(router->mMacAddr, neighborIds[i]);
+        router->mValid.mRloc16 = GetRloc16(neighborIds[i]);
+        router->mKeySequence = keyManager.GetCurrentKeySequence();
+        router->mState = Neighbor::kStateValid;
+        router->mLinkInfo.AddRss(sThreadNetif.GetMac().GetNoiseFloor(), kNeighborRss);
+        router->mLinkQualityOut = 3;
+        router->mNextHop = neighborIds[i];
+        router->mAllocated = true;
+    }
+
+    router = mle.GetRouter(kDestId);
+    memset(router, 0, sizeof(*router));
+    router->mState = Neighbor::kStateInvalid;
+    router->mNextHop = kViaId;
+    router->mCost = 1;
+    router->mAllocated = true;
+
+    VerifyOrQuit(mle.GetNextHop(GetRloc16(kDestId)) == GetRloc16(kViaId), "ResetRelay: no route to destination\n");
+}
+
+// Secures @p aFrame the way a neighbor with extended address @p aSender would and delivers it to the MAC.
+static void ReceiveSecuredFrame(Mac::Frame &aFrame, const Mac::ExtAddress &aSender)
+{
+    static uint32_t sFrameCounter = 0;
+    KeyManager &keyManager = sThreadNetif.GetKeyManager();
+    uint32_t keySequence = keyManager.GetCurrentKeySequence();
+    Crypto::AesCcm aesCcm;
+    uint8_t nonce[kNonceSize];
+    uint8_t tagLength;
+
+    aFrame.SetFrameCounter(sFrameCounter);
+    aFrame.SetKeyId((keySequence & 0x7f) + 1);
+
+    memcpy(nonce, aSender.m8, sizeof(aSender.m8));
+    nonce[8] = static_cast<uint8_t>(sFrameCounter >> 24);
+    nonce[9] = static_cast<uint8_t>(sFrameCounter >> 16);
+    nonce[10] = static_cast<uint8_t>(sFrameCounter >> 8);
+    nonce[11] = static_cast<uint8_t>(sFrameCounter);
+    nonce[12] = Mac::Frame::kSecEncMic32;
+
+    tagLength = aFrame.GetFooterLength() - Mac::Frame::kFcsSize;
+    aesCcm.SetKey(keyManager.GetMacKeyContext(keySequence));
+    aesCcm.Init(aFrame.GetHeaderLength(), aFrame.GetPayloadLength(), tagLength, nonce, sizeof(nonce));
+    aesCcm.Header(aFrame.GetHeader(), aFrame.GetHeaderLength());
+    aesCcm.Payload(aFrame.GetPayload(), aFrame.GetPayload(), aFrame.GetPayloadLength(), true);
+    aesCcm.Finalize(aFrame.GetFooter(), &tagLength);
+
+    sFrameCounter++;
+    sThreadNetif.GetMac().ReceiveDoneTask(&aFrame, kThreadError_None);
+}
+
+// Delivers a link-secured mesh frame sent by kSenderId towards kDestId that carries a 6LoWPAN fragment.
+static void ReceiveMeshFragment(uint16_t aTag, uint16_t aSize, uint16_t aOffset, uint16_t aEnd)
+{
+    uint8_t fragment[Ip6::Ip6::kMaxDatagramLength];
+    uint8_t psdu[Mac::Frame::kMTU];
+    Mac::Frame frame;
+    Mac::ExtAddress sender;
+    Lowpan::MeshHeader meshHeader;
+    uint8_t length;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu = psdu;
+    frame.mPower = kNeighborRss;
+    frame.InitMacHeader(Mac::Frame::kFcfFrameData | Mac::Frame::kFcfPanidCompression |
+                        Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrShort |
+                        Mac::Frame::kFcfSrcAddrShort | Mac::Frame::kFcfSecurityEnabled,
+                        Mac::Frame::kKeyIdMode1 | Mac::Frame::kSecEncMic32);
+    frame.SetDstPanId(kPanId);
+    frame.SetDstAddr(sThreadNetif.GetMac().GetShortAddress());
+    frame.SetSrcAddr(GetRloc16(kSenderId));
+
+    meshHeader.Init();
+    meshHeader.SetHopsLeft(kMeshHopsLeft);
+    meshHeader.SetSource(GetRloc16(kSenderId));
+    meshHeader.SetDestination(GetRloc16(kDestId));
+    meshHeader.AppendTo(fragment);
+
+    length = meshHeader.GetHeaderLength();
+    length += BuildFragment(fragment + length, aTag, aSize, aOffset, aEnd, 0, Mle::kUdpPort);
+    VerifyOrQuit(length <= frame.GetMaxPayloadLength(), "ReceiveMeshFragment: fragment does not fit in a frame\n");
+    memcpy(frame.GetPayload(), fragment, length);
+    frame.SetPayloadLength(length);
+
+    SetExtAddress(sender, kSenderId);
+    ReceiveSecuredFrame(frame, sender);
+}
+
+// Returns the mesh next hop of the @p aIndex-th message in the relay queue.
+static uint16_t GetRelayNextHop(uint8_t aIndex)
+{
+    Message *message = sThreadNetif.GetMeshForwarder().GetRelayQueue().GetHead();
+
+    for (; message != NULL && aIndex > 0; aIndex--)
+    {
+        message = message->GetNext();
+    }
+
+    return (message != NULL) ? message->GetMeshNextHop() : static_cast<uint16_t>(Mac::kShortAddrInvalid);
+}
+
+static void GetRelayQueueInfo(uint16_t &aMessages, uint16_t &aBuffers)
+{
+    sThreadNetif.GetMeshForwarder().GetRelayQueue().GetInfo(aMessages, aBuffers);
+}
+
+void TestRelayFlow(void)
+{
+    uint16_t freeBuffers;
+    uint16_t messages;
+    uint16_t buffers;
+
+    ResetRelay();
+    freeBuffers = sIp6.mMessagePool.GetFreeBufferCount();
+
+    // The first fragment sets up the flow along the current route.
+    ReceiveMeshFragment(1, 200, 0, 96);
+    VerifyOrQuit(GetRelayNextHop(0) == GetRloc16(kViaId), "TestRelayFlow: first fragment not relayed\n");
+
+    // Later fragments stick to the flow even though the route changed in between.
+    sThreadNetif.GetMle().GetRouter(kDestId)->mNextHop = kOtherViaId;
+    ReceiveMeshFragment(1, 200, 96, 160);
+    ReceiveMeshFragment(1, 200, 160, 200);
+    VerifyOrQuit(GetRelayNextHop(1) == GetRloc16(kViaId) && GetRelayNextHop(2) == GetRloc16(kViaId),
+                 "TestRelayFlow: later fragments left the flow\n");
+
+    // The last fragment released the flow, a straggler and a new datagram follow the new route.
+    ReceiveMeshFragment(1, 200, 96, 160);
+    ReceiveMeshFragment(2, 200, 0, 96);
+    VerifyOrQuit(GetRelayNextHop(3) == GetRloc16(kOtherViaId) && GetRelayNextHop(4) == GetRloc16(kOtherViaId),
+                 "TestRelayFlow: flow not released by the last fragment\n");
+
+    // A fragment of a datagram whose first fragment was never seen needs a route of its own.
+    ReceiveMeshFragment(3, 200, 96, 160);
+    VerifyOrQuit(GetRelayNextHop(5) == GetRloc16(kOtherViaId), "TestRelayFlow: orphan fragment not routed\n");
+
+    GetRelayQueueInfo(messages, buffers);
+    VerifyOrQuit(messages == 6, "TestRelayFlow: wrong m6loRelayMessages\n");
+    VerifyOrQuit(buffers == freeBuffers - sIp6.mMessagePool.GetFreeBufferCount(),
+                 "TestRelayFlow: wrong m6loRelayBuffers\n");
+
+    sThreadNetif.GetMeshForwarder().Stop();
+    GetRelayQueueInfo(messages, buffers);
+    VerifyOrQuit(messages == 0 && buffers == 0, "TestRelayFlow: relay queue not flushed\n");
+    VerifyOrQuit(sIp6.mMessagePool.GetFreeBufferCount() == freeBuffers, "TestRelayFlow: buffers leaked\n");
+    sThreadNetif.GetMeshForwarder().Start();
+}
+
+void TestRelayNextHopLost(void)
+{
+    Mle::MleRouter &mle = sThreadNetif.GetMle();
+    uint16_t freeBuffers;
+    uint16_t messages;
+    uint16_t buffers;
+
+    ResetRelay();
+    freeBuffers = sIp6.mMessagePool.GetFreeBufferCount();
+
+    ReceiveMeshFragment(1, 200, 0, 96);
+    VerifyOrQuit(GetRelayNextHop(0) == GetRloc16(kViaId), "TestRelayNextHopLost: first fragment not relayed\n");
+
+    // Once the flow's next hop is gone, later fragments take the current route.
+    mle.GetRouter(kDestId)->mNextHop = kOtherViaId;
+    mle.GetRouter(kViaId)->mState = Neighbor::kStateInvalid;
+    ReceiveMeshFragment(1, 200, 96, 160);
+    VerifyOrQuit(GetRelayNextHop(1) == GetRloc16(kOtherViaId), "TestRelayNextHopLost: fragment sent to lost hop\n");
+
+    // Without any route, fragments are dropped rather than queued.
+    mle.GetRouter(kOtherViaId)->mState = Neighbor::kStateInvalid;
+    ReceiveMeshFragment(1, 200, 160, 200);
+    GetRelayQueueInfo(messages, buffers);
+    VerifyOrQuit(messages == 2, "TestRelayNextHopLost: unroutable fragment queued\n");
+
+    // Queued messages whose next hop is no longer a neighbor are dropped instead of sent.
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+    GetRelayQueueInfo(messages, buffers);
+    VerifyOrQuit(messages == 0 && buffers == 0, "TestRelayNextHopLost: stale relay messages not dropped\n");
+    VerifyOrQuit(sIp6.mMessagePool.GetFreeBufferCount() == freeBuffers, "TestRelayNextHopLost: buffers leaked\n");
+}
+
+static uint8_t sNumStoredChildren;
+
+static uint16_t GetChildRloc16(uint8_t aChildId = kChildId)
+{
+    return GetRloc16(kLeaderId) | aChildId;
+}
+
+static ThreadError HandleTransmit(otInstance *)
+{
+    sTxPending = true;
+    return kThreadError_None;
+}
+
+// Provides `sNumStoredChildren` stored sleepy children, starting with kChildId, for `MleRouter::RestoreChildren()`.
+static ThreadError GetSettings(otInstance *, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    ThreadError error = kThreadError_None;
+    otChildInfo childInfo;
+
+    VerifyOrExit(aKey == kKeyChildInfo && aIndex >= 0 && aIndex < sNumStoredChildren,
+                 error = kThreadError_NotFound);
+
+    memset(&childInfo, 0, sizeof(childInfo));
+    SetExtAddress(static_cast<Mac::ExtAddress &>(childInfo.mExtAddress), static_cast<uint8_t>(kChildId + aIndex));
+    childInfo.mRloc16 = GetChildRloc16(static_cast<uint8_t>(kChildId + aIndex));
+    childInfo.mTimeout = kChildTimeout;
+    childInfo.mRxOnWhenIdle = false;
+
+    memcpy(aValue, &childInfo, sizeof(childInfo));
+    *aValueLength = sizeof(childInfo);
+
+exit:
+    return error;
+}
+
+// Reports the frame handed to the radio as sent and lets the forwarder schedule the next one.
+static void CompleteTransmission(void)
+{
+    VerifyOrQuit(sTxPending, "CompleteTransmission: no frame to complete\n");
+    sTxPending = false;
+    sThreadNetif.GetMac().TransmitDoneTask(false, kThreadError_None);
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+}
+
+static void CompleteAllTransmissions(void)
+{
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+
+    while (sTxPending)
+    {
+        CompleteTransmission();
+    }
+}
+
+// Adds @p aNumChildren sleepy children to the leader set up by `ResetRelay()` and leaves the MAC idle with empty
+// send queues. Returns the child kChildId.
+static Child &ResetIndirect(uint8_t aNumChildren = 1)
+{
+    uint8_t numChildren;
+    Child *children;
+    Child *child;
+
+    ResetRelay();
+
+    sTxPacket.mPsdu = sTxPsdu;
+    g_testPlatRadioCaps = kRadioCapsCsmaBackOff;
+    g_testPlatRadioGetTransmitBuffer = GetTransmitBuffer;
+    g_testPlatRadioTransmit = HandleTransmit;
+
+    // Let a CSMA backoff started without the capability expire.
+    sNow += 1000;
+    sIp6.mTimerScheduler.FireTimers();
+    CompleteAllTransmissions();
+    sThreadNetif.GetMeshForwarder().Stop();
+    sThreadNetif.GetMeshForwarder().Start();
+
+    children = sThreadNetif.GetMle().GetChildren(&numChildren);
+
+    for (uint8_t i = 0; i < numChildren; i++)
+    {
+        children[i].mState = Neighbor::kStateInvalid;
+    }
+
+    sNumStoredChildren = aNumChildren;
+    g_testPlatSettingsGet = GetSettings;
+    SuccessOrQuit(sThreadNetif.GetMle().RestoreChildren(), "ResetIndirect: RestoreChildren() failed\n");
+    g_testPlatSettingsGet = NULL;
+
+    for (uint8_t i = aNumChildren; i > 0; i--)
+    {
+        child = sThreadNetif.GetMle().GetChild(GetChildRloc16(static_cast<uint8_t>(kChildId + i - 1)));
+        VerifyOrQuit(child != NULL && (child->mMode & Mle::ModeTlv::kModeRxOnWhenIdle) == 0,
+                     "ResetIndirect: sleepy child not restored\n");
+        child->mKeySequence = sThreadNetif.GetKeyManager().GetCurrentKeySequence();
+    }
+
+    return *child;
+}
+
+// Queues a UDP datagram from the leader's link-local RLOC address to @p aDestination.
+static Message *SendDatagram(const Ip6::Address &aDestination, uint8_t aPriority)
+{
+    Message *message;
+    Ip6::Header ip6Header;
+    Ip6::UdpHeader udpHeader;
+
+    VerifyOrQuit((message = sIp6.mMessagePool.New(Message::kTypeIp6, 0, aPriority)) != NULL,
+                 "SendDatagram: New() failed\n");
+
+    ip6Header.Init();
+    ip6Header.SetPayloadLength(sizeof(udpHeader));
+    ip6Header.SetNextHeader(Ip6::kProtoUdp);
+    ip6Header.SetHopLimit(Ip6::Ip6::kDefaultHopLimit);
+    memset(&ip6Header.GetSource(), 0, sizeof(ip6Header.GetSource()));
+    ip6Header.GetSource().mFields.m16[0] = HostSwap16(0xfe80);
+    ip6Header.GetSource().mFields.m16[5] = HostSwap16(0x00ff);
+    ip6Header.GetSource().mFields.m16[6] = HostSwap16(0xfe00);
+    ip6Header.GetSource().mFields.m16[7] = HostSwap16(GetRloc16(kLeaderId));
+    ip6Header.SetDestination(aDestination);
+
+    udpHeader.SetSourcePort(kOtherUdpPort);
+    udpHeader.SetDestinationPort(kOtherUdpPort);
+    udpHeader.SetLength(sizeof(udpHeader));
+    udpHeader.SetChecksum(0);
+
+    SuccessOrQuit(message->Append(&ip6Header, sizeof(ip6Header)), "SendDatagram: Append() failed\n");
+    SuccessOrQuit(message->Append(&udpHeader, sizeof(udpHeader)), "SendDatagram: Append() failed\n");
+    SuccessOrQuit(sThreadNetif.GetMeshForwarder().SendMessage(*message), "SendDatagram: SendMessage() failed\n");
+
+    return message;
+}
+
+static Message *SendToChild(uint8_t aPriority, uint8_t aChildId = kChildId)
+{
+    Ip6::Address destination;
+
+    memset(&destination, 0, sizeof(destination));
+    destination.mFields.m16[0] = HostSwap16(0xfe80);
+    destination.mFields.m16[5] = HostSwap16(0x00ff);
+    destination.mFields.m16[6] = HostSwap16(0xfe00);
+    destination.mFields.m16[7] = HostSwap16(GetChildRloc16(aChildId));
+
+    return SendDatagram(destination, aPriority);
+}
+
+static Message *SendToAllThreadNodes(uint8_t aPriority)
+{
+    return SendDatagram(*sThreadNetif.GetMle().GetLinkLocalAllThreadNodesAddress(), aPriority);
+}
+
+// Delivers a data request from a sleepy child and lets the forwarder pick the message to send in response.
+static void ReceiveDataPoll(uint8_t aChildId = kChildId)
+{
+    uint8_t psdu[Mac::Frame::kMTU];
+    Mac::Frame frame;
+    Mac::ExtAddress child;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.mPsdu = psdu;
+    frame.mPower = kNeighborRss;
+    frame.InitMacHeader(Mac::Frame::kFcfFrameMacCmd | Mac::Frame::kFcfPanidCompression |
+                        Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfDstAddrShort |
+                        Mac::Frame::kFcfSrcAddrExt | Mac::Frame::kFcfAckRequest | Mac::Frame::kFcfSecurityEnabled,
+                        Mac::Frame::kKeyIdMode1 | Mac::Frame::kSecEncMic32);
+    frame.SetDstPanId(kPanId);
+    frame.SetDstAddr(sThreadNetif.GetMac().GetShortAddress());
+    SetExtAddress(child, aChildId);
+    frame.SetSrcAddr(child);
+    frame.SetCommandId(Mac::Frame::kMacCmdDataRequest);
+    frame.SetPayloadLength(sizeof(uint8_t));
+
+    ReceiveSecuredFrame(frame, child);
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+}
+
+void TestIndirectPriority(void)
+{
+    Child &child = ResetIndirect();
+    Message *unicast;
+    Message *multicast;
+
+    // A low priority multicast still waiting for its broadcast must not overtake an older unicast.
+    unicast = SendToChild(Message::kPriorityMedium);
+    multicast = SendToAllThreadNodes(Message::kPriorityLow);
+    VerifyOrQuit(multicast->GetDirectTransmission() && !unicast->GetDirectTransmission() &&
+                 multicast->GetChildMask(sThreadNetif.GetMle().GetChildIndex(child)),
+                 "TestIndirectPriority: messages not queued as expected\n");
+
+    ReceiveDataPoll();
+    VerifyOrQuit(child.mIndirectSendInfo.mMessage == unicast, "TestIndirectPriority: unicast overtaken\n");
+
+    CompleteTransmission();
+    VerifyOrQuit(child.mQueuedIndirectMessageCnt == 1, "TestIndirectPriority: unicast not delivered\n");
+
+    // The multicast is broadcast next, then delivered to the child on its next poll.
+    CompleteTransmission();
+    VerifyOrQuit(!multicast->GetDirectTransmission(), "TestIndirectPriority: multicast not broadcast\n");
+
+    ReceiveDataPoll();
+    VerifyOrQuit(child.mIndirectSendInfo.mMessage == multicast, "TestIndirectPriority: multicast not delivered\n");
+
+    CompleteAllTransmissions();
+    VerifyOrQuit(child.mQueuedIndirectMessageCnt == 0, "TestIndirectPriority: messages left for the child\n");
+}
+
+void TestIndirectOrder(void)
+{
+    Child &child = ResetIndirect();
+    Message *unicast;
+    Message *multicast;
+    uint16_t messages;
+    uint16_t buffers;
+
+    // Once broadcast, the multicast moves to the indirect queue and is still delivered ahead of the newer unicast.
+    multicast = SendToAllThreadNodes(Message::kPriorityMedium);
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+    VerifyOrQuit(sTxPending, "TestIndirectOrder: multicast not broadcast\n");
+
+    unicast = SendToChild(Message::kPriorityMedium);
+    CompleteTransmission();
+    VerifyOrQuit(!multicast->GetDirectTransmission() &&
+                 multicast->GetPriorityQueue() == &sThreadNetif.GetMeshForwarder().GetIndirectSendQueue(),
+                 "TestIndirectOrder: multicast not moved to the indirect queue\n");
+
+    ReceiveDataPoll();
+    VerifyOrQuit(child.mIndirectSendInfo.mMessage == multicast, "TestIndirectOrder: multicast overtaken\n");
+
+    CompleteTransmission();
+    ReceiveDataPoll();
+    VerifyOrQuit(child.mIndirectSendInfo.mMessage == unicast, "TestIndirectOrder: unicast not delivered\n");
+
+    CompleteAllTransmissions();
+    VerifyOrQuit(child.mQueuedIndirectMessageCnt == 0, "TestIndirectOrder: messages left for the child\n");
+    sThreadNetif.GetMeshForwarder().GetIndirectSendQueue().GetInfo(messages, buffers);
+    VerifyOrQuit(messages == 0, "TestIndirectOrder: delivered messages not freed\n");
+}
+
+static uint16_t GetQueuedMessageCount(void)
+{
+    uint16_t messages;
+    uint16_t indirectMessages;
+    uint16_t buffers;
+
+    sThreadNetif.GetMeshForwarder().GetSendQueue().GetInfo(messages, buffers);
+    sThreadNetif.GetMeshForwarder().GetIndirectSendQueue().GetInfo(indirectMessages, buffers);
+
+    return messages + indirectMessages;
+}
+
+void TestIndirectBroadcast(void)
+{
+    Child &child = ResetIndirect(2);
+    Child &otherChild = *sThreadNetif.GetMle().GetChild(GetChildRloc16(kOtherChildId));
+    Message *unicast;
+    Message *lowMulticast;
+    Message *highMulticast;
+
+    lowMulticast = SendToAllThreadNodes(Message::kPriorityLow);
+    sIp6.mTaskletScheduler.ProcessQueuedTasklets();
+    unicast = SendToChild(Message::kPriorityMedium);
+    CompleteTransmission();
+    VerifyOrQuit(!lowMulticast->GetDirectTransmission() && child.mQueuedIndirectMessageCnt == 2 &&
+                 otherChild.mQueuedIndirectMessageCnt == 1, "TestIndirectBroadcast: messages not queued\n");
+
+    // The first child takes the unicast and then the multicast, which stays queued for the other child.
+    ReceiveDataPoll();
+    VerifyOrQuit(child.mIndirectSendInfo.mMessage == unicast, "TestIndirectBroadcast: unicast overtaken\n");
+    CompleteTransmission();
+    ReceiveDataPoll();
+    VerifyOrQuit(child.mIndirectSendInfo.mMessage == lowMulticast, "TestIndirectBroadcast: multicast not delivered\n");
+    CompleteTransmission();
+    VerifyOrQuit(child.mQueuedIndirectMessageCnt == 0 && GetQueuedMessageCount() == 1,
+                 "TestIndirectBroadcast: multicast freed before the other child received it\n");
+
+    // A newer multicast of higher priority goes first.
+    highMulticast = SendToAllThreadNodes(Message::kPriorityHigh);
+    CompleteAllTransmissions();
+    VerifyOrQuit(!highMulticast->GetDirectTransmission(), "TestIndirectBroadcast: multicast not broadcast\n");
+
+    ReceiveDataPoll(kOtherChildId);
+    VerifyOrQuit(otherChild.mIndirectSendInfo.mMessage == highMulticast,
+                 "TestIndirectBroadcast: high priority multicast overtaken\n");
+    CompleteTransmission();
+    ReceiveDataPoll(kOtherChildId);
+    VerifyOrQuit(otherChild.mIndirectSendInfo.mMessage == lowMulticast,
+                 "TestIndirectBroadcast: multicast not delivered to the other child\n");
+    CompleteTransmission();
+    ReceiveDataPoll();
+    VerifyOrQuit(child.mIndirectSendInfo.mMessage == highMulticast,
+                 "TestIndirectBroadcast: high priority multicast not delivered\n");
+    CompleteAllTransmissions();
+
+    VerifyOrQuit(child.mQueuedIndirectMessageCnt == 0 && otherChild.mQueuedIndirectMessageCnt == 0,
+                 "TestIndirectBroadcast: messages left for the children\n");
+    VerifyOrQuit(GetQueuedMessageCount() == 0, "TestIndirectBroadcast: delivered messages not freed\n");
+}
+
+void TestIndirectClear(void)
+{
+    Child &child = ResetIndirect(2);
+    Child &otherChild = *sThreadNetif.GetMle().GetChild(GetChildRloc16(kOtherChildId));
+    Message *multicast;
+
+    multicast = SendToAllThreadNodes(Message::kPriorityMedium);
+    SendToChild(Message::kPriorityMedium);
+    SendToChild(Message::kPriorityMedium, kOtherChildId);
+    CompleteAllTransmissions();
+    VerifyOrQuit(GetQueuedMessageCount() == 3, "TestIndirectClear: messages not queued\n");
+
+    // Clearing a child frees its unicast and leaves the multicast to the other child.
+    sThreadNetif.GetMeshForwarder().ClearChildIndirectMessages(child);
+    VerifyOrQuit(child.mQueuedIndirectMessageCnt == 0 && GetQueuedMessageCount() == 2,
+                 "TestIndirectClear: messages of the cleared child not freed\n");
+    VerifyOrQuit(!multicast->GetChildMask(sThreadNetif.GetMle().GetChildIndex(child)) &&
+                 multicast->GetChildMask(sThreadNetif.GetMle().GetChildIndex(otherChild)),
+                 "TestIndirectClear: wrong child mask\n");
+
+    ReceiveDataPoll();
+    VerifyOrQuit(!sTxPending, "TestIndirectClear: cleared message delivered\n");
+
+    ReceiveDataPoll(kOtherChildId);
+    VerifyOrQuit(otherChild.mIndirectSendInfo.mMessage == multicast, "TestIndirectClear: multicast not delivered\n");
+    CompleteTransmission();
+    VerifyOrQuit(otherChild.mQueuedIndirectMessageCnt == 1 && GetQueuedMessageCount() == 1,
+                 "TestIndirectClear: multicast not freed\n");
+
+    // Messages for a child that is no longer attached are freed as well.
+    otherChild.mState = Neighbor::kStateInvalid;
+    sThreadNetif.GetMeshForwarder().UpdateIndirectMessages();
+    VerifyOrQuit(otherChild.mQueuedIndirectMessageCnt == 0 && GetQueuedMessageCount() == 0,
+                 "TestIndirectClear: messages of a detached child not freed\n");
+}
+
+}  // namespace Thread
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    Thread::TestReassemblyInOrder();
+    Thread::TestReassemblyOutOfOrder();
+    Thread::TestReassemblyDuplicates();
+    Thread::TestReassemblyPartialBlock();
+    Thread::TestReassemblySourceCollision();
+    Thread::TestReassemblyTimeout();
+    Thread::TestReassemblyFailures();
+    Thread::TestRelayFlow();
+    Thread::TestRelayNextHopLost();
+    Thread::TestIndirectPriority();
+    Thread::TestIndirectOrder();
+    Thread::TestIndirectBroadcast();
+    Thread::TestIndirectClear();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -31,7 +31,9 @@
 #include <openthread-instance.h>
 #include <common/debug.hpp>
 #include <common/message.hpp>
+#include <net/ip6.hpp>
 #include <string.h>
+#include <time.h>
 
 void TestMessage(void)
 {
@@ -62,10 +64,396 @@ void TestMessage(void)
                   "Message::Free failed\n");
 }
 
+/**
+ * Verifies cursor reads, writes, appends and copies against a flat buffer, across buffer boundaries.
+ */
+void TestMessageCursor(void)
+{
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    Thread::Message *copy;
+    uint8_t writeBuffer[600];
+    uint8_t readBuffer[600];
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool.New(Thread::Message::kTypeIp6, 3)) != NULL, "Message::New failed\n");
+
+    // Append in odd-sized chunks so the cursor crosses buffer boundaries mid-chunk.
+    {
+        Thread::Message::Cursor cursor(*message, 0);
+
+        for (uint16_t offset = 0; offset < sizeof(writeBuffer); offset += 7)
+        {
+            uint16_t length = (sizeof(writeBuffer) - offset < 7) ? sizeof(writeBuffer) - offset : 7;
+
+            SuccessOrQuit(message->Append(cursor, writeBuffer + offset, length), "Message::Append failed\n");
+            VerifyOrQuit(cursor.GetOffset() == offset + length, "Message::Append cursor failed\n");
+        }
+    }
+
+    VerifyOrQuit(message->GetLength() == sizeof(writeBuffer), "Message::GetLength failed\n");
+    VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer), "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Message::Append compare failed\n");
+
+    // Sequential reads of varying sizes, including past the end of the message.
+    {
+        Thread::Message::Cursor cursor(*message, 0);
+        uint16_t offset = 0;
+
+        for (uint16_t length = 1; offset < sizeof(writeBuffer); length = (length % 13) + 1)
+        {
+            uint16_t expected = (sizeof(writeBuffer) - offset < length) ? sizeof(writeBuffer) - offset : length;
+
+            VerifyOrQuit(message->Read(cursor, length, readBuffer) == expected, "Message::Read cursor failed\n");
+            VerifyOrQuit(memcmp(writeBuffer + offset, readBuffer, expected) == 0, "Message::Read compare failed\n");
+            offset += expected;
+            VerifyOrQuit(cursor.GetOffset() == offset, "Message::Read cursor offset failed\n");
+        }
+
+        VerifyOrQuit(message->Read(cursor, 1, readBuffer) == 0, "Message::Read past end failed\n");
+    }
+
+    // Seek forward and backward, then overwrite through the cursor.
+    {
+        Thread::Message::Cursor cursor(*message, 500);
+
+        cursor.SetOffset(100);
+        VerifyOrQuit(message->Read(cursor, 50, readBuffer) == 50, "Message::Read cursor failed\n");
+        VerifyOrQuit(memcmp(writeBuffer + 100, readBuffer, 50) == 0, "Message::SetOffset backward failed\n");
+
+        cursor.SetOffset(400);
+        VerifyOrQuit(message->Read(cursor, 50, readBuffer) == 50, "Message::Read cursor failed\n");
+        VerifyOrQuit(memcmp(writeBuffer + 400, readBuffer, 50) == 0, "Message::SetOffset forward failed\n");
+
+        for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+        {
+            writeBuffer[i] = static_cast<uint8_t>(random());
+        }
+
+        cursor.SetOffset(0);
+        VerifyOrQuit(message->Write(cursor, sizeof(writeBuffer), writeBuffer) == sizeof(writeBuffer),
+                     "Message::Write cursor failed\n");
+        VerifyOrQuit(message->Read(0, sizeof(readBuffer), readBuffer) == sizeof(readBuffer),
+                     "Message::Read failed\n");
+        VerifyOrQuit(memcmp(writeBuffer, readBuffer, sizeof(writeBuffer)) == 0, "Message::Write compare failed\n");
+    }
+
+    // Copy between messages whose buffer boundaries do not line up.
+    VerifyOrQuit((copy = messagePool.New(Thread::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(copy->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+    VerifyOrQuit(message->CopyTo(11, 5, 500, *copy) == 500, "Message::CopyTo failed\n");
+    VerifyOrQuit(copy->Read(5, 500, readBuffer) == 500, "Message::Read failed\n");
+    VerifyOrQuit(memcmp(writeBuffer + 11, readBuffer, 500) == 0, "Message::CopyTo compare failed\n");
+    VerifyOrQuit(message->CopyTo(590, 0, 20, *copy) == 10, "Message::CopyTo past end failed\n");
+
+    // Walk the message in place, one contiguous segment at a time.
+    {
+        otMessageCursor cursor;
+        const uint8_t *data;
+        uint16_t length;
+        uint16_t offset = 3;
+
+        otMessageCursorInit(&cursor, message, offset);
+
+        while ((length = otMessageGetNextSegment(&cursor, 100, &data)) != 0)
+        {
+            VerifyOrQuit(length <= 100, "otMessageGetNextSegment length failed\n");
+            VerifyOrQuit(memcmp(writeBuffer + offset, data, length) == 0, "otMessageGetNextSegment compare failed\n");
+            offset += length;
+        }
+
+        VerifyOrQuit(offset == sizeof(writeBuffer), "otMessageGetNextSegment end failed\n");
+    }
+
+    SuccessOrQuit(copy->Free(), "Message::Free failed\n");
+    SuccessOrQuit(message->Free(), "Message::Free failed\n");
+}
+
+/**
+ * Reports the cost of reading a 1280-byte message in 4-byte pieces by offset and through a cursor.
+ */
+void TestMessageCursorPerformance(void)
+{
+    const uint32_t kIterations = 5000;
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    uint8_t writeBuffer[1280];
+    uint32_t value;
+    uint32_t sum1 = 0;
+    uint32_t sum2 = 0;
+    clock_t start;
+    double byOffset;
+    double byCursor;
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool.New(Thread::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+    VerifyOrQuit(message->Write(0, sizeof(writeBuffer), writeBuffer) == sizeof(writeBuffer),
+                 "Message::Write failed\n");
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        for (uint16_t offset = 0; offset < sizeof(writeBuffer); offset += sizeof(value))
+        {
+            message->Read(offset, sizeof(value), &value);
+            sum1 += value;
+        }
+    }
+
+    byOffset = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        Thread::Message::Cursor cursor(*message, 0);
+
+        while (message->Read(cursor, sizeof(value), &value) == sizeof(value))
+        {
+            sum2 += value;
+        }
+    }
+
+    byCursor = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    VerifyOrQuit(sum1 == sum2, "TestMessageCursorPerformance failed\n");
+
+    printf("TestMessageCursorPerformance: 1280-byte message in 4-byte reads by offset %.0f ns, by cursor %.0f ns\n",
+           byOffset * 1e9 / kIterations, byCursor * 1e9 / kIterations);
+
+    SuccessOrQuit(message->Free(), "Message::Free failed\n");
+}
+
+/**
+ * Computes a checksum one byte at a time, as a reference for the word-wide implementation.
+ */
+static uint16_t UpdateChecksumBytewise(uint16_t aChecksum, const uint8_t *aBuf, uint16_t aLength)
+{
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aChecksum = Thread::Ip6::Ip6::UpdateChecksum(aChecksum, (i & 1) ? aBuf[i] :
+                                                     static_cast<uint16_t>(aBuf[i] << 8));
+    }
+
+    return aChecksum;
+}
+
+/**
+ * Verifies the checksum over flat buffers of every alignment and over ranges spanning odd-length buffer segments.
+ */
+void TestMessageChecksum(void)
+{
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    uint8_t writeBuffer[1280];
+    const uint16_t kChecksums[] = {0, 0x0001, 0x8000, 0xfffe, 0xffff};
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    for (unsigned c = 0; c < sizeof(kChecksums) / sizeof(kChecksums[0]); c++)
+    {
+        for (uint16_t offset = 0; offset < 8; offset++)
+        {
+            for (uint16_t length = 0; length < 64; length++)
+            {
+                VerifyOrQuit(Thread::Ip6::Ip6::UpdateChecksum(kChecksums[c], writeBuffer + offset, length) ==
+                             UpdateChecksumBytewise(kChecksums[c], writeBuffer + offset, length),
+                             "Ip6::UpdateChecksum failed\n");
+            }
+        }
+    }
+
+    // All 0xff bytes exercise the carry folding.
+    memset(writeBuffer, 0xff, sizeof(writeBuffer));
+    VerifyOrQuit(Thread::Ip6::Ip6::UpdateChecksum(0x1234, writeBuffer, sizeof(writeBuffer)) ==
+                 UpdateChecksumBytewise(0x1234, writeBuffer, sizeof(writeBuffer)),
+                 "Ip6::UpdateChecksum carry failed\n");
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    // Odd reserved headers and offsets make the buffer segments odd-length.
+    for (uint16_t reserved = 0; reserved < 4; reserved++)
+    {
+        VerifyOrQuit((message = messagePool.New(Thread::Message::kTypeIp6, reserved)) != NULL,
+                     "Message::New failed\n");
+        SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+        VerifyOrQuit(message->Write(0, sizeof(writeBuffer), writeBuffer) == sizeof(writeBuffer),
+                     "Message::Write failed\n");
+
+        for (uint16_t offset = 0; offset < 300; offset += 7)
+        {
+            for (uint16_t length = 0; offset + length <= sizeof(writeBuffer); length += 61)
+            {
+                VerifyOrQuit(message->UpdateChecksum(0x5a5a, offset, length) ==
+                             UpdateChecksumBytewise(0x5a5a, writeBuffer + offset, length),
+                             "Message::UpdateChecksum failed\n");
+            }
+        }
+
+        SuccessOrQuit(message->Free(), "Message::Free failed\n");
+    }
+}
+
+/**
+ * Reports the cost of checksumming a 1280-byte datagram held in a message, byte-wise and word-wide.
+ */
+void TestMessageChecksumPerformance(void)
+{
+    const uint32_t kIterations = 20000;
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    uint8_t writeBuffer[1280];
+    uint16_t checksum1 = 0;
+    uint16_t checksum2 = 0;
+    clock_t start;
+    double bytewise;
+    double wordwide;
+
+    for (unsigned i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(random());
+    }
+
+    VerifyOrQuit((message = messagePool.New(Thread::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->SetLength(sizeof(writeBuffer)), "Message::SetLength failed\n");
+    VerifyOrQuit(message->Write(0, sizeof(writeBuffer), writeBuffer) == sizeof(writeBuffer),
+                 "Message::Write failed\n");
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        uint8_t segment[128];
+        uint16_t offset = 0;
+
+        checksum1 = static_cast<uint16_t>(i);
+
+        while (offset < sizeof(writeBuffer))
+        {
+            uint16_t length = message->Read(offset, sizeof(segment), segment);
+            checksum1 = UpdateChecksumBytewise(checksum1, segment, length);
+            offset += length;
+        }
+    }
+
+    bytewise = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        checksum2 = message->UpdateChecksum(static_cast<uint16_t>(i), 0, sizeof(writeBuffer));
+    }
+
+    wordwide = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    VerifyOrQuit(checksum1 == checksum2, "TestMessageChecksumPerformance failed\n");
+
+    printf("TestMessageChecksumPerformance: 1280-byte datagram byte-wise %.0f ns, word-wide %.0f ns\n",
+           bytewise * 1e9 / kIterations, wordwide * 1e9 / kIterations);
+
+    SuccessOrQuit(message->Free(), "Message::Free failed\n");
+}
+
+static bool HandleEvictMessage(void *aContext, Thread::Message &aMessage)
+{
+    static_cast<Thread::MessageQueue *>(aContext)->Dequeue(aMessage);
+    aMessage.Free();
+    return true;
+}
+
+/**
+ * Verifies per-priority reserves and eviction of lower priority queued messages.
+ */
+void TestMessagePoolPriorities(void)
+{
+    const uint16_t kReserved = OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_HIGH +
+                               OPENTHREAD_CONFIG_MESSAGE_RESERVED_BUFFERS_MEDIUM;
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::MessageQueue queue;
+    Thread::Message *message;
+    uint16_t numLow = 0;
+
+    while ((message = messagePool.New(Thread::Message::kTypeIp6, 0)) != NULL)
+    {
+        SuccessOrQuit(queue.Enqueue(*message), "MessageQueue::Enqueue failed\n");
+        numLow++;
+    }
+
+    VerifyOrQuit(numLow == Thread::kNumBuffers - kReserved, "Low priority allocated reserved buffers\n");
+    VerifyOrQuit(messagePool.GetCounters(Thread::Message::kPriorityLow).mAllocFailures == 1,
+                 "Allocation failure not counted\n");
+
+    // Reserved buffers remain for higher priorities even without eviction.
+    for (uint16_t i = 0; i < kReserved; i++)
+    {
+        VerifyOrQuit((message = messagePool.New(Thread::Message::kTypeIp6, 0, Thread::Message::kPriorityHigh)) != NULL,
+                     "High priority allocation failed\n");
+        SuccessOrQuit(queue.Enqueue(*message), "MessageQueue::Enqueue failed\n");
+    }
+
+    VerifyOrQuit(messagePool.New(Thread::Message::kTypeIp6, 0, Thread::Message::kPriorityHigh) == NULL,
+                 "Allocation succeeded from an empty pool\n");
+
+    // With an evict handler, the oldest low priority message makes room.
+    messagePool.SetEvictHandler(HandleEvictMessage, &queue);
+
+    VerifyOrQuit((message = messagePool.New(Thread::Message::kTypeIp6, 0, Thread::Message::kPriorityHigh)) != NULL,
+                 "High priority allocation did not evict\n");
+    VerifyOrQuit(messagePool.GetCounters(Thread::Message::kPriorityLow).mEvicted == 1, "Eviction not counted\n");
+    VerifyOrQuit(messagePool.GetCounters(Thread::Message::kPriorityHigh).mBuffersInUse == kReserved + 1,
+                 "High priority buffers miscounted\n");
+
+    // Raising the priority moves the buffers to the new level.
+    SuccessOrQuit(message->SetPriority(Thread::Message::kPriorityMedium), "Message::SetPriority failed\n");
+    VerifyOrQuit(messagePool.GetCounters(Thread::Message::kPriorityHigh).mBuffersInUse == kReserved,
+                 "SetPriority did not move buffers\n");
+    SuccessOrQuit(message->Free(), "Message::Free failed\n");
+
+    while ((message = queue.GetHead()) != NULL)
+    {
+        SuccessOrQuit(queue.Dequeue(*message), "MessageQueue::Dequeue failed\n");
+        SuccessOrQuit(message->Free(), "Message::Free failed\n");
+    }
+
+    for (uint8_t priority = 0; priority < Thread::Message::kNumPriorities; priority++)
+    {
+        VerifyOrQuit(messagePool.GetCounters(priority).mBuffersInUse == 0, "Buffers leaked\n");
+    }
+
+    VerifyOrQuit(messagePool.GetFreeBufferCount() == Thread::kNumBuffers, "Buffers leaked\n");
+}
+
 #ifdef ENABLE_TEST_MAIN
 int main(void)
 {
     TestMessage();
+    TestMessageCursor();
+    TestMessageCursorPerformance();
+    TestMessageChecksum();
+    TestMessageChecksumPerformance();
+    TestMessagePoolPriorities();
     printf("All tests passed\n");
     return 0;
 }
@@ -27,6 +27,7 @@
  */
 
 #include <ctype.h>
+#include "test_platform.h"
 #include "test_util.h"
 #include "openthread/openthread.h"
 #include <openthread-instance.h>
@@ -40,7 +41,7 @@ namespace Thread {
 
 enum
 {
-    kTestBufferSize = 101,         // Size of backed buffer for NcpFrameBuffer.
+    kTestBufferSize = 111,         // Size of backed buffer for NcpFrameBuffer.
     kTestIterationAttemps = 120,
 };
 
@@ -50,6 +51,8 @@ static const uint8_t sHelloText[]      = "Hello there!";
 static const uint8_t sMottoText[]      = "Think good thoughts, say good words, do good deeds!";
 static const uint8_t sMysteryText[]    = "4871(\\):|(3$}{4|/4/2%14(\\)";
 
+static uint32_t sNow;
+
 static otInstance sInstance;
 static MessagePool sMessagePool(&sInstance);
 
@@ -80,6 +83,11 @@ void BufferDidGetNonEmptyCallback(void *aContext, NcpFrameBuffer *aNcpBuffer)
 }
 
 
+uint32_t TestGetNow(void)
+{
+    return sNow;
+}
+
 // Dump the buffer content to screen.
 void DumpBuffer(const char *aTextMessage, uint8_t *aBuffer, uint16_t aBufferLength)
 {
@@ -142,7 +150,7 @@ void WriteTestFrame1(NcpFrameBuffer &aNcpBuffer)
     SuccessOrQuit(message->SetLength(sizeof(sMottoText)), "Could not set the length of message.");
     message->Write(0, sizeof(sMottoText), sMottoText);
 
-    SuccessOrQuit(aNcpBuffer.InFrameBegin(), "InFrameBegin() failed.");
+    SuccessOrQuit(aNcpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow), "InFrameBegin() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedData(sMottoText, sizeof(sMottoText)), "InFrameFeedData() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedData(sMysteryText, sizeof(sMysteryText)), "InFrameFeedData() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedMessage(message), "InFrameFeedMessage() failed.");
@@ -167,7 +175,7 @@ void VerifyAndRemoveFrame1(NcpFrameBuffer &aNcpBuffer)
     SuccessOrQuit(aNcpBuffer.OutFrameRemove(), "Remove() failed.");
 }
 
-void WriteTestFrame2(NcpFrameBuffer &aNcpBuffer)
+void WriteTestFrame2(NcpFrameBuffer &aNcpBuffer, NcpFrameBuffer::Priority aPriority = NcpFrameBuffer::kPriorityLow)
 {
     Message *message1;
     Message *message2;
@@ -182,7 +190,7 @@ void WriteTestFrame2(NcpFrameBuffer &aNcpBuffer)
     SuccessOrQuit(message2->SetLength(sizeof(sHelloText)), "Could not set the length of message.");
     message2->Write(0, sizeof(sHelloText), sHelloText);
 
-    SuccessOrQuit(aNcpBuffer.InFrameBegin(), "InFrameFeedBegin() failed.");
+    SuccessOrQuit(aNcpBuffer.InFrameBegin(aPriority), "InFrameFeedBegin() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedMessage(message1), "InFrameFeedMessage() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedData(sOpenThreadText, sizeof(sOpenThreadText)), "InFrameFeedData() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedMessage(message2), "InFrameFeedMessage() failed.");
@@ -205,7 +213,7 @@ void VerifyAndRemoveFrame2(NcpFrameBuffer &aNcpBuffer)
     SuccessOrQuit(aNcpBuffer.OutFrameRemove(), "Remove() failed.");
 }
 
-void WriteTestFrame3(NcpFrameBuffer &aNcpBuffer)
+void WriteTestFrame3(NcpFrameBuffer &aNcpBuffer, NcpFrameBuffer::Priority aPriority = NcpFrameBuffer::kPriorityLow)
 {
     Message *message1;
 
@@ -215,7 +223,7 @@ void WriteTestFrame3(NcpFrameBuffer &aNcpBuffer)
     // An empty message with no content.
     SuccessOrQuit(message1->SetLength(0), "Could not set the length of message.");
 
-    SuccessOrQuit(aNcpBuffer.InFrameBegin(), "InFrameFeedBegin() failed.");
+    SuccessOrQuit(aNcpBuffer.InFrameBegin(aPriority), "InFrameFeedBegin() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedMessage(message1), "InFrameFeedMessage() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameFeedData(sMysteryText, sizeof(sMysteryText)), "InFrameFeedData() failed.");
     SuccessOrQuit(aNcpBuffer.InFrameEnd(), "InFrameEnd() failed.");
@@ -292,10 +300,13 @@ void TestNcpFrameBuffer(void)
 
     DumpBuffer("\nBuffer after multiple frames", buffer, kTestBufferSize);
 
+    VerifyOrQuit(ncpBuffer.OutFrameHasNext() == true, "OutFrameHasNext() is incorrect with multiple frames.");
     VerifyAndRemoveFrame2(ncpBuffer);
     VerifyAndRemoveFrame3(ncpBuffer);
     VerifyAndRemoveFrame2(ncpBuffer);
+    VerifyOrQuit(ncpBuffer.OutFrameHasNext() == false, "OutFrameHasNext() is incorrect with a single frame.");
     VerifyAndRemoveFrame2(ncpBuffer);
+    VerifyOrQuit(ncpBuffer.OutFrameHasNext() == false, "OutFrameHasNext() is incorrect when buffer is empty.");
 
     printf("\nIterations: ");
 
@@ -331,7 +342,7 @@ void TestNcpFrameBuffer(void)
         WriteTestFrame2(ncpBuffer);
         WriteTestFrame3(ncpBuffer);
 
-        ncpBuffer.InFrameBegin();
+        ncpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow);
         ncpBuffer.InFrameFeedData(sHelloText, sizeof(sHelloText));
 
         message = sMessagePool.New(Message::kTypeIp6, 0);
@@ -440,7 +451,7 @@ void TestNcpFrameBuffer(void)
     printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
     printf("\nTest 6: OutFrameRead() in parts\n");
 
-    ncpBuffer.InFrameBegin();
+    ncpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow);
     ncpBuffer.InFrameFeedData(sMottoText, sizeof(sMottoText));
     ncpBuffer.InFrameEnd();
 
@@ -459,6 +470,176 @@ void TestNcpFrameBuffer(void)
 
     VerifyOrQuit(readOffset == sizeof(sMottoText), "Read len does not match expected length.");
     printf("\n -- PASS\n");
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest 7: OutFramePeek() and OutFrameSkip() over a message spanning several message buffers\n");
+
+    {
+        uint8_t content[sizeof(sHelloText) + 600 + sizeof(sOpenThreadText)];
+        uint16_t largestPeek = 0;
+        const uint8_t *data;
+
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "Remove() failed.");
+        VerifyOrQuit(ncpBuffer.IsEmpty() == true, "IsEmpty() is incorrect when buffer is empty.");
+
+        memcpy(content, sHelloText, sizeof(sHelloText));
+
+        for (i = 0; i < 600; i++)
+        {
+            content[sizeof(sHelloText) + i] = static_cast<uint8_t>(i * 7);
+        }
+
+        memcpy(content + sizeof(sHelloText) + 600, sOpenThreadText, sizeof(sOpenThreadText));
+
+        message = sMessagePool.New(Message::kTypeIp6, 0);
+        VerifyOrQuit(message != NULL, "Null Message");
+        SuccessOrQuit(message->SetLength(600), "Could not set the length of message.");
+        message->Write(0, 600, content + sizeof(sHelloText));
+
+        ncpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow);
+        ncpBuffer.InFrameFeedData(sHelloText, sizeof(sHelloText));
+        SuccessOrQuit(ncpBuffer.InFrameFeedMessage(message), "InFrameFeedMessage() failed.");
+        ncpBuffer.InFrameFeedData(sOpenThreadText, sizeof(sOpenThreadText));
+        SuccessOrQuit(ncpBuffer.InFrameEnd(), "InFrameEnd() failed.");
+
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed unexpectedly.");
+        VerifyOrQuit(ncpBuffer.OutFrameGetLength() == sizeof(content), "GetLength() is incorrect.");
+        readOffset = 0;
+
+        while ((readLen = ncpBuffer.OutFramePeek(data)) != 0)
+        {
+            // Consume the contiguous bytes in two steps to exercise partial skips.
+            j = (readLen > 1) ? readLen / 2 : readLen;
+
+            VerifyOrQuit(readOffset + readLen <= sizeof(content), "Peek() returned more than the frame.");
+            VerifyOrQuit(memcmp(data, content + readOffset, readLen) == 0, "Peek() does not match expected content.");
+
+            if (readLen > largestPeek)
+            {
+                largestPeek = readLen;
+            }
+
+            ncpBuffer.OutFrameSkip(static_cast<uint16_t>(j));
+            readOffset += j;
+        }
+
+        VerifyOrQuit(readOffset == sizeof(content), "Peek len does not match expected length.");
+        VerifyOrQuit(ncpBuffer.OutFrameHasEnded() == true, "Frame longer than expected.");
+
+        // Message bytes are returned in place, a whole message buffer at a time.
+        VerifyOrQuit(largestPeek > 16, "Peek() did not return message bytes in place.");
+
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "Remove() failed.");
+    }
+
+    printf(" -- PASS\n");
+
+    printf("\n- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    printf("\nTest 8: Priority lanes");
+
+    {
+        NcpFrameBuffer::LaneCounters high;
+        NcpFrameBuffer::LaneCounters low;
+
+        g_testPlatAlarmGetNow = TestGetNow;
+        sNow = 1000;
+
+        ncpBuffer.Clear();
+
+        // High priority frames are read before low priority frames written earlier.
+        WriteTestFrame2(ncpBuffer, NcpFrameBuffer::kPriorityLow);
+        WriteTestFrame2(ncpBuffer, NcpFrameBuffer::kPriorityLow);
+        sNow += 10;
+        WriteTestFrame3(ncpBuffer, NcpFrameBuffer::kPriorityHigh);
+
+        DumpBuffer("\nBuffer with frames in both lanes", buffer, kTestBufferSize);
+
+        VerifyOrQuit(ncpBuffer.GetCounters(NcpFrameBuffer::kPriorityHigh).mFrameCount == 1,
+                     "Lane frame count is incorrect.");
+        VerifyOrQuit(ncpBuffer.GetCounters(NcpFrameBuffer::kPriorityLow).mFrameCount == 2,
+                     "Lane frame count is incorrect.");
+        VerifyOrQuit(ncpBuffer.OutFrameHasNext() == true, "OutFrameHasNext() is incorrect with frames in both lanes.");
+
+        sNow += 5;
+        VerifyAndRemoveFrame3(ncpBuffer);
+        VerifyOrQuit(ncpBuffer.OutFrameHasNext() == true, "OutFrameHasNext() is incorrect with multiple frames.");
+
+        // A high priority frame added while a low priority frame is being read does not interrupt it.
+        SuccessOrQuit(ncpBuffer.OutFrameBegin(), "OutFrameBegin() failed unexpectedly.");
+        ReadAndVerifyContent(ncpBuffer, sMysteryText, 4);
+        WriteTestFrame3(ncpBuffer, NcpFrameBuffer::kPriorityHigh);
+        VerifyOrQuit(ncpBuffer.OutFrameGetLength() ==
+                     sizeof(sMysteryText) + sizeof(sHelloText) + sizeof(sOpenThreadText), "GetLength() is incorrect.");
+        ReadAndVerifyContent(ncpBuffer, sMysteryText + 4, sizeof(sMysteryText) - 4);
+        ReadAndVerifyContent(ncpBuffer, sOpenThreadText, sizeof(sOpenThreadText));
+        ReadAndVerifyContent(ncpBuffer, sHelloText, sizeof(sHelloText));
+        VerifyOrQuit(ncpBuffer.OutFrameHasEnded() == true, "Frame longer than expected.");
+        SuccessOrQuit(ncpBuffer.OutFrameRemove(), "Remove() failed.");
+
+        VerifyAndRemoveFrame3(ncpBuffer);
+        VerifyAndRemoveFrame2(ncpBuffer);
+        VerifyOrQuit(ncpBuffer.IsEmpty() == true, "IsEmpty() is incorrect when buffer is empty.");
+
+        high = ncpBuffer.GetCounters(NcpFrameBuffer::kPriorityHigh);
+        low = ncpBuffer.GetCounters(NcpFrameBuffer::kPriorityLow);
+        VerifyOrQuit(high.mFrameCount == 0 && low.mFrameCount == 0, "Lane frame count is incorrect.");
+        VerifyOrQuit(high.mPeakFrameCount == 1 && low.mPeakFrameCount == 2, "Lane peak frame count is incorrect.");
+        VerifyOrQuit(high.mMaxWaitTime == 5, "Lane wait time is incorrect.");
+        VerifyOrQuit(low.mMaxWaitTime == 15, "Lane wait time is incorrect.");
+
+        printf("\nIterations: ");
+
+        // Interleave the lanes so that both of them wrap around the buffer.
+        for (j = 0; j < kTestIterationAttemps; j++)
+        {
+            printf("*");
+
+            WriteTestFrame2(ncpBuffer, NcpFrameBuffer::kPriorityLow);
+            WriteTestFrame3(ncpBuffer, (j % 2) ? NcpFrameBuffer::kPriorityHigh : NcpFrameBuffer::kPriorityLow);
+            WriteTestFrame2(ncpBuffer, NcpFrameBuffer::kPriorityHigh);
+
+            if (j % 2)
+            {
+                VerifyAndRemoveFrame3(ncpBuffer);
+                VerifyAndRemoveFrame2(ncpBuffer);
+                VerifyAndRemoveFrame2(ncpBuffer);
+            }
+            else
+            {
+                VerifyAndRemoveFrame2(ncpBuffer);
+                VerifyAndRemoveFrame2(ncpBuffer);
+                WriteTestFrame2(ncpBuffer, NcpFrameBuffer::kPriorityHigh);
+                VerifyAndRemoveFrame2(ncpBuffer);
+                VerifyAndRemoveFrame3(ncpBuffer);
+            }
+
+            VerifyOrQuit(ncpBuffer.IsEmpty() == true, "IsEmpty() is incorrect when buffer is empty.");
+        }
+
+        // With a watermark on the low priority lane, the remaining space is kept for high priority frames.
+        ncpBuffer.SetWatermark(NcpFrameBuffer::kPriorityLow, kTestBufferSize / 2);
+        low = ncpBuffer.GetCounters(NcpFrameBuffer::kPriorityLow);
+
+        WriteTestFrame3(ncpBuffer, NcpFrameBuffer::kPriorityLow);
+        SuccessOrQuit(ncpBuffer.InFrameBegin(NcpFrameBuffer::kPriorityLow), "InFrameBegin() failed.");
+        VerifyOrQuit(ncpBuffer.InFrameFeedData(sMysteryText, sizeof(sMysteryText)) == kThreadError_NoBufs,
+                     "Low priority lane exceeded its watermark.");
+        VerifyOrQuit(ncpBuffer.GetCounters(NcpFrameBuffer::kPriorityLow).mDroppedFrameCount ==
+                     low.mDroppedFrameCount + 1, "Lane dropped frame count is incorrect.");
+
+        WriteTestFrame3(ncpBuffer, NcpFrameBuffer::kPriorityHigh);
+        WriteTestFrame2(ncpBuffer, NcpFrameBuffer::kPriorityHigh);
+
+        VerifyAndRemoveFrame3(ncpBuffer);
+        VerifyAndRemoveFrame2(ncpBuffer);
+        VerifyAndRemoveFrame3(ncpBuffer);
+        VerifyOrQuit(ncpBuffer.IsEmpty() == true, "IsEmpty() is incorrect when buffer is empty.");
+
+        ncpBuffer.SetWatermark(NcpFrameBuffer::kPriorityLow, kTestBufferSize);
+        g_testPlatAlarmGetNow = NULL;
+    }
+
+    printf(" -- PASS\n");
 }
 
 }  // namespace Thread
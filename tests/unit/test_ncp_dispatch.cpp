@@ -0,0 +1,218 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "test_util.h"
+#include "openthread/openthread.h"
+#include <openthread-instance.h>
+#include <common/code_utils.hpp>
+#include <ncp/ncp_base.hpp>
+
+namespace Thread {
+
+// This module implements unit-test for the NcpBase command and property dispatch.
+
+enum
+{
+    kNumDispatchIterations = 20000,
+};
+
+// Properties a host daemon typically polls, spread over the property key space.
+static const spinel_prop_key_t sPolledProperties[] =
+{
+    SPINEL_PROP_LAST_STATUS,
+    SPINEL_PROP_PROTOCOL_VERSION,
+    SPINEL_PROP_PHY_CHAN,
+    SPINEL_PROP_MAC_15_4_PANID,
+    SPINEL_PROP_NET_ROLE,
+    SPINEL_PROP_THREAD_CHILD_COUNT_MAX,
+    SPINEL_PROP_THREAD_RLOC16,
+    SPINEL_PROP_IPV6_ML_PREFIX,
+    SPINEL_PROP_CNTR_TX_PKT_TOTAL,
+    SPINEL_PROP_CNTR_RX_ERR_OTHER,
+    SPINEL_PROP_CNTR_RX_SPINEL_TOTAL,
+    SPINEL_PROP_MSG_BUFFER_COUNTERS,
+};
+
+class TestNcp : public NcpBase
+{
+public:
+    TestNcp(otInstance *aInstance):
+        NcpBase(aInstance) {
+    }
+
+    void Receive(const uint8_t *aBuf, uint16_t aBufLength) { HandleReceive(aBuf, aBufLength); }
+
+    // Reads the command and property key of the next response frame and removes it.
+    void ReadResponse(unsigned int &aCommand, unsigned int &aKey, unsigned int &aValue) {
+        uint8_t frame[256];
+        uint16_t frameLength;
+        uint8_t header;
+
+        VerifyOrQuit(mTxFrameBuffer.OutFrameBegin() == kThreadError_None, "no response frame.\n");
+        frameLength = mTxFrameBuffer.OutFrameRead(sizeof(frame), frame);
+        SuccessOrQuit(mTxFrameBuffer.OutFrameRemove(), "OutFrameRemove() failed.\n");
+
+        aValue = 0;
+        VerifyOrQuit(spinel_datatype_unpack(frame, frameLength, "Cii", &header, &aCommand, &aKey) > 0,
+                     "failed to parse response frame.\n");
+
+        if (aKey == SPINEL_PROP_LAST_STATUS)
+        {
+            spinel_datatype_unpack(frame, frameLength, "Ciii", &header, &aCommand, &aKey, &aValue);
+        }
+    }
+
+    void DiscardResponses(void) { mTxFrameBuffer.Clear(); }
+};
+
+static uint16_t PackPropertyGet(uint8_t *aFrame, uint16_t aFrameLength, spinel_prop_key_t aKey)
+{
+    spinel_ssize_t length = spinel_datatype_pack(aFrame, aFrameLength, "Cii", SPINEL_HEADER_FLAG | 1,
+                                                 SPINEL_CMD_PROP_VALUE_GET, aKey);
+
+    VerifyOrQuit(length > 0, "spinel_datatype_pack() failed.\n");
+
+    return static_cast<uint16_t>(length);
+}
+
+void TestNcpDispatch(void)
+{
+    otInstance *instance;
+    TestNcp *ncp;
+    uint8_t frame[16];
+    uint16_t frameLength;
+    unsigned int command;
+    unsigned int key;
+    unsigned int value;
+    clock_t start;
+    double elapsed;
+
+#ifdef OPENTHREAD_MULTIPLE_INSTANCE
+    size_t otInstanceBufferLength = 0;
+    uint8_t *otInstanceBuffer = NULL;
+
+    // Call to query the buffer size
+    (void)otInstanceInit(NULL, &otInstanceBufferLength);
+
+    // Call to allocate the buffer
+    otInstanceBuffer = (uint8_t *)malloc(otInstanceBufferLength);
+    VerifyOrQuit(otInstanceBuffer != NULL, "Failed to allocate otInstance.\n");
+
+    // Initialize Openthread with the buffer
+    instance = otInstanceInit(otInstanceBuffer, &otInstanceBufferLength);
+#else
+    instance = otInstanceInit();
+#endif
+
+    VerifyOrQuit(instance != NULL, "Failed to get and init an otInstance.\n");
+
+    ncp = new TestNcp(instance);
+
+    // Every polled property is answered with its own value.
+    for (unsigned i = 0; i < sizeof(sPolledProperties) / sizeof(sPolledProperties[0]); i++)
+    {
+        frameLength = PackPropertyGet(frame, sizeof(frame), sPolledProperties[i]);
+        ncp->Receive(frame, frameLength);
+        ncp->ReadResponse(command, key, value);
+
+        VerifyOrQuit(command == SPINEL_CMD_PROP_VALUE_IS && key == sPolledProperties[i],
+                     "TestNcpDispatch: unexpected response to a property get.\n");
+    }
+
+    // Properties without a getter, including ones below and above all table entries, are reported as not found.
+    {
+        const spinel_prop_key_t unknownKeys[] =
+        {
+            SPINEL_PROP_STREAM_DEBUG,
+            static_cast<spinel_prop_key_t>(SPINEL_PROP_NEST__END - 1),
+            static_cast<spinel_prop_key_t>(0x3fff),
+        };
+
+        for (unsigned i = 0; i < sizeof(unknownKeys) / sizeof(unknownKeys[0]); i++)
+        {
+            frameLength = PackPropertyGet(frame, sizeof(frame), unknownKeys[i]);
+            ncp->Receive(frame, frameLength);
+            ncp->ReadResponse(command, key, value);
+
+            VerifyOrQuit(command == SPINEL_CMD_PROP_VALUE_IS && key == SPINEL_PROP_LAST_STATUS &&
+                         value == SPINEL_STATUS_PROP_NOT_FOUND,
+                         "TestNcpDispatch: unknown property was not rejected.\n");
+        }
+    }
+
+    // An unknown command is rejected.
+    frameLength = static_cast<uint16_t>(spinel_datatype_pack(frame, sizeof(frame), "Ci", SPINEL_HEADER_FLAG | 1, 0x3f));
+    ncp->Receive(frame, frameLength);
+    ncp->ReadResponse(command, key, value);
+    VerifyOrQuit(key == SPINEL_PROP_LAST_STATUS && value == SPINEL_STATUS_INVALID_COMMAND,
+                 "TestNcpDispatch: unknown command was not rejected.\n");
+
+    // Report the cost of handling one property get, from receiving the frame to queuing the response.
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumDispatchIterations; i++)
+    {
+        frameLength = PackPropertyGet(frame, sizeof(frame),
+                                      sPolledProperties[i % (sizeof(sPolledProperties) / sizeof(sPolledProperties[0]))]);
+        ncp->Receive(frame, frameLength);
+        ncp->DiscardResponses();
+    }
+
+    elapsed = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    printf("TestNcpDispatch: %.0f ns per property get\n", elapsed * 1e9 / kNumDispatchIterations);
+
+    // A property without a getter is the worst case for the handler lookup.
+    frameLength = PackPropertyGet(frame, sizeof(frame), SPINEL_PROP_STREAM_DEBUG);
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumDispatchIterations; i++)
+    {
+        ncp->Receive(frame, frameLength);
+        ncp->DiscardResponses();
+    }
+
+    elapsed = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    printf("TestNcpDispatch: %.0f ns per property get without a handler\n", elapsed * 1e9 / kNumDispatchIterations);
+
+    delete ncp;
+    otInstanceFinalize(instance);
+}
+
+}  // namespace Thread
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    Thread::TestNcpDispatch();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,549 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include "test_platform.h"
+#include "openthread/ncp.h"
+#include "openthread/tasklet.h"
+#include <openthread-instance.h>
+#include <common/code_utils.hpp>
+#include <net/ip6.hpp>
+#include <ncp/hdlc.hpp>
+#include <ncp/spinel.h>
+
+namespace Thread {
+
+// This module implements unit-test for the frame coalescing of the NcpUart transport.
+
+enum
+{
+    kMaxFrames           = 16,                     // Max number of HDLC frames captured from the NCP in one test step.
+    kMaxSpinelFrames     = 16,                     // Max number of spinel frames in one coalesced frame.
+    kHostBufferSize      = 2 * SPINEL_FRAME_MAX_SIZE + 8,
+    kCounterTid          = 15,                     // Transaction ID of the counter reads.
+    kDatagramPayloadSize = 660,                    // Two such datagrams do not fit in one coalesced frame.
+    kDatagramHeaderSize  = sizeof(Ip6::Header) + sizeof(Ip6::UdpHeader),
+    kDatagramPort        = 1234,
+};
+
+struct Frame
+{
+    uint8_t  mBuffer[SPINEL_FRAME_MAX_SIZE];
+    uint16_t mLength;
+};
+
+struct SpinelFrame
+{
+    const uint8_t *mBuffer;
+    uint16_t       mLength;
+};
+
+class HostBuffer : public Hdlc::Encoder::BufferWriteIterator
+{
+public:
+    HostBuffer(void) {
+        mWritePointer = mBuffer;
+        mRemainingLength = sizeof(mBuffer);
+    }
+
+    uint16_t GetLength(void) const { return static_cast<uint16_t>(mWritePointer - mBuffer); }
+    const uint8_t *GetBuffer(void) const { return mBuffer; }
+
+private:
+    uint8_t mBuffer[kHostBufferSize];
+};
+
+static void HandleDecodedFrame(void *aContext, uint8_t *aFrame, uint16_t aFrameLength);
+static void HandleDecodeError(void *aContext, ThreadError aError, uint8_t *aFrame, uint16_t aFrameLength);
+
+// HDLC frames sent by the NCP. The decoder rejects any frame longer than SPINEL_FRAME_MAX_SIZE.
+static Frame         sFrames[kMaxFrames];
+static uint16_t      sFrameCount;
+static uint8_t       sDecodeBuffer[SPINEL_FRAME_MAX_SIZE];
+static Hdlc::Decoder sDecoder(sDecodeBuffer, sizeof(sDecodeBuffer), HandleDecodedFrame, HandleDecodeError, NULL);
+static bool          sUartSendPending;
+
+static void HandleDecodedFrame(void *aContext, uint8_t *aFrame, uint16_t aFrameLength)
+{
+    (void)aContext;
+
+    VerifyOrQuit(sFrameCount < kMaxFrames, "NcpUart sent too many frames.\n");
+
+    memcpy(sFrames[sFrameCount].mBuffer, aFrame, aFrameLength);
+    sFrames[sFrameCount].mLength = aFrameLength;
+    sFrameCount++;
+}
+
+static void HandleDecodeError(void *aContext, ThreadError aError, uint8_t *aFrame, uint16_t aFrameLength)
+{
+    (void)aContext;
+    (void)aError;
+    (void)aFrame;
+    (void)aFrameLength;
+
+    VerifyOrQuit(false, "NcpUart sent a malformed or oversized HDLC frame.\n");
+}
+
+static ThreadError HandleUartSend(const uint8_t *aBuf, uint16_t aBufLength)
+{
+    VerifyOrQuit(!sUartSendPending, "otPlatUartSend() called while a send was in progress.\n");
+
+    sUartSendPending = true;
+    sDecoder.Decode(aBuf, aBufLength);
+
+    return kThreadError_None;
+}
+
+// Runs the tasklets and completes each uart send, until the NCP has nothing left to send.
+static void ProcessNcp(otInstance *aInstance)
+{
+    while (otTaskletsArePending(aInstance) || sUartSendPending)
+    {
+        otTaskletsProcess(aInstance);
+
+        if (sUartSendPending)
+        {
+            sUartSendPending = false;
+            otPlatUartSendDone();
+        }
+    }
+}
+
+static void ReceiveFromHost(const uint8_t *aFrame, uint16_t aFrameLength)
+{
+    HostBuffer buffer;
+    Hdlc::Encoder encoder;
+
+    SuccessOrQuit(encoder.Init(buffer), "Encoder::Init() failed.\n");
+    SuccessOrQuit(encoder.Encode(aFrame, aFrameLength, buffer), "Encoder::Encode() failed.\n");
+    SuccessOrQuit(encoder.Finalize(buffer), "Encoder::Finalize() failed.\n");
+
+    otPlatUartReceived(buffer.GetBuffer(), buffer.GetLength());
+}
+
+// Sends a frame to the NCP, and captures the frames the NCP sends in response.
+static void SendToNcp(otInstance *aInstance, const uint8_t *aFrame, uint16_t aFrameLength)
+{
+    sFrameCount = 0;
+    ReceiveFromHost(aFrame, aFrameLength);
+    ProcessNcp(aInstance);
+}
+
+static otInstance *InitNcp(void)
+{
+    otInstance *instance;
+
+#ifdef OPENTHREAD_MULTIPLE_INSTANCE
+    size_t otInstanceBufferLength = 0;
+    uint8_t *otInstanceBuffer = NULL;
+
+    // Call to query the buffer size
+    (void)otInstanceInit(NULL, &otInstanceBufferLength);
+
+    // Call to allocate the buffer
+    otInstanceBuffer = (uint8_t *)malloc(otInstanceBufferLength);
+    VerifyOrQuit(otInstanceBuffer != NULL, "Failed to allocate otInstance.\n");
+
+    // Initialize Openthread with the buffer
+    instance = otInstanceInit(otInstanceBuffer, &otInstanceBufferLength);
+#else
+    instance = otInstanceInit();
+#endif
+
+    VerifyOrQuit(instance != NULL, "Failed to get and init an otInstance.\n");
+
+    testPlatResetToDefaults();
+    g_testPlatUartSend = HandleUartSend;
+    sUartSendPending = false;
+
+    otNcpInit(instance);
+    ProcessNcp(instance);
+    sFrameCount = 0;
+
+    return instance;
+}
+
+static uint16_t PackPropertyGet(uint8_t *aFrame, uint16_t aFrameLength, uint8_t aTid, spinel_prop_key_t aKey)
+{
+    spinel_ssize_t length = spinel_datatype_pack(aFrame, aFrameLength, SPINEL_DATATYPE_COMMAND_PROP_S,
+                                                 SPINEL_HEADER_FLAG | aTid, SPINEL_CMD_PROP_VALUE_GET, aKey);
+
+    VerifyOrQuit(length > 0, "spinel_datatype_pack() failed.\n");
+
+    return static_cast<uint16_t>(length);
+}
+
+static void SendPropertySet(otInstance *aInstance, const char *aFormat, spinel_prop_key_t aKey, unsigned int aValue)
+{
+    char packFormat[8] = SPINEL_DATATYPE_COMMAND_PROP_S;
+    uint8_t frame[16];
+    spinel_ssize_t length;
+
+    strcat(packFormat, aFormat);
+    length = spinel_datatype_pack(frame, sizeof(frame), packFormat, SPINEL_HEADER_FLAG | 1,
+                                  SPINEL_CMD_PROP_VALUE_SET, aKey, aValue);
+    VerifyOrQuit(length > 0, "spinel_datatype_pack() failed.\n");
+
+    SendToNcp(aInstance, frame, static_cast<uint16_t>(length));
+    VerifyOrQuit(sFrameCount == 1, "property set was not answered.\n");
+}
+
+// Enables coalescing without a deadline, so queued frames are sent on the next tasklet run.
+static void EnableCoalescing(otInstance *aInstance)
+{
+    SendPropertySet(aInstance, SPINEL_DATATYPE_UINT16_S, SPINEL_PROP_UART_FRAME_COALESCING_DEADLINE, 0);
+    SendPropertySet(aInstance, SPINEL_DATATYPE_BOOL_S, SPINEL_PROP_UART_FRAME_COALESCING, true);
+}
+
+static uint32_t GetCounter(otInstance *aInstance, spinel_prop_key_t aKey)
+{
+    uint8_t frame[16];
+    uint8_t header;
+    unsigned int command;
+    unsigned int key;
+    uint32_t value = 0;
+
+    SendToNcp(aInstance, frame, PackPropertyGet(frame, sizeof(frame), kCounterTid, aKey));
+
+    VerifyOrQuit(sFrameCount == 1, "counter get was not answered.\n");
+    VerifyOrQuit(spinel_datatype_unpack(sFrames[0].mBuffer, sFrames[0].mLength, "CiiL", &header, &command, &key,
+                                        &value) > 0 && key == aKey,
+                 "failed to parse counter.\n");
+
+    return value;
+}
+
+static void AppendLength(Frame &aFrame, uint16_t aLength)
+{
+    aFrame.mBuffer[aFrame.mLength++] = static_cast<uint8_t>(aLength & 0xff);
+    aFrame.mBuffer[aFrame.mLength++] = static_cast<uint8_t>(aLength >> 8);
+}
+
+static void AppendPropertyGet(Frame &aFrame, uint8_t aTid)
+{
+    uint8_t get[16];
+    uint16_t length = PackPropertyGet(get, sizeof(get), aTid, SPINEL_PROP_PROTOCOL_VERSION);
+
+    AppendLength(aFrame, length);
+    memcpy(aFrame.mBuffer + aFrame.mLength, get, length);
+    aFrame.mLength += length;
+}
+
+static void InitCoalescedFrame(Frame &aFrame)
+{
+    aFrame.mBuffer[0] = SPINEL_FRAME_COALESCED_MARKER;
+    aFrame.mLength = 1;
+}
+
+// Splits a coalesced frame into its spinel frames, checking the marker and each length prefix.
+static uint16_t SplitCoalescedFrame(const Frame &aFrame, SpinelFrame *aSpinelFrames)
+{
+    uint16_t count = 0;
+    uint16_t offset = 1;
+    uint16_t length;
+
+    VerifyOrQuit(aFrame.mLength > 0 && aFrame.mBuffer[0] == SPINEL_FRAME_COALESCED_MARKER,
+                 "frame does not start with the coalesced marker.\n");
+
+    while (offset < aFrame.mLength)
+    {
+        VerifyOrQuit(aFrame.mLength - offset >= 2, "coalesced frame ends in a truncated length prefix.\n");
+
+        length = static_cast<uint16_t>(aFrame.mBuffer[offset] | (aFrame.mBuffer[offset + 1] << 8));
+        offset += 2;
+
+        VerifyOrQuit(length > 0 && length <= aFrame.mLength - offset, "coalesced frame has a bad length prefix.\n");
+        VerifyOrQuit(count < kMaxSpinelFrames, "coalesced frame has too many spinel frames.\n");
+
+        aSpinelFrames[count].mBuffer = aFrame.mBuffer + offset;
+        aSpinelFrames[count].mLength = length;
+        count++;
+        offset += length;
+    }
+
+    return count;
+}
+
+static void VerifyGetResponse(const uint8_t *aFrame, uint16_t aFrameLength, uint8_t aTid)
+{
+    uint8_t header;
+    unsigned int command;
+    unsigned int key;
+
+    VerifyOrQuit(spinel_datatype_unpack(aFrame, aFrameLength, SPINEL_DATATYPE_COMMAND_PROP_S, &header, &command,
+                                        &key) > 0,
+                 "failed to parse response frame.\n");
+    VerifyOrQuit(header == (SPINEL_HEADER_FLAG | aTid), "response has the wrong tid.\n");
+    VerifyOrQuit(command == SPINEL_CMD_PROP_VALUE_IS && key == SPINEL_PROP_PROTOCOL_VERSION,
+                 "unexpected response to a property get.\n");
+}
+
+static void VerifyGetResponse(const Frame &aFrame, uint8_t aTid)
+{
+    VerifyOrQuit(aFrame.mBuffer[0] != SPINEL_FRAME_COALESCED_MARKER, "single response was coalesced.\n");
+    VerifyGetResponse(aFrame.mBuffer, aFrame.mLength, aTid);
+}
+
+// Hands an IPv6 datagram to the stack, which passes a copy to the NCP to send to the host as a STREAM_NET frame.
+static void ReceiveDatagram(otInstance *aInstance, uint8_t aSeed)
+{
+    Message *message = aInstance->mIp6.mMessagePool.New(Message::kTypeIp6, 0);
+    Ip6::Header header;
+    Ip6::UdpHeader udpHeader;
+    Ip6::Address address;
+    uint8_t payload[kDatagramPayloadSize];
+
+    VerifyOrQuit(message != NULL, "Ip6::NewMessage failed.\n");
+
+    header.Init();
+    header.SetPayloadLength(sizeof(udpHeader) + sizeof(payload));
+    header.SetNextHeader(Ip6::kProtoUdp);
+    header.SetHopLimit(64);
+    SuccessOrQuit(address.FromString("fe80::1"), "Address::FromString failed.\n");
+    header.SetSource(address);
+    SuccessOrQuit(address.FromString("ff02::1"), "Address::FromString failed.\n");
+    header.SetDestination(address);
+
+    udpHeader.SetSourcePort(kDatagramPort);
+    udpHeader.SetDestinationPort(kDatagramPort);
+    udpHeader.SetLength(sizeof(udpHeader) + sizeof(payload));
+
+    for (uint16_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = static_cast<uint8_t>(aSeed + i);
+    }
+
+    SuccessOrQuit(message->Append(&header, sizeof(header)), "Message::Append failed.\n");
+    SuccessOrQuit(message->Append(&udpHeader, sizeof(udpHeader)), "Message::Append failed.\n");
+    SuccessOrQuit(message->Append(payload, sizeof(payload)), "Message::Append failed.\n");
+
+    aInstance->mIp6.HandleDatagram(*message, &aInstance->mThreadNetif, aInstance->mThreadNetif.GetInterfaceId(),
+                                   NULL, false);
+}
+
+static void VerifyDatagram(const uint8_t *aFrame, uint16_t aFrameLength, uint8_t aSeed)
+{
+    uint8_t header;
+    unsigned int command;
+    unsigned int key;
+    const uint8_t *datagram;
+    unsigned int datagramLength;
+
+    VerifyOrQuit(spinel_datatype_unpack(aFrame, aFrameLength,
+                                        SPINEL_DATATYPE_COMMAND_PROP_S SPINEL_DATATYPE_DATA_WLEN_S,
+                                        &header, &command, &key, &datagram, &datagramLength) == aFrameLength,
+                 "failed to parse stream frame.\n");
+    VerifyOrQuit(command == SPINEL_CMD_PROP_VALUE_IS && key == SPINEL_PROP_STREAM_NET,
+                 "unexpected stream frame.\n");
+    VerifyOrQuit(datagramLength == kDatagramHeaderSize + kDatagramPayloadSize, "datagram has the wrong length.\n");
+
+    for (uint16_t i = 0; i < kDatagramPayloadSize; i++)
+    {
+        VerifyOrQuit(datagram[kDatagramHeaderSize + i] == static_cast<uint8_t>(aSeed + i),
+                     "datagram payload was corrupted.\n");
+    }
+}
+
+void TestNcpUartReceiveFrame(void)
+{
+    otInstance *instance = InitNcp();
+    uint8_t frame[16];
+
+    // A frame without the marker is a single spinel frame, and is answered as one.
+    SendToNcp(instance, frame, PackPropertyGet(frame, sizeof(frame), 1, SPINEL_PROP_PROTOCOL_VERSION));
+
+    VerifyOrQuit(sFrameCount == 1, "TestNcpUartReceiveFrame: get was not answered.\n");
+    VerifyGetResponse(sFrames[0], 1);
+
+    VerifyOrQuit(GetCounter(instance, SPINEL_PROP_CNTR_RX_SPINEL_ERR) == 0,
+                 "TestNcpUartReceiveFrame: frame was counted as an error.\n");
+
+    otInstanceFinalize(instance);
+}
+
+void TestNcpUartReceiveCoalesced(void)
+{
+    otInstance *instance = InitNcp();
+    Frame frame;
+
+    // Each spinel frame of a coalesced frame is handled in order. Without coalescing enabled on the NCP, each response
+    // is sent in its own frame.
+    InitCoalescedFrame(frame);
+    AppendPropertyGet(frame, 1);
+    AppendPropertyGet(frame, 2);
+    AppendPropertyGet(frame, 3);
+    SendToNcp(instance, frame.mBuffer, frame.mLength);
+
+    VerifyOrQuit(sFrameCount == 3, "TestNcpUartReceiveCoalesced: gets were not all answered.\n");
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        VerifyGetResponse(sFrames[i], i + 1);
+    }
+
+    VerifyOrQuit(GetCounter(instance, SPINEL_PROP_CNTR_RX_SPINEL_ERR) == 0,
+                 "TestNcpUartReceiveCoalesced: frame was counted as an error.\n");
+
+    otInstanceFinalize(instance);
+}
+
+void TestNcpUartReceiveMalformed(void)
+{
+    otInstance *instance = InitNcp();
+    Frame frame;
+    uint16_t prefix;
+    uint32_t errors;
+
+    for (uint8_t test = 0; test < 3; test++)
+    {
+        InitCoalescedFrame(frame);
+        AppendPropertyGet(frame, 1);
+
+        switch (test)
+        {
+        case 0:
+            // A zero-length spinel frame.
+            AppendLength(frame, 0);
+            AppendPropertyGet(frame, 2);
+            break;
+
+        case 1:
+            // A spinel frame longer than the rest of the frame.
+            prefix = frame.mLength;
+            AppendPropertyGet(frame, 2);
+            frame.mBuffer[prefix]++;
+            break;
+
+        case 2:
+            // A truncated length prefix.
+            frame.mBuffer[frame.mLength++] = 0x01;
+            break;
+        }
+
+        errors = GetCounter(instance, SPINEL_PROP_CNTR_RX_SPINEL_ERR);
+        SendToNcp(instance, frame.mBuffer, frame.mLength);
+
+        // The spinel frames before the error are handled, and the rest of the frame is dropped.
+        VerifyOrQuit(sFrameCount == 1, "TestNcpUartReceiveMalformed: frame after the error was handled.\n");
+        VerifyGetResponse(sFrames[0], 1);
+
+        VerifyOrQuit(GetCounter(instance, SPINEL_PROP_CNTR_RX_SPINEL_ERR) == errors + 1,
+                     "TestNcpUartReceiveMalformed: error was not counted.\n");
+    }
+
+    otInstanceFinalize(instance);
+}
+
+void TestNcpUartSendCoalesced(void)
+{
+    otInstance *instance = InitNcp();
+    Frame frame;
+    SpinelFrame spinelFrames[kMaxSpinelFrames];
+    uint8_t get[16];
+
+    EnableCoalescing(instance);
+
+    // Responses queued together are sent in one coalesced frame.
+    InitCoalescedFrame(frame);
+
+    for (uint8_t tid = 1; tid <= 5; tid++)
+    {
+        AppendPropertyGet(frame, tid);
+    }
+
+    SendToNcp(instance, frame.mBuffer, frame.mLength);
+
+    VerifyOrQuit(sFrameCount == 1, "TestNcpUartSendCoalesced: responses were not coalesced.\n");
+    VerifyOrQuit(SplitCoalescedFrame(sFrames[0], spinelFrames) == 5,
+                 "TestNcpUartSendCoalesced: coalesced frame has the wrong number of spinel frames.\n");
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        VerifyGetResponse(spinelFrames[i].mBuffer, spinelFrames[i].mLength, i + 1);
+    }
+
+    VerifyOrQuit(GetCounter(instance, SPINEL_PROP_CNTR_TX_SPINEL_COALESCED) == 5,
+                 "TestNcpUartSendCoalesced: coalesced spinel frames were not counted.\n");
+
+    // A lone response is sent as a plain frame.
+    SendToNcp(instance, get, PackPropertyGet(get, sizeof(get), 6, SPINEL_PROP_PROTOCOL_VERSION));
+
+    VerifyOrQuit(sFrameCount == 1, "TestNcpUartSendCoalesced: get was not answered.\n");
+    VerifyGetResponse(sFrames[0], 6);
+
+    otInstanceFinalize(instance);
+}
+
+void TestNcpUartSendSizeLimit(void)
+{
+    otInstance *instance = InitNcp();
+    SpinelFrame spinelFrames[kMaxSpinelFrames];
+    uint8_t get[16];
+
+    EnableCoalescing(instance);
+    sFrameCount = 0;
+
+    // Queue a response and two datagrams, and only then let the NCP send. The second datagram does not fit in the
+    // coalesced frame, and is sent in a frame of its own.
+    ReceiveFromHost(get, PackPropertyGet(get, sizeof(get), 1, SPINEL_PROP_PROTOCOL_VERSION));
+    ReceiveDatagram(instance, 0x10);
+    ReceiveDatagram(instance, 0x20);
+    ProcessNcp(instance);
+
+    VerifyOrQuit(sFrameCount == 2, "TestNcpUartSendSizeLimit: frames were not split at the size limit.\n");
+    VerifyOrQuit(SplitCoalescedFrame(sFrames[0], spinelFrames) == 2,
+                 "TestNcpUartSendSizeLimit: coalesced frame has the wrong number of spinel frames.\n");
+    VerifyGetResponse(spinelFrames[0].mBuffer, spinelFrames[0].mLength, 1);
+    VerifyDatagram(spinelFrames[1].mBuffer, spinelFrames[1].mLength, 0x10);
+
+    VerifyOrQuit(sFrames[1].mBuffer[0] != SPINEL_FRAME_COALESCED_MARKER,
+                 "TestNcpUartSendSizeLimit: last datagram was coalesced.\n");
+    VerifyDatagram(sFrames[1].mBuffer, sFrames[1].mLength, 0x20);
+
+    // Appending the second datagram would have exceeded the limit.
+    VerifyOrQuit(sFrames[0].mLength + 2 + sFrames[1].mLength > SPINEL_FRAME_MAX_SIZE,
+                 "TestNcpUartSendSizeLimit: datagrams are too small for the test.\n");
+
+    otInstanceFinalize(instance);
+}
+
+}  // namespace Thread
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    Thread::TestNcpUartReceiveFrame();
+    Thread::TestNcpUartReceiveCoalesced();
+    Thread::TestNcpUartReceiveMalformed();
+    Thread::TestNcpUartSendCoalesced();
+    Thread::TestNcpUartSendSizeLimit();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
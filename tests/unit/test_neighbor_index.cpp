@@ -0,0 +1,160 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_util.h"
+#include "openthread/openthread.h"
+#include <common/encoding.hpp>
+#include <thread/neighbor_index.hpp>
+
+#include <string.h>
+
+using Thread::Encoding::BigEndian::HostSwap16;
+
+namespace Thread {
+
+static Child sChildren[Mle::kMaxChildren];
+static Router sRouters[Mle::kMaxRouterId + 1];
+
+static void SetExtAddress(Neighbor &aNeighbor, uint8_t aValue)
+{
+    memset(&aNeighbor.mMacAddr, aValue, sizeof(aNeighbor.mMacAddr));
+}
+
+static void SetIp6Address(Ip6::Address &aAddress, uint8_t aValue)
+{
+    memset(&aAddress, 0, sizeof(aAddress));
+    aAddress.mFields.m16[0] = HostSwap16(0xfd00);
+    aAddress.mFields.m8[15] = aValue;
+}
+
+void TestNeighborIndex(void)
+{
+    NeighborIndex index(sChildren, sRouters);
+    Mac::ExtAddress extAddress;
+    Ip6::Address address;
+
+    memset(sChildren, 0, sizeof(sChildren));
+    memset(sRouters, 0, sizeof(sRouters));
+
+    // Index every child with distinct keys.
+    for (uint8_t i = 0; i < Mle::kMaxChildren; i++)
+    {
+        Child &child = sChildren[i];
+
+        SetExtAddress(child, 0x10 + i);
+        child.mValid.mRloc16 = 0x0400 | (i + 1);
+        SetIp6Address(child.mIp6Address[0], i + 1);
+        child.mState = Neighbor::kStateValid;
+        index.UpdateChild(child);
+    }
+
+    for (uint8_t i = 0; i < Mle::kMaxChildren; i++)
+    {
+        Child &child = sChildren[i];
+
+        VerifyOrQuit(index.FindChild(static_cast<uint16_t>(0x0400 | (i + 1)), NeighborIndex::kInStateValid) == &child,
+                     "TestNeighborIndex: FindChild(rloc16) failed\n");
+        VerifyOrQuit(index.FindChild(child.mMacAddr, NeighborIndex::kInStateValid) == &child,
+                     "TestNeighborIndex: FindChild(extaddr) failed\n");
+
+        SetIp6Address(address, i + 1);
+        VerifyOrQuit(index.FindChild(address, NeighborIndex::kInStateValid) == &child,
+                     "TestNeighborIndex: FindChild(ip6) failed\n");
+    }
+
+    VerifyOrQuit(index.FindChild(static_cast<uint16_t>(0x0800), NeighborIndex::kInStateValid) == NULL,
+                 "TestNeighborIndex: FindChild(rloc16) found an unknown key\n");
+
+    memset(&address, 0, sizeof(address));
+    VerifyOrQuit(index.FindChild(address, NeighborIndex::kInStateAnyExceptInvalid) == NULL,
+                 "TestNeighborIndex: FindChild(ip6) matched the unspecified address\n");
+
+    // State filters are applied on lookup without re-indexing.
+    sChildren[0].mState = Neighbor::kStateRestored;
+    VerifyOrQuit(index.FindChild(sChildren[0].mMacAddr, NeighborIndex::kInStateValid) == NULL,
+                 "TestNeighborIndex: kInStateValid accepted a restored child\n");
+    VerifyOrQuit(index.FindChild(sChildren[0].mMacAddr, NeighborIndex::kInStateValidOrRestoring) == &sChildren[0],
+                 "TestNeighborIndex: kInStateValidOrRestoring rejected a restored child\n");
+
+    sChildren[0].mState = Neighbor::kStateParentRequest;
+    VerifyOrQuit(index.FindChild(sChildren[0].mMacAddr, NeighborIndex::kInStateValidOrRestoring) == NULL,
+                 "TestNeighborIndex: kInStateValidOrRestoring accepted a pending child\n");
+    VerifyOrQuit(index.FindChild(sChildren[0].mMacAddr, NeighborIndex::kInStateAnyExceptInvalid) == &sChildren[0],
+                 "TestNeighborIndex: kInStateAnyExceptInvalid rejected a pending child\n");
+
+    // Re-keying a child drops its previous keys.
+    SetExtAddress(sChildren[1], 0xee);
+    SetIp6Address(sChildren[1].mIp6Address[0], 0xee);
+    index.UpdateChild(sChildren[1]);
+
+    SetExtAddress(sChildren[2], 0x11);
+    index.UpdateChild(sChildren[2]);
+
+    memset(&extAddress, 0x11, sizeof(extAddress));
+    VerifyOrQuit(index.FindChild(extAddress, NeighborIndex::kInStateValid) == &sChildren[2],
+                 "TestNeighborIndex: FindChild(extaddr) returned a stale entry\n");
+
+    SetIp6Address(address, 2);
+    VerifyOrQuit(index.FindChild(address, NeighborIndex::kInStateValid) == NULL,
+                 "TestNeighborIndex: FindChild(ip6) returned a stale entry\n");
+
+    SetIp6Address(address, 0xee);
+    VerifyOrQuit(index.FindChild(address, NeighborIndex::kInStateValid) == &sChildren[1],
+                 "TestNeighborIndex: FindChild(ip6) missed a re-keyed entry\n");
+
+    // Duplicate keys resolve to the lowest index, like the linear scan.
+    SetExtAddress(sChildren[Mle::kMaxChildren - 1], 0xee);
+    index.UpdateChild(sChildren[Mle::kMaxChildren - 1]);
+    memset(&extAddress, 0xee, sizeof(extAddress));
+    VerifyOrQuit(index.FindChild(extAddress, NeighborIndex::kInStateValid) == &sChildren[1],
+                 "TestNeighborIndex: FindChild(extaddr) did not prefer the lowest index\n");
+
+    // Routers share the extended address key space with children but are looked up separately.
+    SetExtAddress(sRouters[5], 0xee);
+    sRouters[5].mState = Neighbor::kStateValid;
+    index.UpdateRouter(sRouters[5]);
+    VerifyOrQuit(index.FindRouter(extAddress, NeighborIndex::kInStateValid) == &sRouters[5],
+                 "TestNeighborIndex: FindRouter(extaddr) failed\n");
+
+    index.Clear();
+    VerifyOrQuit(index.FindRouter(extAddress, NeighborIndex::kInStateValid) == NULL,
+                 "TestNeighborIndex: Clear() left a router entry\n");
+    VerifyOrQuit(index.FindChild(extAddress, NeighborIndex::kInStateValid) == NULL,
+                 "TestNeighborIndex: Clear() left a child entry\n");
+}
+
+}  // namespace Thread
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    Thread::TestNeighborIndex();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
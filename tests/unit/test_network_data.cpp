@@ -0,0 +1,379 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_util.h"
+#include "openthread/openthread.h"
+#include "openthread/platform/random.h"
+#include <net/ip6.hpp>
+#include <thread/network_data_tlvs.hpp>
+#include <thread/thread_netif.hpp>
+
+#include <string.h>
+#include <time.h>
+
+namespace Thread {
+
+static Ip6::Ip6 sIp6;
+static ThreadNetif sThreadNetif(sIp6);
+
+enum
+{
+    kMaxTestPrefixes = 32,
+    kNoContext       = 0xff,
+    kContextCompress = 1 << 4,  // Context TLV Compress flag.
+};
+
+// This struct describes a prefix of the test Network Data.
+struct TestPrefix
+{
+    uint8_t mPrefix[8];
+    uint8_t mLength;
+    uint8_t mContextId;
+    bool    mHasBorderRouter;
+    bool    mHasRoute;
+};
+
+static const uint8_t sMeshLocalPrefix[] = {0xfd, 0x00, 0xca, 0xfe, 0xfa, 0xce, 0x12, 0x34};
+
+static TestPrefix sPrefixes[kMaxTestPrefixes];
+static uint8_t sNumPrefixes;
+static uint8_t sNetworkData[NetworkData::NetworkData::kMaxSize];
+static uint8_t sNetworkDataLength;
+
+static void AppendByte(uint8_t aByte)
+{
+    sNetworkData[sNetworkDataLength++] = aByte;
+}
+
+// Fills the Network Data with prefixes of 16 to 64 bits, many of them nested, until it is full. Every third prefix
+// carries a Context TLV, every third a Border Router TLV and every third a Has Route TLV.
+static void BuildNetworkData(void)
+{
+    uint8_t contextId = 1;
+
+    sNumPrefixes = 0;
+    sNetworkDataLength = 0;
+
+    for (uint8_t i = 0; sNumPrefixes < kMaxTestPrefixes; i++)
+    {
+        TestPrefix &prefix = sPrefixes[sNumPrefixes];
+        uint8_t prefixBytes;
+        uint8_t subTlvLength;
+
+        memset(&prefix, 0, sizeof(prefix));
+        prefix.mPrefix[0] = 0x20;
+        prefix.mPrefix[1] = 0x01;
+        prefix.mPrefix[2] = i % 4;
+        prefix.mPrefix[3] = i % 8;
+        prefix.mPrefix[4] = i;
+        prefix.mLength = static_cast<uint8_t>(16 + 8 * (i % 3) + 16 * (i % 2));
+        prefix.mContextId = kNoContext;
+
+        switch (i % 3)
+        {
+        case 0:
+            prefix.mContextId = contextId;
+            contextId = (contextId % 15) + 1;
+            subTlvLength = 2 + 2;
+            break;
+
+        case 1:
+            prefix.mHasBorderRouter = true;
+            subTlvLength = 2 + sizeof(NetworkData::BorderRouterEntry);
+            break;
+
+        default:
+            prefix.mHasRoute = true;
+            subTlvLength = 2 + sizeof(NetworkData::HasRouteEntry);
+            break;
+        }
+
+        prefixBytes = (prefix.mLength + 7) / 8;
+
+        if (sNetworkDataLength + 4 + prefixBytes + subTlvLength > NetworkData::NetworkData::kMaxSize)
+        {
+            break;
+        }
+
+        AppendByte((NetworkData::NetworkDataTlv::kTypePrefix << 1) | 1);
+        AppendByte(2 + prefixBytes + subTlvLength);
+        AppendByte(0);
+        AppendByte(prefix.mLength);
+
+        for (uint8_t j = 0; j < prefixBytes; j++)
+        {
+            AppendByte(prefix.mPrefix[j]);
+        }
+
+        if (prefix.mContextId != kNoContext)
+        {
+            AppendByte((NetworkData::NetworkDataTlv::kTypeContext << 1) | 1);
+            AppendByte(2);
+            AppendByte(kContextCompress | prefix.mContextId);
+            AppendByte(prefix.mLength);
+        }
+        else if (prefix.mHasBorderRouter)
+        {
+            AppendByte((NetworkData::NetworkDataTlv::kTypeBorderRouter << 1) | 1);
+            AppendByte(sizeof(NetworkData::BorderRouterEntry));
+            AppendByte(0x04);
+            AppendByte(i);
+            AppendByte(NetworkData::BorderRouterEntry::kOnMeshFlag | NetworkData::BorderRouterEntry::kDefaultRouteFlag);
+            AppendByte(0);
+        }
+        else
+        {
+            AppendByte((NetworkData::NetworkDataTlv::kTypeHasRoute << 1) | 1);
+            AppendByte(sizeof(NetworkData::HasRouteEntry));
+            AppendByte(0x08);
+            AppendByte(i);
+            AppendByte(0);
+        }
+
+        sNumPrefixes++;
+    }
+}
+
+static bool PrefixMatches(const TestPrefix &aPrefix, const Ip6::Address &aAddress)
+{
+    for (uint8_t bit = 0; bit < aPrefix.mLength; bit++)
+    {
+        uint8_t mask = static_cast<uint8_t>(0x80 >> (bit % 8));
+
+        if ((aPrefix.mPrefix[bit / 8] & mask) != (aAddress.mFields.m8[bit / 8] & mask))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Returns the Context ID of the longest matching prefix with a context, the first one in Network Data order on ties.
+static uint8_t ExpectedContextId(const Ip6::Address &aAddress)
+{
+    uint8_t length = 0;
+    uint8_t rval = kNoContext;
+
+    if (memcmp(aAddress.mFields.m8, sMeshLocalPrefix, sizeof(sMeshLocalPrefix)) == 0)
+    {
+        length = 64;
+        rval = 0;
+    }
+
+    for (uint8_t i = 0; i < sNumPrefixes; i++)
+    {
+        if (sPrefixes[i].mContextId != kNoContext && sPrefixes[i].mLength > length &&
+            PrefixMatches(sPrefixes[i], aAddress))
+        {
+            length = sPrefixes[i].mLength;
+            rval = sPrefixes[i].mContextId;
+        }
+    }
+
+    return rval;
+}
+
+static bool ExpectedOnMesh(const Ip6::Address &aAddress)
+{
+    if (memcmp(aAddress.mFields.m8, sMeshLocalPrefix, sizeof(sMeshLocalPrefix)) == 0)
+    {
+        return true;
+    }
+
+    for (uint8_t i = 0; i < sNumPrefixes; i++)
+    {
+        if (sPrefixes[i].mHasBorderRouter && PrefixMatches(sPrefixes[i], aAddress))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Picks an address under one of the prefixes, with random bits after the first 16 so that nested prefixes, sibling
+// prefixes and no prefix at all are all exercised.
+static void RandomAddress(Ip6::Address &aAddress)
+{
+    const TestPrefix &prefix = sPrefixes[otPlatRandomGet() % sNumPrefixes];
+
+    for (uint8_t i = 0; i < sizeof(aAddress.mFields.m8); i++)
+    {
+        aAddress.mFields.m8[i] = static_cast<uint8_t>(otPlatRandomGet());
+    }
+
+    memcpy(aAddress.mFields.m8, prefix.mPrefix, (otPlatRandomGet() % 2) ? 2 : sizeof(prefix.mPrefix));
+}
+
+void TestNetworkDataLookup(void)
+{
+    NetworkData::Leader &leader = sThreadNetif.GetNetworkDataLeader();
+    Lowpan::Context context;
+    Ip6::Address address;
+    uint8_t networkData[NetworkData::NetworkData::kMaxSize];
+    uint8_t expected;
+
+    sThreadNetif.GetMle().SetMeshLocalPrefix(sMeshLocalPrefix);
+
+    BuildNetworkData();
+    VerifyOrQuit(sNumPrefixes >= 16, "TestNetworkDataLookup: too few prefixes in the test Network Data\n");
+
+    leader.SetNetworkData(1, 1, false, sNetworkData, sNetworkDataLength);
+
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        RandomAddress(address);
+        expected = ExpectedContextId(address);
+
+        if (expected == kNoContext)
+        {
+            VerifyOrQuit(leader.GetContext(address, context) != kThreadError_None,
+                         "TestNetworkDataLookup: GetContext() matched an unknown prefix\n");
+        }
+        else
+        {
+            SuccessOrQuit(leader.GetContext(address, context), "TestNetworkDataLookup: GetContext() failed\n");
+            VerifyOrQuit(context.mContextId == expected, "TestNetworkDataLookup: GetContext() wrong context\n");
+        }
+
+        VerifyOrQuit(leader.IsOnMesh(address) == ExpectedOnMesh(address),
+                     "TestNetworkDataLookup: IsOnMesh() mismatch\n");
+    }
+
+    for (uint8_t i = 0; i < sNumPrefixes; i++)
+    {
+        if (sPrefixes[i].mContextId == kNoContext)
+        {
+            continue;
+        }
+
+        SuccessOrQuit(leader.GetContext(sPrefixes[i].mContextId, context),
+                      "TestNetworkDataLookup: GetContext(id) failed\n");
+        VerifyOrQuit(context.mPrefixLength == sPrefixes[i].mLength,
+                     "TestNetworkDataLookup: GetContext(id) wrong prefix\n");
+    }
+
+    // New Network Data with the same version and length must not be served from the old compiled view.
+    memcpy(networkData, sNetworkData, sNetworkDataLength);
+    networkData[4 + (sPrefixes[0].mLength + 7) / 8 + 2] = kContextCompress | 15;
+    leader.SetNetworkData(1, 1, false, networkData, sNetworkDataLength);
+
+    VerifyOrQuit(leader.GetContext(sPrefixes[0].mContextId, context) != kThreadError_None,
+                 "TestNetworkDataLookup: stale compiled view after SetNetworkData()\n");
+    SuccessOrQuit(leader.GetContext(15, context), "TestNetworkDataLookup: GetContext(id) failed\n");
+
+    leader.SetNetworkData(1, 1, false, networkData, 0);
+    memcpy(address.mFields.m8, sPrefixes[0].mPrefix, sizeof(sPrefixes[0].mPrefix));
+    VerifyOrQuit(leader.GetContext(address, context) != kThreadError_None,
+                 "TestNetworkDataLookup: stale compiled view after clearing the Network Data\n");
+}
+
+/**
+ * Report the per-lookup cost of the Network Data queries made per packet, and the cost of recompiling after a
+ * Network Data version change.
+ */
+void TestNetworkDataLookupPerformance(void)
+{
+    const uint32_t kNumLookups = 200000;
+    const uint32_t kNumCompiles = 20000;
+    NetworkData::Leader &leader = sThreadNetif.GetNetworkDataLeader();
+    Lowpan::Context context;
+    Ip6::Address addresses[64];
+    uint8_t prefixMatch;
+    uint16_t rloc16;
+    volatile uint32_t sink = 0;
+    clock_t start;
+    double getContext;
+    double isOnMesh;
+    double routeLookup;
+    double compile;
+
+    sThreadNetif.GetMle().SetMeshLocalPrefix(sMeshLocalPrefix);
+    BuildNetworkData();
+    leader.SetNetworkData(1, 1, false, sNetworkData, sNetworkDataLength);
+
+    for (uint8_t i = 0; i < sizeof(addresses) / sizeof(addresses[0]); i++)
+    {
+        RandomAddress(addresses[i]);
+    }
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        sink += (leader.GetContext(addresses[i % 64], context) == kThreadError_None);
+    }
+
+    getContext = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        sink += leader.IsOnMesh(addresses[i % 64]);
+    }
+
+    isOnMesh = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumLookups; i++)
+    {
+        sink += (leader.RouteLookup(addresses[i % 64], addresses[(i + 1) % 64], &prefixMatch, &rloc16) ==
+                 kThreadError_None);
+    }
+
+    routeLookup = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumCompiles; i++)
+    {
+        leader.SetNetworkData(static_cast<uint8_t>(i), 1, false, sNetworkData, sNetworkDataLength);
+        sink += (leader.GetContext(addresses[i % 64], context) == kThreadError_None);
+    }
+
+    compile = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("TestNetworkDataLookupPerformance: %u prefixes, GetContext %.1f ns, IsOnMesh %.1f ns, "
+           "RouteLookup %.1f ns, update+recompile %.1f ns\n", sNumPrefixes,
+           getContext * 1e9 / kNumLookups, isOnMesh * 1e9 / kNumLookups, routeLookup * 1e9 / kNumLookups,
+           compile * 1e9 / kNumCompiles);
+
+    (void)sink;
+}
+
+}  // namespace Thread
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    Thread::TestNetworkDataLookup();
+    Thread::TestNetworkDataLookupPerformance();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -57,6 +57,10 @@ testPlatRadioReceive            g_testPlatRadioReceive = NULL;
 testPlatRadioTransmit           g_testPlatRadioTransmit = NULL;
 testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer = NULL;
 
+testPlatSettingsGet             g_testPlatSettingsGet = NULL;
+
+testPlatUartSend                g_testPlatUartSend = NULL;
+
 void testPlatResetToDefaults(void)
 {
     g_testPlatAlarmSet = false;
@@ -75,6 +79,10 @@ void testPlatResetToDefaults(void)
     g_testPlatRadioReceive = NULL;
     g_testPlatRadioTransmit = NULL;
     g_testPlatRadioGetTransmitBuffer = NULL;
+
+    g_testPlatSettingsGet = NULL;
+
+    g_testPlatUartSend = NULL;
 }
 
 bool sDiagMode = false;
@@ -359,10 +367,10 @@ exit:
     // Diag
     //
 
-    void otPlatDiagProcess(int argc, char *argv[], char *aOutput)
+    void otPlatDiagProcess(otInstance *, int argc, char *argv[], char *aOutput, size_t aOutputMaxLen)
     {
         // no more diagnostics features for Posix platform
-        sprintf(aOutput, "diag feature '%s' is not supported\r\n", argv[0]);
+        snprintf(aOutput, aOutputMaxLen, "diag feature '%s' is not supported\r\n", argv[0]);
         (void)argc;
     }
 
@@ -376,15 +384,19 @@ exit:
         return sDiagMode;
     }
 
-    void otPlatDiagAlarmFired(otInstance *)
+    void otPlatDiagChannelSet(uint8_t)
     {
     }
 
-    void otPlatDiagRadioTransmitDone(otInstance *, RadioPacket *, bool, ThreadError)
+    void otPlatDiagTxPowerSet(int8_t)
     {
     }
 
-    void otPlatDiagRadioReceiveDone(otInstance *, RadioPacket *, ThreadError)
+    void otPlatDiagRadioReceived(otInstance *, RadioPacket *, ThreadError)
+    {
+    }
+
+    void otPlatDiagAlarmCallback(otInstance *)
     {
     }
 
@@ -392,12 +404,26 @@ exit:
     // Uart
     //
 
-    void otPlatUartSendDone(void)
+    ThreadError otPlatUartEnable(void)
     {
+        return kThreadError_None;
     }
 
-    void otPlatUartReceived(const uint8_t *, uint16_t)
+    ThreadError otPlatUartDisable(void)
     {
+        return kThreadError_None;
+    }
+
+    ThreadError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
+    {
+        if (g_testPlatUartSend)
+        {
+            return g_testPlatUartSend(aBuf, aBufLength);
+        }
+        else
+        {
+            return kThreadError_None;
+        }
     }
 
     //
@@ -452,13 +478,14 @@ exit:
     ThreadError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue,
                                   uint16_t *aValueLength)
     {
-        (void)aInstance;
-        (void)aKey;
-        (void)aIndex;
-        (void)aValue;
-        (void)aValueLength;
-
-        return kThreadError_None;
+        if (g_testPlatSettingsGet)
+        {
+            return g_testPlatSettingsGet(aInstance, aKey, aIndex, aValue, aValueLength);
+        }
+        else
+        {
+            return kThreadError_None;
+        }
     }
 
     ThreadError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
@@ -43,6 +43,7 @@
 #include "openthread/platform/misc.h"
 #include "openthread/platform/radio.h"
 #include "openthread/platform/random.h"
+#include "openthread/platform/uart.h"
 
 #include <common/code_utils.hpp>
 
@@ -88,6 +89,22 @@ extern testPlatRadioReceive             g_testPlatRadioReceive;
 extern testPlatRadioTransmit            g_testPlatRadioTransmit;
 extern testPlatRadioGetTransmitBuffer   g_testPlatRadioGetTransmitBuffer;
 
+//
+// Settings Platform
+//
+
+typedef ThreadError(*testPlatSettingsGet)(otInstance *, uint16_t, int, uint8_t *, uint16_t *);
+
+extern testPlatSettingsGet              g_testPlatSettingsGet;
+
+//
+// Uart Platform
+//
+
+typedef ThreadError(*testPlatUartSend)(const uint8_t *, uint16_t);
+
+extern testPlatUartSend                 g_testPlatUartSend;
+
 // Resets platform functions to defaults
 void testPlatResetToDefaults(void);
 
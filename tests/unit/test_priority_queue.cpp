@@ -394,6 +394,7 @@ void TestPriorityQueue(void)
     VerifyAllMessagesContent(messagePool, 2, msgLow[1], msgLow[0]);
     VerifyPriorityQueueContent(queue, 1, msgLow[0]);
     VerifyMsgQueueContent(messageQueue, 1, msgLow[1]);
+
 }
 
 #ifdef ENABLE_TEST_MAIN
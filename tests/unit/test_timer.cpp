@@ -26,8 +26,11 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <time.h>
+
 #include "test_platform.h"
 #include <common/debug.hpp>
+#include <common/new.hpp>
 #include <common/timer.hpp>
 #include <openthread-instance.h>
 
@@ -321,10 +324,10 @@ int TestTenTimers(void)
         3,
         4,
         5,
+        6,
         7,
-        9,
-        11,
-        11
+        8,
+        8
     };
 
     otInstance aInstance;
@@ -373,17 +376,8 @@ int TestTenTimers(void)
     {
         sNow = kTriggerTimes[trigger];
 
-        do
-        {
-            // By design, each call to otPlatAlarmFired() can result in 0 or 1 calls to a timer handler.
-            // For some combinations of sNow and Timers queued, it is necessary to call otPlatAlarmFired()
-            // multiple times in order to handle all the expired timers.  It can be determined that another
-            // timer is ready to be triggered by examining the aDt arg passed into otPlatAlarmStartAt().  If
-            // that value is 0, then otPlatAlarmFired should be fired immediately. This loop calls otPlatAlarmFired()
-            // the requisite number of times based on the aDt argument.
-            otPlatAlarmFired(&aInstance);
-        }
-        while (sPlatDt == 0);
+        // Each call to otPlatAlarmFired() fires all the expired timers and re-arms the platform alarm once.
+        otPlatAlarmFired(&aInstance);
 
         VerifyOrQuit(sCallCount[kCallCountIndexAlarmStart]    == kTimerStartCountAfterTrigger[trigger],
                      "TestTenTimer: Start CallCount Failed.\n");
@@ -408,10 +402,131 @@ int TestTenTimers(void)
     return 0;
 }
 
+enum
+{
+    kNumManyTimers = 1000,
+};
+
+uint32_t sLastFireTime;
+uint32_t sFireOrderErrors;
+
+void TestManyTimersHandler(void *aContext)
+{
+    const Thread::Timer *timer = static_cast<const Thread::Timer *>(aContext);
+    uint32_t fireTime = timer->Gett0() + timer->Getdt();
+
+    if (fireTime < sLastFireTime)
+    {
+        sFireOrderErrors++;
+    }
+
+    sLastFireTime = fireTime;
+    sCallCount[kCallCountIndexTimerHandler]++;
+}
+
+uint32_t ManyTimersRandom(uint32_t &aSeed)
+{
+    aSeed = aSeed * 1103515245u + 12345u;
+    return aSeed >> 8;
+}
+
+/**
+ * Test the TimerScheduler's ordering with a large number of timers that are repeatedly restarted and stopped,
+ * and report the average cost of the scheduler operations.
+ */
+int TestManyTimers(void)
+{
+    const uint32_t kTimeT0 = 1000;
+    const uint32_t kNumOperations = 100000;
+    otInstance aInstance;
+    uint64_t storage[(kNumManyTimers * sizeof(Thread::Timer) + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    Thread::Timer *timers = reinterpret_cast<Thread::Timer *>(storage);
+    uint32_t seed = 1;
+    uint32_t numRunning = 0;
+    clock_t start;
+    double elapsed;
+
+    InitTestTimer();
+    InitCounters();
+
+    sNow = kTimeT0;
+    sLastFireTime = 0;
+    sFireOrderErrors = 0;
+
+    for (uint32_t i = 0; i < kNumManyTimers; i++)
+    {
+        new(&timers[i]) Thread::Timer(aInstance.mIp6.mTimerScheduler, TestManyTimersHandler, &timers[i]);
+        timers[i].Start(1 + ManyTimersRandom(seed) % 60000);
+    }
+
+    start = clock();
+
+    for (uint32_t i = 0; i < kNumOperations; i++)
+    {
+        Thread::Timer &timer = timers[ManyTimersRandom(seed) % kNumManyTimers];
+
+        if (ManyTimersRandom(seed) % 4 == 0)
+        {
+            timer.Stop();
+            VerifyOrQuit(timer.IsRunning() == false, "TestManyTimers: Timer running Failed.\n");
+        }
+        else
+        {
+            timer.Start(1 + ManyTimersRandom(seed) % 60000);
+            VerifyOrQuit(timer.IsRunning(), "TestManyTimers: Timer running Failed.\n");
+        }
+    }
+
+    elapsed = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    printf("TestManyTimers: %u start/stop operations over %u timers: %.1f ns/op\n",
+           kNumOperations, kNumManyTimers, elapsed * 1e9 / kNumOperations);
+
+    for (uint32_t i = 0; i < kNumManyTimers; i++)
+    {
+        if (timers[i].IsRunning())
+        {
+            numRunning++;
+        }
+    }
+
+    // Advance time past every deadline. Each alarm fires a bounded number of expired timers and re-arms the
+    // platform alarm with a zero delay while more remain.
+
+    sNow += 60001;
+
+    for (uint32_t alarms = 1; ; alarms++)
+    {
+        otPlatAlarmFired(&aInstance);
+        VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] <= alarms * OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM,
+                     "TestManyTimers: Fire limit Failed.\n");
+
+        if (!sTimerOn)
+        {
+            break;
+        }
+
+        VerifyOrQuit(sPlatDt == 0, "TestManyTimers: Start params Failed.\n");
+    }
+
+    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == numRunning, "TestManyTimers: Handler CallCount Failed.\n");
+    VerifyOrQuit(aInstance.mIp6.mTimerScheduler.GetCounters().mMaxTimersPerAlarm ==
+                 OPENTHREAD_CONFIG_MAX_TIMERS_FIRED_PER_ALARM, "TestManyTimers: Counters Failed.\n");
+    VerifyOrQuit(sFireOrderErrors == 0, "TestManyTimers: Fire order Failed.\n");
+    VerifyOrQuit(sTimerOn == false, "TestManyTimers: Platform Timer State Failed.\n");
+
+    for (uint32_t i = 0; i < kNumManyTimers; i++)
+    {
+        VerifyOrQuit(timers[i].IsRunning() == false, "TestManyTimers: Timer running Failed.\n");
+    }
+
+    return 0;
+}
+
 void RunTimerTests(void)
 {
     TestOneTimer();
     TestTenTimers();
+    TestManyTimers();
 }
 
 #ifdef ENABLE_TEST_MAIN
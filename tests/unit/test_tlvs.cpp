@@ -0,0 +1,311 @@
+/*
+ *  Copyright (c) 2016, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_util.h"
+#include "openthread/openthread.h"
+#include <openthread-instance.h>
+#include <common/message.hpp>
+#include <common/tlvs.hpp>
+#include <string.h>
+
+enum
+{
+    kHeaderSize       = 3,     ///< Bytes before the message offset, which the TLV lookups must skip.
+    kMaxTlvLength     = 254,   ///< Longest value that does not need the extended length format.
+    kExtendedValueLen = 300,
+    kMaxMessageLength = 512,
+};
+
+struct TlvBuffer
+{
+    uint8_t  mBytes[kMaxMessageLength];
+    uint16_t mLength;
+};
+
+static void InitTlvBuffer(TlvBuffer &aBuffer)
+{
+    memset(aBuffer.mBytes, 0, kHeaderSize);
+    aBuffer.mLength = kHeaderSize;
+}
+
+// Appends a TLV, using the extended length format for long values, and returns the offset of its Type.
+static uint16_t AppendTlv(TlvBuffer &aBuffer, uint8_t aType, uint16_t aLength)
+{
+    uint16_t offset = aBuffer.mLength;
+
+    if (aLength > kMaxTlvLength)
+    {
+        Thread::ExtendedTlv tlv;
+
+        tlv.SetType(aType);
+        tlv.SetLength(aLength);
+        memcpy(aBuffer.mBytes + aBuffer.mLength, &tlv, sizeof(tlv));
+        aBuffer.mLength += sizeof(tlv);
+    }
+    else
+    {
+        Thread::Tlv tlv;
+
+        tlv.SetType(aType);
+        tlv.SetLength(static_cast<uint8_t>(aLength));
+        memcpy(aBuffer.mBytes + aBuffer.mLength, &tlv, sizeof(tlv));
+        aBuffer.mLength += sizeof(tlv);
+    }
+
+    for (uint16_t i = 0; i < aLength; i++)
+    {
+        aBuffer.mBytes[aBuffer.mLength++] = static_cast<uint8_t>(aType + i);
+    }
+
+    return offset;
+}
+
+static Thread::Message *NewMessage(Thread::MessagePool &aMessagePool, const TlvBuffer &aBuffer)
+{
+    Thread::Message *message;
+
+    VerifyOrQuit((message = aMessagePool.New(Thread::Message::kTypeIp6, 0)) != NULL, "Message::New failed\n");
+    SuccessOrQuit(message->Append(aBuffer.mBytes, aBuffer.mLength), "Message::Append failed\n");
+    message->SetOffset(kHeaderSize);
+
+    return message;
+}
+
+// Checks that the index gives the same answers as the scanning lookups in `Tlv`.
+static void VerifyMatchesScan(const Thread::Message &aMessage, const Thread::TlvIndex &aIndex, uint8_t aType)
+{
+    ThreadError scanError;
+    ThreadError indexError;
+    uint16_t scanOffset = 0;
+    uint16_t indexOffset = 0;
+    uint16_t scanLength = 0;
+    uint16_t indexLength = 0;
+    uint8_t scanTlv[sizeof(Thread::Tlv) + 8];
+    uint8_t indexTlv[sizeof(Thread::Tlv) + 8];
+
+    scanError = Thread::Tlv::GetOffset(aMessage, aType, scanOffset);
+    indexError = aIndex.GetOffset(aType, indexOffset);
+    VerifyOrQuit(scanError == indexError && scanOffset == indexOffset,
+                 "TlvIndex::GetOffset does not match Tlv::GetOffset\n");
+
+    scanError = Thread::Tlv::GetValueOffset(aMessage, aType, scanOffset, scanLength);
+    indexError = aIndex.GetValueOffset(aType, indexOffset, indexLength);
+    VerifyOrQuit(scanError == indexError && scanOffset == indexOffset && scanLength == indexLength,
+                 "TlvIndex::GetValueOffset does not match Tlv::GetValueOffset\n");
+
+    memset(scanTlv, 0, sizeof(scanTlv));
+    memset(indexTlv, 0, sizeof(indexTlv));
+    scanError = Thread::Tlv::Get(aMessage, aType, sizeof(scanTlv), *reinterpret_cast<Thread::Tlv *>(scanTlv));
+    indexError = aIndex.Get(aType, sizeof(indexTlv), *reinterpret_cast<Thread::Tlv *>(indexTlv));
+    VerifyOrQuit(scanError == indexError && memcmp(scanTlv, indexTlv, sizeof(scanTlv)) == 0,
+                 "TlvIndex::Get does not match Tlv::Get\n");
+}
+
+void TestTlvIndexLookup(void)
+{
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    TlvBuffer tlvs;
+    uint16_t offset;
+    uint16_t length;
+
+    InitTlvBuffer(tlvs);
+    AppendTlv(tlvs, 1, 2);
+    AppendTlv(tlvs, 7, 0);
+    AppendTlv(tlvs, 63, 5);
+    AppendTlv(tlvs, 9, 4);
+    message = NewMessage(messagePool, tlvs);
+
+    {
+        Thread::TlvIndex index(*message);
+
+        for (uint16_t type = 0; type <= 0xff; type++)
+        {
+            VerifyMatchesScan(*message, index, static_cast<uint8_t>(type));
+        }
+
+        // The bytes before the message offset are not TLVs.
+        VerifyOrQuit(index.GetOffset(0, offset) == kThreadError_NotFound, "TlvIndex indexed the message header\n");
+
+        SuccessOrQuit(index.GetValueOffset(7, offset, length), "TlvIndex::GetValueOffset failed\n");
+        VerifyOrQuit(offset == kHeaderSize + 6 && length == 0, "TlvIndex::GetValueOffset wrong empty value\n");
+    }
+
+    message->Free();
+}
+
+void TestTlvIndexRepeatedType(void)
+{
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    TlvBuffer tlvs;
+    uint16_t first;
+    uint16_t offset;
+    uint16_t length;
+    uint8_t buffer[sizeof(Thread::Tlv) + 8];
+    Thread::Tlv &tlv = *reinterpret_cast<Thread::Tlv *>(buffer);
+
+    InitTlvBuffer(tlvs);
+    AppendTlv(tlvs, 2, 1);
+    first = AppendTlv(tlvs, 4, 3);
+    AppendTlv(tlvs, 4, 6);
+    AppendTlv(tlvs, 70, 1);
+    AppendTlv(tlvs, 70, 2);
+    message = NewMessage(messagePool, tlvs);
+
+    {
+        Thread::TlvIndex index(*message);
+
+        // Like the scanning lookups, the first TLV of a type wins.
+        SuccessOrQuit(index.GetOffset(4, offset), "TlvIndex::GetOffset failed\n");
+        VerifyOrQuit(offset == first, "TlvIndex::GetOffset did not return the first TLV\n");
+        SuccessOrQuit(index.GetValueOffset(4, offset, length), "TlvIndex::GetValueOffset failed\n");
+        VerifyOrQuit(offset == first + sizeof(Thread::Tlv) && length == 3,
+                     "TlvIndex::GetValueOffset did not return the first TLV\n");
+        SuccessOrQuit(index.Get(4, sizeof(buffer), tlv), "TlvIndex::Get failed\n");
+        VerifyOrQuit(tlv.GetLength() == 3, "TlvIndex::Get did not return the first TLV\n");
+
+        // Types beyond the indexed range fall back to a scan, which also keeps the first TLV.
+        SuccessOrQuit(index.GetValueOffset(70, offset, length), "TlvIndex::GetValueOffset failed\n");
+        VerifyOrQuit(length == 1, "TlvIndex::GetValueOffset did not return the first unindexed TLV\n");
+
+        VerifyMatchesScan(*message, index, 4);
+        VerifyMatchesScan(*message, index, 70);
+    }
+
+    message->Free();
+}
+
+void TestTlvIndexExtendedLength(void)
+{
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    TlvBuffer tlvs;
+    uint16_t extended;
+    uint16_t offset;
+    uint16_t length;
+    uint8_t buffer[sizeof(Thread::Tlv) + 8];
+    uint8_t value[kExtendedValueLen];
+
+    InitTlvBuffer(tlvs);
+    AppendTlv(tlvs, 1, 2);
+    extended = AppendTlv(tlvs, 5, kExtendedValueLen);
+    AppendTlv(tlvs, 9, 4);
+    AppendTlv(tlvs, 80, 3);
+    message = NewMessage(messagePool, tlvs);
+
+    {
+        Thread::TlvIndex index(*message);
+
+        // The value of an extended TLV is reachable, and the TLVs after it are still indexed.
+        SuccessOrQuit(index.GetValueOffset(5, offset, length), "TlvIndex::GetValueOffset failed\n");
+        VerifyOrQuit(offset == extended + sizeof(Thread::ExtendedTlv) && length == kExtendedValueLen,
+                     "TlvIndex::GetValueOffset wrong extended value\n");
+        VerifyOrQuit(message->Read(offset, length, value) == length && value[0] == 5 &&
+                     value[kExtendedValueLen - 1] == static_cast<uint8_t>(5 + kExtendedValueLen - 1),
+                     "TlvIndex::GetValueOffset wrong extended value content\n");
+
+        // Its header does not fit `Tlv`, so it is not returned by offset.
+        VerifyOrQuit(index.GetOffset(5, offset) == kThreadError_NotFound,
+                     "TlvIndex::GetOffset returned an extended TLV\n");
+        VerifyOrQuit(index.Get(5, sizeof(buffer), *reinterpret_cast<Thread::Tlv *>(buffer)) == kThreadError_NotFound,
+                     "TlvIndex::Get returned an extended TLV\n");
+
+        VerifyMatchesScan(*message, index, 1);
+        VerifyMatchesScan(*message, index, 5);
+        VerifyMatchesScan(*message, index, 9);
+        VerifyMatchesScan(*message, index, 80);
+    }
+
+    message->Free();
+}
+
+void TestTlvIndexTruncated(void)
+{
+    otInstance instance;
+    Thread::MessagePool messagePool(&instance);
+    Thread::Message *message;
+    TlvBuffer tlvs;
+    uint16_t offset;
+    uint16_t length;
+
+    // The final TLV claims more bytes than the message holds.
+    InitTlvBuffer(tlvs);
+    AppendTlv(tlvs, 1, 2);
+    AppendTlv(tlvs, 3, 4);
+    tlvs.mBytes[tlvs.mLength - 5] = 10;
+    message = NewMessage(messagePool, tlvs);
+
+    {
+        Thread::TlvIndex index(*message);
+
+        SuccessOrQuit(index.GetOffset(1, offset), "TlvIndex lost the TLV before a truncated one\n");
+        VerifyOrQuit(index.GetOffset(3, offset) == kThreadError_NotFound, "TlvIndex::GetOffset truncated TLV\n");
+        VerifyOrQuit(index.GetValueOffset(3, offset, length) == kThreadError_NotFound,
+                     "TlvIndex::GetValueOffset truncated TLV\n");
+        VerifyOrQuit(Thread::Tlv::GetOffset(*message, 3, offset) == kThreadError_NotFound,
+                     "Tlv::GetOffset truncated TLV\n");
+    }
+
+    message->Free();
+
+    // The final TLV is cut inside its extended length, or inside its Type and Length.
+    for (uint8_t cut = 1; cut <= 3; cut++)
+    {
+        InitTlvBuffer(tlvs);
+        AppendTlv(tlvs, 1, 2);
+        AppendTlv(tlvs, 6, kExtendedValueLen);
+        tlvs.mLength -= kExtendedValueLen + cut;
+        message = NewMessage(messagePool, tlvs);
+
+        {
+            Thread::TlvIndex index(*message);
+
+            SuccessOrQuit(index.GetOffset(1, offset), "TlvIndex lost the TLV before a truncated one\n");
+            VerifyOrQuit(index.GetValueOffset(6, offset, length) == kThreadError_NotFound,
+                         "TlvIndex::GetValueOffset truncated extended TLV\n");
+        }
+
+        message->Free();
+    }
+}
+
+#ifdef ENABLE_TEST_MAIN
+int main(void)
+{
+    TestTlvIndexLookup();
+    TestTlvIndexRepeatedType();
+    TestTlvIndexExtendedLength();
+    TestTlvIndexTruncated();
+    printf("All tests passed\n");
+    return 0;
+}
+#endif
@@ -35,10 +35,21 @@ using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 #pragma region Test Declarations
 
+// test_address_resolver.cpp
+namespace Thread
+{
+    void TestAddressResolverHitMiss();
+    void TestAddressResolverEviction();
+    void TestAddressResolverInvalidation();
+}
+
 // test_aes.cpp
 void TestMacBeaconFrame();
 void TestMacDataFrame();
 void TestMacCommandFrame();
+void TestAesCcmKeyContextPerformance();
+void TestAesCcmStreaming();
+void TestAesCcmThroughput();
 
 // test_hmac_sha256.cpp
 void TestHmacSha256();
@@ -60,10 +71,47 @@ namespace Thread
 namespace Thread
 {
     void TestMacHeader();
+    void TestMacFrameLayout();
+    void TestMacFrameParsePerformance();
+}
+
+// test_mesh_forwarder.cpp
+namespace Thread
+{
+    void TestReassemblyInOrder();
+    void TestReassemblyOutOfOrder();
+    void TestReassemblyDuplicates();
+    void TestReassemblyPartialBlock();
+    void TestReassemblySourceCollision();
+    void TestReassemblyTimeout();
+    void TestReassemblyFailures();
+    void TestRelayFlow();
+    void TestRelayNextHopLost();
+    void TestIndirectPriority();
+    void TestIndirectOrder();
+    void TestIndirectBroadcast();
+    void TestIndirectClear();
 }
 
 // test_message.cpp
 void TestMessage();
+void TestMessageCursor();
+void TestMessageCursorPerformance();
+void TestMessageChecksum();
+void TestMessageChecksumPerformance();
+
+// test_neighbor_index.cpp
+namespace Thread
+{
+    void TestNeighborIndex();
+}
+
+// test_network_data.cpp
+namespace Thread
+{
+    void TestNetworkDataLookup();
+    void TestNetworkDataLookupPerformance();
+}
 
 // test_message_queue.cpp
 void TestMessageQueue();
@@ -71,15 +119,47 @@ void TestMessageQueue();
 // test_priority_queue.cpp
 void TestPriorityQueue();
 
+// test_hdlc.cpp
+namespace Thread
+{
+    void TestHdlcFcs(void);
+    void TestHdlcEncoder(void);
+    void TestHdlcDecoder(void);
+    void TestHdlcPerformance(void);
+}
+
 // test_ncp_buffer.cpp
 namespace Thread
 {
     void TestNcpFrameBuffer(void);
 }
 
+// test_ncp_dispatch.cpp
+namespace Thread
+{
+    void TestNcpDispatch(void);
+}
+
+// test_ncp_uart.cpp
+namespace Thread
+{
+    void TestNcpUartReceiveFrame(void);
+    void TestNcpUartReceiveCoalesced(void);
+    void TestNcpUartReceiveMalformed(void);
+    void TestNcpUartSendCoalesced(void);
+    void TestNcpUartSendSizeLimit(void);
+}
+
 // test_timer.cpp
 int TestOneTimer();
 int TestTenTimers();
+int TestManyTimers();
+
+// test_tlvs.cpp
+void TestTlvIndexLookup();
+void TestTlvIndexRepeatedType();
+void TestTlvIndexExtendedLength();
+void TestTlvIndexTruncated();
 
 // test_toolchain.cpp
 void test_packed1();
@@ -130,10 +210,18 @@ namespace Thread
             testPlatResetToDefaults();
         }
 
+        // test_address_resolver.cpp
+        TEST_METHOD(TestAddressResolverHitMiss) { Thread::TestAddressResolverHitMiss(); }
+        TEST_METHOD(TestAddressResolverEviction) { Thread::TestAddressResolverEviction(); }
+        TEST_METHOD(TestAddressResolverInvalidation) { Thread::TestAddressResolverInvalidation(); }
+
         // test_aes.cpp
         TEST_METHOD(TestMacBeaconFrame) { ::TestMacBeaconFrame(); }
         TEST_METHOD(TestMacDataFrame) { ::TestMacDataFrame(); }
         TEST_METHOD(TestMacCommandFrame) { ::TestMacCommandFrame(); }
+        TEST_METHOD(TestAesCcmKeyContextPerformance) { ::TestAesCcmKeyContextPerformance(); }
+        TEST_METHOD(TestAesCcmStreaming) { ::TestAesCcmStreaming(); }
+        TEST_METHOD(TestAesCcmThroughput) { ::TestAesCcmThroughput(); }
 
         // test_hmac_sha256.cpp
         TEST_METHOD(TestHmacSha256) { ::TestHmacSha256(); }
@@ -147,9 +235,37 @@ namespace Thread
 
         // test_mac_frame.cpp
         TEST_METHOD(TestMacHeader) { Thread::TestMacHeader(); }
+        TEST_METHOD(TestMacFrameLayout) { Thread::TestMacFrameLayout(); }
+        TEST_METHOD(TestMacFrameParsePerformance) { Thread::TestMacFrameParsePerformance(); }
+
+        // test_mesh_forwarder.cpp
+        TEST_METHOD(TestReassemblyInOrder) { Thread::TestReassemblyInOrder(); }
+        TEST_METHOD(TestReassemblyOutOfOrder) { Thread::TestReassemblyOutOfOrder(); }
+        TEST_METHOD(TestReassemblyDuplicates) { Thread::TestReassemblyDuplicates(); }
+        TEST_METHOD(TestReassemblyPartialBlock) { Thread::TestReassemblyPartialBlock(); }
+        TEST_METHOD(TestReassemblySourceCollision) { Thread::TestReassemblySourceCollision(); }
+        TEST_METHOD(TestReassemblyTimeout) { Thread::TestReassemblyTimeout(); }
+        TEST_METHOD(TestReassemblyFailures) { Thread::TestReassemblyFailures(); }
+        TEST_METHOD(TestRelayFlow) { Thread::TestRelayFlow(); }
+        TEST_METHOD(TestRelayNextHopLost) { Thread::TestRelayNextHopLost(); }
+        TEST_METHOD(TestIndirectPriority) { Thread::TestIndirectPriority(); }
+        TEST_METHOD(TestIndirectOrder) { Thread::TestIndirectOrder(); }
+        TEST_METHOD(TestIndirectBroadcast) { Thread::TestIndirectBroadcast(); }
+        TEST_METHOD(TestIndirectClear) { Thread::TestIndirectClear(); }
 
         // test_message.cpp
         TEST_METHOD(TestMessage) { ::TestMessage(); }
+        TEST_METHOD(TestMessageCursor) { ::TestMessageCursor(); }
+        TEST_METHOD(TestMessageCursorPerformance) { ::TestMessageCursorPerformance(); }
+        TEST_METHOD(TestMessageChecksum) { ::TestMessageChecksum(); }
+        TEST_METHOD(TestMessageChecksumPerformance) { ::TestMessageChecksumPerformance(); }
+
+        // test_neighbor_index.cpp
+        TEST_METHOD(TestNeighborIndex) { Thread::TestNeighborIndex(); }
+
+        // test_network_data.cpp
+        TEST_METHOD(TestNetworkDataLookup) { Thread::TestNetworkDataLookup(); }
+        TEST_METHOD(TestNetworkDataLookupPerformance) { Thread::TestNetworkDataLookupPerformance(); }
 
         // test_message_queue.cpp
         TEST_METHOD(TestMessageQueue) { ::TestMessageQueue(); }
@@ -160,10 +276,33 @@ namespace Thread
         // test_timer.cpp
         TEST_METHOD(TestOneTimer) { ::TestOneTimer(); }
         TEST_METHOD(TestTenTimers) { ::TestTenTimers(); }
+        TEST_METHOD(TestManyTimers) { ::TestManyTimers(); }
+
+        // test_hdlc.cpp
+        TEST_METHOD(TestHdlcFcs) { Thread::TestHdlcFcs(); }
+        TEST_METHOD(TestHdlcEncoder) { Thread::TestHdlcEncoder(); }
+        TEST_METHOD(TestHdlcDecoder) { Thread::TestHdlcDecoder(); }
+        TEST_METHOD(TestHdlcPerformance) { Thread::TestHdlcPerformance(); }
 
         // test_ncp_buffer.cpp
         TEST_METHOD(TestNcpFrameBuffer) { Thread::TestNcpFrameBuffer(); }
 
+        // test_ncp_dispatch.cpp
+        TEST_METHOD(TestNcpDispatch) { Thread::TestNcpDispatch(); }
+
+        // test_ncp_uart.cpp
+        TEST_METHOD(TestNcpUartReceiveFrame) { Thread::TestNcpUartReceiveFrame(); }
+        TEST_METHOD(TestNcpUartReceiveCoalesced) { Thread::TestNcpUartReceiveCoalesced(); }
+        TEST_METHOD(TestNcpUartReceiveMalformed) { Thread::TestNcpUartReceiveMalformed(); }
+        TEST_METHOD(TestNcpUartSendCoalesced) { Thread::TestNcpUartSendCoalesced(); }
+        TEST_METHOD(TestNcpUartSendSizeLimit) { Thread::TestNcpUartSendSizeLimit(); }
+
+        // test_tlvs.cpp
+        TEST_METHOD(TestTlvIndexLookup) { ::TestTlvIndexLookup(); }
+        TEST_METHOD(TestTlvIndexRepeatedType) { ::TestTlvIndexRepeatedType(); }
+        TEST_METHOD(TestTlvIndexExtendedLength) { ::TestTlvIndexExtendedLength(); }
+        TEST_METHOD(TestTlvIndexTruncated) { ::TestTlvIndexTruncated(); }
+
         // test_toolchain.cpp
         TEST_METHOD(test_packed1) { ::test_packed1(); }
         TEST_METHOD(test_packed2) { ::test_packed2(); }
@@ -478,6 +478,7 @@ class SpinelCliCmd(Cmd, SpinelCodec):
             mle: 0 0
             arp: 0 0
             coap: 0 0
+            6lo relay: 0 0
             Done
         \033[0m
         """
@@ -495,6 +496,7 @@ class SpinelCliCmd(Cmd, SpinelCodec):
             print("mle: %d %d" % result[10:12])
             print("arp: %d %d" % result[12:14])
             print("coap: %d %d" % result[14:16])
+            print("6lo relay: %d %d" % result[16:18])
             print("Done")
         else:
             print("Error")
@@ -688,7 +688,7 @@ class SpinelPropertyHandler(SpinelCodec):
 
     def PIB_MAC_SECURITY_ENABLED(self, _wpan_api, payload): pass
 
-    def MSG_BUFFER_COUNTERS(self, _wpan_api, payload): return self.parse_fields(payload, "SSSSSSSSSSSSSSSS")
+    def MSG_BUFFER_COUNTERS(self, _wpan_api, payload): return self.parse_fields(payload, "SSSSSSSSSSSSSSSSSS")
 
 #=========================================
 